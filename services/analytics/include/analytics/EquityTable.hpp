@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <analytics/RangeTracker.hpp>
+
+namespace Analytics {
+    static constexpr std::array<char, 4> EQUITY_TABLE_MAGIC   = {'P', 'T', 'E', 'Q'};
+    static constexpr uint32_t            EQUITY_TABLE_VERSION = 1;
+
+    class invalid_equity_table : public std::runtime_error {
+        public:
+            explicit invalid_equity_table(const std::string& arg)
+              : runtime_error(arg) {};
+    };
+
+    /**
+     * @brief Pre-flop all in equity of each hand class against each other one, the cached data of the push or fold advisor.
+     *
+     * The equities are sampled once, a few seconds on all the cores, then saved to a file loaded at the next start. File layout
+     * (version 1), in the native byte order: magic `PTEQ`, u32 version, u32 samples per classes pair, then the 169 x 169 float
+     * equities of the row class against the column class.
+     */
+    class EquityTable {
+        public:
+            using card_t  = int32_t;  // A card index, as Range::cardIndex
+            using board_t = std::array<card_t, 5>;
+
+            static constexpr int32_t DEFAULT_SAMPLES = 2'000;
+
+            // Every class pair at 50% until the table is computed or loaded
+            EquityTable()
+              : _equities(static_cast<std::size_t>(HAND_CLASSES_NUMBER * HAND_CLASSES_NUMBER), 0.5F) {}
+
+            [[nodiscard]] auto getSamplesNumber() const -> int32_t { return _samplesNumber; }
+            [[nodiscard]] auto getEquity(int32_t heroClass, int32_t villainClass) const -> float;
+            // The equity of the hero class against the classes weighted by the given weights
+            [[nodiscard]] auto getEquity(int32_t heroClass, const Range::class_weights_t& villainClasses) const -> double;
+
+            auto save(const std::filesystem::path& path) const -> void;
+
+            [[nodiscard]] static auto load(const std::filesystem::path& path) -> EquityTable;
+            // Sample samplesNumber showdowns per classes pair on up to threadsNumber threads, the seed makes the table reproducible
+            [[nodiscard]] static auto compute(int32_t     samplesNumber = DEFAULT_SAMPLES,
+                                              std::size_t threadsNumber = std::max(1U, std::thread::hardware_concurrency()),
+                                              uint64_t    seed          = 0) -> EquityTable;
+            // The first hand share of the pot at the showdown: 1 when it wins, 0.5 on a split and 0 when it loses
+            [[nodiscard]] static auto showdown(std::array<card_t, 2> first, std::array<card_t, 2> second, const board_t& board)
+                -> double;
+
+        private:
+            std::vector<float> _equities;  // Row class against column class
+            int32_t            _samplesNumber = 0;
+    };
+}  // namespace Analytics
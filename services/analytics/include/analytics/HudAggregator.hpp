@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include <analytics/PlayerStats.hpp>
+#include <game_handler/Game.hpp>
+
+namespace Analytics {
+    using GameHandler::Game;
+    using GameHandler::Round;
+
+    /**
+     * @brief HUD statistics of the players, by name, updated incrementally from the ended rounds.
+     *
+     * A round is read in one pass over its actions with a fixed size state per seat, then each dealt player stats are looked up
+     * once by name. Two aggregators are merged by adding their counters, so a backfill builds one partial aggregator per thread
+     * and merges them at the end.
+     */
+    class HudAggregator {
+        public:
+            HudAggregator() = default;
+
+            [[nodiscard]] auto getPlayersNumber() const -> std::size_t { return _stats.size(); }
+            [[nodiscard]] auto contains(std::string_view playerName) const -> bool { return _stats.contains(playerName); }
+            // The stats of the player, empty if the player has never been seen
+            [[nodiscard]] auto getStats(std::string_view playerName) const -> PlayerStats;
+
+            template<typename Callback> auto forEachPlayer(Callback&& callback) const -> void {
+                for (const auto& [playerName, stats] : _stats) { callback(std::string_view(playerName), stats); }
+            }
+
+            auto addRound(const Round& round, const Game& game) -> void;
+            auto addGame(const Game& game) -> void;
+            auto merge(const HudAggregator& other) -> void;
+
+            [[nodiscard]] auto toJson() const -> json;
+
+            // Aggregate the games on up to threadsNumber threads, each thread fills its own aggregator before they are merged
+            [[nodiscard]] static auto backfill(std::span<const Game> games,
+                                               std::size_t threadsNumber = std::max(1U, std::thread::hardware_concurrency()))
+                -> HudAggregator;
+
+        private:
+            // Transparent hash so the stats are looked up with a string view without building a string
+            struct NameHash {
+                    using is_transparent = void;
+
+                    auto operator()(std::string_view name) const -> std::size_t { return std::hash<std::string_view> {}(name); }
+            };
+
+            std::unordered_map<std::string, PlayerStats, NameHash, std::equal_to<>> _stats;
+
+            auto _getOrCreate(std::string_view playerName) -> PlayerStats&;
+    };
+}  // namespace Analytics
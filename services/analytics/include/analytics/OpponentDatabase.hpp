@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include <analytics/HudAggregator.hpp>
+
+namespace Analytics {
+    static constexpr std::array<char, 4> OPPONENT_DATABASE_MAGIC   = {'P', 'T', 'O', 'D'};
+    static constexpr uint32_t            OPPONENT_DATABASE_VERSION = 1;
+
+    static_assert(std::is_trivially_copyable_v<PlayerStats>, "The stats records are copied as is in the mapped file");
+
+    class invalid_opponent_database : public std::runtime_error {
+        public:
+            explicit invalid_opponent_database(const std::string& arg)
+              : runtime_error(arg) {};
+    };
+
+    class opponent_database_locked : public invalid_opponent_database {
+        public:
+            explicit opponent_database_locked(const std::string& arg)
+              : invalid_opponent_database(arg) {};
+    };
+
+    /**
+     * @brief Persistent players stats by name, in a memory mapped file shared between the processes.
+     *
+     * File layout (version 1), in the native byte order:
+     *  - Header: magic `PTOD`, u32 version, u64 slots number, records capacity, names capacity, records number and names size.
+     *  - Index: the open addressing slots, linear probing. A slot is 0 when empty, else a 24 bits tag of the name hash above the
+     *    40 bits record number (1-based).
+     *  - Records: fixed size records, a u32 sequence, the u32 name size, the u64 name offset and the PlayerStats counters.
+     *  - Names: the interned names bytes, one copy per name referenced by its record.
+     *
+     * Only one writer adds the stats while any number of readers look them up without lock. A new record and its name are
+     * written before their slot is published, and a record update is guarded by its sequence (odd while it is written), the
+     * readers copy the stats again when the sequence changed during their copy. The capacity is set when the file is created
+     * so the mapping never moves under the readers.
+     *
+     * The writer holds an exclusive advisory lock on the file while it is opened, a second read-write opening throws. The
+     * sequences left odd by a writer stopped during an update are made even again by the next writer.
+     */
+    class OpponentDatabase {
+        public:
+            enum class Mode : int32_t { READ_ONLY = 0, READ_WRITE };
+
+            static constexpr std::size_t DEFAULT_CAPACITY  = 1 << 20;
+            static constexpr std::size_t AVERAGE_NAME_SIZE = 32;       // Names storage reserved per opponent
+            static constexpr int32_t     MAX_READ_RETRIES  = 1 << 16;  // Copies of a record being updated before giving up
+
+            // Open the database, in read-write mode the file is created with the given opponents capacity if it does not exist
+            explicit OpponentDatabase(const std::filesystem::path& path,
+                                      Mode                         mode     = Mode::READ_WRITE,
+                                      std::size_t                  capacity = DEFAULT_CAPACITY);
+            OpponentDatabase(const OpponentDatabase& other) = delete;
+            OpponentDatabase(OpponentDatabase&& other)      = delete;
+
+            ~OpponentDatabase();
+
+            auto operator=(const OpponentDatabase& other) -> OpponentDatabase& = delete;
+            auto operator=(OpponentDatabase&& other) -> OpponentDatabase&      = delete;
+
+            [[nodiscard]] auto size() const -> std::size_t;
+            [[nodiscard]] auto getCapacity() const -> std::size_t;
+            [[nodiscard]] auto getMode() const -> Mode { return _mode; }
+            // None when the player is unknown or when its record stayed in update during all the read retries
+            [[nodiscard]] auto find(std::string_view playerName) const -> std::optional<PlayerStats>;
+
+            // Add the stats to the player record, created if the player is not in the database yet. Single writer only.
+            auto add(std::string_view playerName, const PlayerStats& stats) -> void;
+            auto add(const HudAggregator& hud) -> void;
+            auto flush() -> void;
+
+        private:
+            struct Header;
+            struct Record;
+
+            uint8_t*    _data    = nullptr;
+            std::size_t _size    = 0;
+            void*       _mapping = nullptr;  // Platform file mapping handle
+            intptr_t    _file    = -1;       // Platform file handle kept opened by the writer to hold its lock
+            Header*     _header  = nullptr;
+            uint64_t*   _slots   = nullptr;
+            Record*     _records = nullptr;
+            char*       _names   = nullptr;
+            Mode        _mode;
+
+            [[nodiscard]] static auto _hash(std::string_view playerName) -> uint64_t;
+            [[nodiscard]] static auto _fileSize(std::size_t capacity) -> std::size_t;
+
+            [[nodiscard]] auto _findSlot(std::string_view playerName, uint64_t hash) const -> uint64_t*;
+            [[nodiscard]] auto _name(const Record& record) const -> std::string_view;
+
+            // True when the file was empty and extended to the create size
+            auto _map(const std::filesystem::path& path, std::size_t createSize) -> bool;
+            auto _unmap() -> void;
+            auto _initialize(std::size_t capacity) -> void;
+            auto _checkHeader() -> void;
+            auto _resetInterruptedUpdates() -> void;
+    };
+}  // namespace Analytics
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <nlohmann/json.hpp>
+
+#include <fmt/format.h>
+#include <logger/Logger.hpp>
+
+namespace Analytics {
+    using json = nlohmann::json;
+
+    // Upper bounds in big blinds of the stack depth buckets, the last bucket has no upper bound
+    static constexpr std::array<int32_t, 3> STACK_DEPTH_BOUNDS    = {10, 20, 40};
+    static constexpr std::size_t            STACK_DEPTH_BUCKETS   = STACK_DEPTH_BOUNDS.size() + 1;
+    static constexpr double                 PERCENTAGE_MULTIPLIER = 100.0;
+
+    /**
+     * @brief The HUD counters of a player, only counters are stored so two partial stats are merged by adding them.
+     *
+     * The percentages are computed on access and are 0 when the player never had the opportunity.
+     */
+    struct PlayerStats {
+        public:
+            using depth_counters_t = std::array<uint32_t, STACK_DEPTH_BUCKETS>;
+
+            uint32_t         hands                 = 0;
+            uint32_t         vpip                  = 0;  // Voluntarily put chips in the pot pre-flop
+            uint32_t         pfr                   = 0;  // Bet or raised pre-flop
+            uint32_t         threeBetOpportunities = 0;
+            uint32_t         threeBets             = 0;
+            uint32_t         stealsFaced           = 0;  // In the blinds facing a raise from the cutoff, the button or the small blind
+            uint32_t         foldsToSteal          = 0;
+            uint32_t         postflopAggressions   = 0;  // Bets and raises from the flop
+            uint32_t         postflopCalls         = 0;
+            uint32_t         sawFlop               = 0;
+            uint32_t         wentToShowdown        = 0;
+            uint32_t         wonAtShowdown         = 0;
+            depth_counters_t handsByDepth          = {};
+            depth_counters_t allInsByDepth         = {};
+
+            auto operator+=(const PlayerStats& other) -> PlayerStats&;
+            auto operator==(const PlayerStats& other) const -> bool = default;
+
+            [[nodiscard]] auto getVpip() const -> double { return _percentage(vpip, hands); }
+            [[nodiscard]] auto getPfr() const -> double { return _percentage(pfr, hands); }
+            [[nodiscard]] auto getThreeBet() const -> double { return _percentage(threeBets, threeBetOpportunities); }
+            [[nodiscard]] auto getFoldToSteal() const -> double { return _percentage(foldsToSteal, stealsFaced); }
+            [[nodiscard]] auto getWtsd() const -> double { return _percentage(wentToShowdown, sawFlop); }
+            [[nodiscard]] auto getWsd() const -> double { return _percentage(wonAtShowdown, wentToShowdown); }
+            [[nodiscard]] auto getAllIn(std::size_t depthBucket) const -> double {
+                return _percentage(allInsByDepth.at(depthBucket), handsByDepth.at(depthBucket));
+            }
+
+            // Aggression factor, the postflop bets and raises number divided by the postflop calls number
+            [[nodiscard]] auto getAf() const -> double {
+                return postflopCalls == 0 ? static_cast<double>(postflopAggressions)
+                                          : static_cast<double>(postflopAggressions) / static_cast<double>(postflopCalls);
+            }
+
+            [[nodiscard]] auto toJson() const -> json;
+
+            [[nodiscard]] static auto depthBucket(int32_t stack, int32_t bigBlind) -> std::size_t;
+
+        private:
+            [[nodiscard]] static auto _percentage(uint32_t count, uint32_t total) -> double {
+                return total == 0 ? 0.0 : PERCENTAGE_MULTIPLIER * static_cast<double>(count) / static_cast<double>(total);
+            }
+    };
+}  // namespace Analytics
+
+// Custom fmt formatter for PlayerStats, a one line HUD
+namespace fmt {
+    using Analytics::PlayerStats;
+
+    template<> struct formatter<PlayerStats> : formatter<string_view> {
+            template<typename FormatContext> auto format(const PlayerStats& stats, FormatContext& ctx) const {
+                return fmt::format_to(ctx.out(),
+                                      "{} hands, VPIP {:.1f}, PFR {:.1f}, 3-bet {:.1f}, fold to steal {:.1f}, AF {:.2f}, WTSD {:.1f}, W$SD {:.1f}",
+                                      stats.hands,
+                                      stats.getVpip(),
+                                      stats.getPfr(),
+                                      stats.getThreeBet(),
+                                      stats.getFoldToSteal(),
+                                      stats.getAf(),
+                                      stats.getWtsd(),
+                                      stats.getWsd());
+            }
+    };
+}  // namespace fmt
+
+// Registered as safe to copy for Quill logger
+namespace quill {
+    template<> struct copy_loggable<Analytics::PlayerStats> : std::true_type {};
+}  // namespace quill
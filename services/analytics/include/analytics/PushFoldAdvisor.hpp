@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <analytics/EquityTable.hpp>
+#include <game_handler/Game.hpp>
+
+namespace Analytics {
+    using GameHandler::Game;
+    using std::chrono::microseconds;
+    using std::chrono::milliseconds;
+
+    static constexpr milliseconds DECISION_DEADLINE = milliseconds(50);  // The advice is useless once the hero has to act
+
+    struct PushFoldAdvice {
+        public:
+            enum class Action : int32_t { NONE = 0, PUSH, CALL, FOLD };
+            // The equities the advice is computed from, from the roughest to the most accurate
+            enum class Quality : int32_t { NONE = 0, APPROXIMATE, TABLE, SIMULATED };
+
+            Action       action        = Action::NONE;  // NONE when it is not a push or fold spot for the hero
+            Quality      quality       = Quality::NONE;
+            double       evDifference  = 0;  // The advised action EV minus the other action EV, in buy-ins
+            double       equity        = 0;  // The hero equity when the pot is contested, against the first caller or the pusher
+            int32_t      samplesNumber = 0;  // The simulated showdowns
+            microseconds elapsed       = microseconds(0);
+    };
+
+    /**
+     * @brief Push, call or fold advice for the hero pre-flop, computed with ICM within a deadline.
+     *
+     * The spot is read from the live round: the hero can push or fold when the highest bet is not all in, call or fold when it
+     * is. The villains who may call a push call with the hand classes whose equity against the hero pushing range beats their pot
+     * odds, the hero pushing range being the strongest hands, wider on short stacks. A villain range tracked by the RangeTracker
+     * is the starting range of the villain, a full range otherwise.
+     *
+     * The answer is refined in steps, each one replacing the previous answer only when it completes before the deadline: the
+     * Chen formula strengths at first, then the equity table once it is loaded, then showdowns of the hero cards simulated
+     * against the villains range until the deadline is near. The EVs are the ICM equities of the hero after each outcome.
+     */
+    class PushFoldAdvisor {
+        public:
+            static constexpr milliseconds DEADLINE_MARGIN  = milliseconds(5);  // Kept to publish the advice
+            static constexpr int32_t      SIMULATION_BATCH = 256;
+            static constexpr int32_t      MIN_SIMULATIONS  = 1'000;  // By villain range, for the simulation to be used
+            static constexpr int32_t      MAX_SIMULATIONS  = 50'000;
+
+            explicit PushFoldAdvisor(std::shared_ptr<const EquityTable> equityTable = nullptr)
+              : _equityTable(std::move(equityTable)) {}
+
+            // Thread safe, the table can be computed or loaded on another thread while advising
+            auto setEquityTable(std::shared_ptr<const EquityTable> equityTable) -> void { _equityTable.store(std::move(equityTable)); }
+            // The prize of each place in buy-ins, by default the winner takes the game prize pool
+            auto setPayouts(std::vector<double> payouts) -> void { _payouts = std::move(payouts); }
+
+            [[nodiscard]] auto hasEquityTable() const -> bool { return _equityTable.load() != nullptr; }
+            // To call on the hero turn, the round does not know whose turn it is before the action is played
+            [[nodiscard]] auto advise(const Round&        round,
+                                      const Game&         game,
+                                      const RangeTracker* ranges = nullptr,
+                                      milliseconds        budget = DECISION_DEADLINE) const -> PushFoldAdvice;
+
+            // Malmuth-Harville ICM equity of each stack for the given payouts
+            [[nodiscard]] static auto icm(std::span<const int32_t> stacks, std::span<const double> payouts) -> std::vector<double>;
+
+        private:
+            std::atomic<std::shared_ptr<const EquityTable>> _equityTable;
+            std::vector<double>                             _payouts;
+    };
+}  // namespace Analytics
+
+// Custom fmt formatter for PushFoldAdvice, one log line
+namespace fmt {
+    using Analytics::PushFoldAdvice;
+
+    template<> struct formatter<PushFoldAdvice> : formatter<string_view> {
+            template<typename FormatContext> auto format(const PushFoldAdvice& advice, FormatContext& ctx) const {
+                string_view action  = "none";
+                string_view quality = "none";
+
+                switch (advice.action) {
+                    case PushFoldAdvice::Action::PUSH: action = "push"; break;
+                    case PushFoldAdvice::Action::CALL: action = "call"; break;
+                    case PushFoldAdvice::Action::FOLD: action = "fold"; break;
+                    case PushFoldAdvice::Action::NONE: break;
+                }
+
+                switch (advice.quality) {
+                    case PushFoldAdvice::Quality::APPROXIMATE: quality = "approximate"; break;
+                    case PushFoldAdvice::Quality::TABLE: quality = "equity table"; break;
+                    case PushFoldAdvice::Quality::SIMULATED: quality = "simulated"; break;
+                    case PushFoldAdvice::Quality::NONE: break;
+                }
+
+                return fmt::format_to(ctx.out(),
+                                      "{} by {:.3f} buy-ins, equity {:.1f}% ({}, {} showdowns, {} us)",
+                                      action,
+                                      advice.evDifference,
+                                      advice.equity * 100,
+                                      quality,
+                                      advice.samplesNumber,
+                                      advice.elapsed.count());
+            }
+    };
+}  // namespace fmt
+
+// Registered as safe to copy for Quill logger
+namespace quill {
+    template<> struct copy_loggable<Analytics::PushFoldAdvice> : std::true_type {};
+}  // namespace quill
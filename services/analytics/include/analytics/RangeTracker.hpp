@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <game_handler/Round.hpp>
+
+namespace Analytics {
+    using GameHandler::Card;
+    using GameHandler::Hand;
+    using GameHandler::Round;
+    using GameHandler::RoundAction;
+
+    static constexpr int32_t DECK_CARDS_NUMBER   = 52;
+    static constexpr int32_t COMBOS_NUMBER       = 1326;  // Two cards combos of the deck
+    static constexpr int32_t HAND_CLASSES_NUMBER = 169;   // Pairs, suited and off-suit hands by ranks
+    static constexpr int32_t COMBO_LANES         = 8;     // Floats per SIMD register on AVX, the combos are padded to a multiple
+    static constexpr int32_t PADDED_COMBOS       = (COMBOS_NUMBER + COMBO_LANES - 1) / COMBO_LANES * COMBO_LANES;
+
+    /**
+     * @brief Probability of each of the 1326 two cards combos.
+     *
+     * A card index is 4 times its rank from 0 for a two plus its suit, the combo of the cards indexes a < b is b * (b - 1) / 2 + a.
+     * The weights are stored in a fixed size aligned array padded with zeros, so an update is a loop the compiler turns into SIMD
+     * multiplications. The weights are kept normalized, they sum to 1 unless every combo is blocked.
+     */
+    class Range {
+        public:
+            using weights_t       = std::array<float, PADDED_COMBOS>;
+            using class_weights_t = std::array<float, HAND_CLASSES_NUMBER>;
+
+            // Every combo equally likely
+            Range();
+
+            [[nodiscard]] auto getWeight(int32_t combo) const -> float { return _weights.at(combo); }
+            [[nodiscard]] auto getWeight(const Hand& hand) const -> float;
+            [[nodiscard]] auto getWeights() const -> const weights_t& { return _weights; }
+            // The weight of each hand class, the sum of its combos weight
+            [[nodiscard]] auto getClassWeights() const -> class_weights_t;
+
+            // Multiply each combo weight by its likelihood then normalize the weights
+            auto update(const weights_t& likelihoods) -> void;
+            // Remove the combos holding the card, it is known to be somewhere else
+            auto removeCard(const Card& card) -> void;
+
+            [[nodiscard]] static auto cardIndex(const Card& card) -> int32_t;
+            [[nodiscard]] static auto comboIndex(const Card& first, const Card& second) -> int32_t;
+            [[nodiscard]] static auto comboIndex(int32_t firstCard, int32_t secondCard) -> int32_t;
+            [[nodiscard]] static auto comboCards(int32_t combo) -> std::array<int32_t, 2>;  // The cards index, lowest first
+            /**
+             * The class of a hand in a 13x13 grid by ranks from 2 to ace: row * 13 + column with the higher rank as row for the
+             * suited hands and as column for the off-suit ones, the pairs are on the diagonal.
+             */
+            [[nodiscard]] static auto classIndex(Card::Rank firstRank, Card::Rank secondRank, bool suited) -> int32_t;
+            [[nodiscard]] static auto comboClass(int32_t combo) -> int32_t;
+
+        private:
+            alignas(COMBO_LANES * sizeof(float)) weights_t _weights {};
+
+            auto _normalize() -> void;
+    };
+
+    /**
+     * @brief The likelihood of a hand class to play an action on a street, the probability model of the range updates.
+     *
+     * The tables are given by hand class and expanded by combo when they are set, so an update does not look up the classes.
+     * The default tables rank the hand classes by their Chen formula score: the strong hands bet and raise, the middle ones call
+     * and the weak ones fold or check. The post-flop defaults are flatter as the starting hand says less about the board strength.
+     */
+    class ActionLikelihoods {
+        public:
+            using class_likelihoods_t = Range::class_weights_t;
+
+            static constexpr int32_t ACTIONS_NUMBER = 5;     // CHECK, CALL, BET, RAISE and FOLD, the recorded actions
+            static constexpr float   MIN_LIKELIHOOD = 0.02;  // No combo is ruled out by the actions alone
+
+            ActionLikelihoods();
+
+            [[nodiscard]] auto get(Round::Street street, RoundAction::ActionType action) const -> const Range::weights_t&;
+
+            auto set(Round::Street street, RoundAction::ActionType action, const class_likelihoods_t& likelihoods) -> void;
+
+            // The preflop strength of each hand class in [0, 1], its Chen score percentile over the 1326 combos
+            [[nodiscard]] static auto classStrengths() -> class_likelihoods_t;
+
+        private:
+            std::vector<Range::weights_t> _tables;  // By street then by action
+
+            [[nodiscard]] static auto _tableIndex(Round::Street street, RoundAction::ActionType action) -> std::size_t;
+    };
+
+    /**
+     * @brief Live range of each villain of a round, narrowed on each of their actions.
+     *
+     * `track` resets the ranges and registers the tracker as the round action listener. Each villain action multiplies the villain
+     * range by the likelihood table of the action, and the hero and board cards are removed from every range once known. An
+     * update is a few passes over 1326 floats, a few microseconds.
+     */
+    class RangeTracker {
+        public:
+            explicit RangeTracker(ActionLikelihoods likelihoods = ActionLikelihoods())
+              : _likelihoods(std::move(likelihoods)) {}
+
+            [[nodiscard]] auto isTracked(int32_t playerNum) const -> bool;
+            [[nodiscard]] auto getRange(int32_t playerNum) const -> const Range&;
+            [[nodiscard]] auto getLikelihoods() -> ActionLikelihoods& { return _likelihoods; }
+
+            // Reset the ranges from the round and update them on each action played in the round, the tracker must outlive it
+            auto track(Round& round) -> void;
+            auto reset(const Round& round) -> void;
+            auto update(const Round& round, const RoundAction& action) -> void;
+
+        private:
+            ActionLikelihoods                         _likelihoods;
+            std::array<Range, GameHandler::MAX_SEATS> _ranges;
+            std::array<bool, GameHandler::MAX_SEATS>  _tracked {};       // By player number - 1, the villains dealt in the round
+            std::array<bool, DECK_CARDS_NUMBER>       _removedCards {};  // The known cards already removed from the ranges
+
+            auto _removeCard(const Card& card) -> void;
+    };
+}  // namespace Analytics
@@ -0,0 +1,267 @@
+#include "analytics/EquityTable.hpp"
+
+#include <bit>
+#include <fstream>
+#include <random>
+
+#include <hand_history/Batch.hpp>
+
+namespace Analytics {
+    using fmt::format;
+    using GameHandler::RANK_CARDS_NUMBER;
+    using GameHandler::SUIT_CARDS_NUMBER;
+    using HandHistory::parallelFor;
+
+    namespace {
+        using score_t     = uint32_t;
+        using rank_mask_t = uint32_t;  // Bit n set for the rank n, from 0 for a two
+
+        enum Category : score_t { HIGH_CARD = 0, PAIR, TWO_PAIR, TRIPS, STRAIGHT, FLUSH, FULL, QUADS, STRAIGHT_FLUSH };
+
+        constexpr int32_t     HAND_CARDS_NUMBER = 7;
+        constexpr int32_t     KICKER_BITS       = 4;
+        constexpr int32_t     CATEGORY_SHIFT    = 5 * KICKER_BITS;
+        constexpr rank_mask_t STRAIGHT_MASK     = 0b1'1111;
+        constexpr int32_t     ACE_RANK          = RANK_CARDS_NUMBER - 1;
+
+        // The category then up to 5 ranks from the most significant, so two hands compare on their score
+        auto score(Category category, std::initializer_list<int32_t> ranks) -> score_t {
+            auto    value = static_cast<score_t>(category) << CATEGORY_SHIFT;
+            int32_t shift = CATEGORY_SHIFT;
+
+            for (auto rank : ranks) { value |= static_cast<score_t>(rank) << (shift -= KICKER_BITS); }
+
+            return value;
+        }
+
+        // The high card of the best straight in the mask plus one, so the wheel is 4, or 0 without straight
+        auto straightHigh(rank_mask_t mask) -> int32_t {
+            auto withLowAce = (mask << 1) | ((mask >> ACE_RANK) & 1);
+
+            for (int32_t high = RANK_CARDS_NUMBER; high >= 4; --high) {
+                auto straight = STRAIGHT_MASK << (high - 4);
+
+                if ((withLowAce & straight) == straight) { return high; }
+            }
+
+            return 0;
+        }
+
+        // Remove and return the highest rank of the mask
+        auto popHighest(rank_mask_t& mask) -> int32_t {
+            auto rank = std::bit_width(mask) - 1;
+
+            mask &= ~(1U << rank);
+
+            return static_cast<int32_t>(rank);
+        }
+
+        auto evaluate(const std::array<EquityTable::card_t, HAND_CARDS_NUMBER>& cards) -> score_t {
+            std::array<int32_t, RANK_CARDS_NUMBER>     rankCounts {};
+            std::array<rank_mask_t, SUIT_CARDS_NUMBER> suitMasks {};
+            rank_mask_t                                mask = 0;
+
+            for (auto card : cards) {
+                auto rank = card / SUIT_CARDS_NUMBER;
+
+                rankCounts[rank]++;
+                suitMasks[card % SUIT_CARDS_NUMBER] |= 1U << rank;
+                mask |= 1U << rank;
+            }
+
+            for (auto suitMask : suitMasks) {
+                if (std::popcount(suitMask) < 5) { continue; }
+
+                if (auto high = straightHigh(suitMask); high != 0) { return score(STRAIGHT_FLUSH, {high}); }
+
+                auto flush = suitMask;
+
+                return score(FLUSH, {popHighest(flush), popHighest(flush), popHighest(flush), popHighest(flush), popHighest(flush)});
+            }
+
+            int32_t quads = -1, trips = -1, secondTrips = -1, pair = -1, secondPair = -1;
+            // From the highest rank so the first trips or pair found is the best one
+            for (int32_t rank = ACE_RANK; rank >= 0; --rank) {
+                if (rankCounts[rank] == 4) {
+                    quads = rank;
+                } else if (rankCounts[rank] == 3 && trips == -1) {
+                    trips = rank;
+                } else if (rankCounts[rank] == 3) {
+                    secondTrips = rank;
+                } else if (rankCounts[rank] == 2) {
+                    if (pair == -1) {
+                        pair = rank;
+                    } else if (secondPair == -1) {
+                        secondPair = rank;
+                    }
+                }
+            }
+
+            auto without = [&](std::initializer_list<int32_t> ranks) {
+                auto kickers = mask;
+
+                for (auto rank : ranks) { kickers &= ~(1U << rank); }
+
+                return kickers;
+            };
+
+            if (quads != -1) {
+                auto kickers = without({quads});
+
+                return score(QUADS, {quads, popHighest(kickers)});
+            }
+
+            if (trips != -1 && (secondTrips != -1 || pair != -1)) { return score(FULL, {trips, std::max(secondTrips, pair)}); }
+            if (auto high = straightHigh(mask); high != 0) { return score(STRAIGHT, {high}); }
+
+            if (trips != -1) {
+                auto kickers = without({trips});
+
+                return score(TRIPS, {trips, popHighest(kickers), popHighest(kickers)});
+            }
+
+            if (secondPair != -1) {
+                auto kickers = without({pair, secondPair});
+
+                return score(TWO_PAIR, {pair, secondPair, popHighest(kickers)});
+            }
+
+            if (pair != -1) {
+                auto kickers = without({pair});
+
+                return score(PAIR, {pair, popHighest(kickers), popHighest(kickers), popHighest(kickers)});
+            }
+
+            auto kickers = mask;
+
+            return score(HIGH_CARD,
+                         {popHighest(kickers), popHighest(kickers), popHighest(kickers), popHighest(kickers), popHighest(kickers)});
+        }
+
+        // The combos of each hand class
+        auto classCombos() -> const std::array<std::vector<int32_t>, HAND_CLASSES_NUMBER>& {
+            static const auto CLASS_COMBOS = [] {
+                std::array<std::vector<int32_t>, HAND_CLASSES_NUMBER> combos;
+
+                for (int32_t combo = 0; combo < COMBOS_NUMBER; ++combo) { combos.at(Range::comboClass(combo)).push_back(combo); }
+
+                return combos;
+            }();
+
+            return CLASS_COMBOS;
+        }
+    }  // namespace
+
+    auto EquityTable::getEquity(int32_t heroClass, int32_t villainClass) const -> float {
+        return _equities.at(static_cast<std::size_t>(heroClass * HAND_CLASSES_NUMBER + villainClass));
+    }
+
+    auto EquityTable::getEquity(int32_t heroClass, const Range::class_weights_t& villainClasses) const -> double {
+        double equity = 0;
+        double total  = 0;
+
+        for (int32_t villainClass = 0; villainClass < HAND_CLASSES_NUMBER; ++villainClass) {
+            equity += villainClasses.at(villainClass) * getEquity(heroClass, villainClass);
+            total  += villainClasses.at(villainClass);
+        }
+
+        return total > 0 ? equity / total : 0.5;
+    }
+
+    auto EquityTable::save(const std::filesystem::path& path) const -> void {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) { throw std::runtime_error(format("Cannot open the equity table file {}", path.string())); }
+
+        file.write(EQUITY_TABLE_MAGIC.data(), EQUITY_TABLE_MAGIC.size());
+        file.write(reinterpret_cast<const char*>(&EQUITY_TABLE_VERSION), sizeof(EQUITY_TABLE_VERSION));
+        file.write(reinterpret_cast<const char*>(&_samplesNumber), sizeof(_samplesNumber));
+        file.write(reinterpret_cast<const char*>(_equities.data()), static_cast<std::streamsize>(_equities.size() * sizeof(float)));
+    }
+
+    auto EquityTable::load(const std::filesystem::path& path) -> EquityTable {
+        std::ifstream       file(path, std::ios::binary);
+        std::array<char, 4> magic {};
+        uint32_t            version = 0;
+        EquityTable         table;
+
+        if (!file.is_open()) { throw std::runtime_error(format("Cannot open the equity table file {}", path.string())); }
+
+        file.read(magic.data(), magic.size());
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+        if (!file || magic != EQUITY_TABLE_MAGIC) { throw invalid_equity_table("The file is not an equity table"); }
+        if (version != EQUITY_TABLE_VERSION) { throw invalid_equity_table(format("Unsupported equity table version {}", version)); }
+
+        auto equitiesSize = static_cast<std::streamsize>(table._equities.size() * sizeof(float));
+
+        file.read(reinterpret_cast<char*>(&table._samplesNumber), sizeof(table._samplesNumber));
+        file.read(reinterpret_cast<char*>(table._equities.data()), equitiesSize);
+
+        if (!file) { throw invalid_equity_table("Truncated equity table"); }
+
+        return table;
+    }
+
+    /**
+     * @brief Sample the showdowns of each classes pair, a random combo of each class that do not share a card on a random board.
+     *
+     * Only the pairs with the row class below the column class are sampled, the other equities are their complement and a class
+     * against itself is even. Each pair has its own generator seeded from its index, so the table does not depend on the threads
+     * number.
+     */
+    auto EquityTable::compute(int32_t samplesNumber, std::size_t threadsNumber, uint64_t seed) -> EquityTable {
+        EquityTable table;
+
+        table._samplesNumber = samplesNumber;
+
+        parallelFor(static_cast<std::size_t>(HAND_CLASSES_NUMBER), threadsNumber, [&](std::size_t heroClass) {
+            const auto& heroCombos = classCombos().at(heroClass);
+
+            for (auto villainClass = static_cast<int32_t>(heroClass) + 1; villainClass < HAND_CLASSES_NUMBER; ++villainClass) {
+                const auto&     villainCombos = classCombos().at(villainClass);
+                std::mt19937_64 generator(seed ^ (heroClass * HAND_CLASSES_NUMBER + villainClass));
+                double          share = 0;
+
+                for (int32_t sample = 0; sample < samplesNumber; ++sample) {
+                    auto     hero    = Range::comboCards(heroCombos[generator() % heroCombos.size()]);
+                    auto     villain = Range::comboCards(villainCombos[generator() % villainCombos.size()]);
+                    uint64_t used    = (1ULL << hero[0]) | (1ULL << hero[1]);
+
+                    if ((used & ((1ULL << villain[0]) | (1ULL << villain[1]))) != 0) {
+                        --sample;  // The combos share a card, draw again
+                        continue;
+                    }
+
+                    used |= (1ULL << villain[0]) | (1ULL << villain[1]);
+
+                    board_t board {};
+
+                    for (auto& card : board) {
+                        do { card = static_cast<card_t>(generator() % DECK_CARDS_NUMBER); } while ((used & (1ULL << card)) != 0);
+
+                        used |= 1ULL << card;
+                    }
+
+                    share += showdown(hero, villain, board);
+                }
+
+                auto equity = static_cast<float>(share / samplesNumber);
+
+                table._equities[villainClass * HAND_CLASSES_NUMBER + heroClass] = 1 - equity;
+                table._equities[heroClass * HAND_CLASSES_NUMBER + villainClass] = equity;
+            }
+        });
+
+        return table;
+    }
+
+    auto EquityTable::showdown(std::array<card_t, 2> first, std::array<card_t, 2> second, const board_t& board) -> double {
+        auto firstScore  = evaluate({first[0], first[1], board[0], board[1], board[2], board[3], board[4]});
+        auto secondScore = evaluate({second[0], second[1], board[0], board[1], board[2], board[3], board[4]});
+
+        if (firstScore == secondScore) { return 0.5; }
+
+        return firstScore > secondScore ? 1 : 0;
+    }
+}  // namespace Analytics
@@ -0,0 +1,201 @@
+#include "analytics/HudAggregator.hpp"
+
+#include <hand_history/Batch.hpp>
+
+namespace Analytics {
+    using GameHandler::MAX_SEATS;
+    using GameHandler::Position;
+    using GameHandler::Seat;
+
+    using enum GameHandler::RoundAction::ActionType;
+
+    namespace {
+        // What a seat did in the round, filled while reading the actions
+        struct SeatState {
+            public:
+                bool    dealt               = false;
+                bool    actedPreflop        = false;
+                bool    foldedPreflop       = false;
+                bool    vpip                = false;
+                bool    pfr                 = false;
+                bool    threeBetChance      = false;
+                bool    threeBet            = false;
+                bool    faceSteal           = false;
+                bool    foldToSteal         = false;
+                bool    wonAtShowdown       = false;
+                int32_t postflopAggressions = 0;
+                int32_t postflopCalls       = 0;
+        };
+
+        auto isAggressive(GameHandler::ActionType action) -> bool { return action == BET || action == RAISE; }
+
+        // In heads-up the dealer is the small blind, a raise from the dealer is then a steal against the big blind only
+        auto isStealPosition(Position position, bool headsUp) -> bool {
+            return position == GameHandler::DEALER || position == GameHandler::CUTOFF || (!headsUp && position == GameHandler::SMALL_BLIND);
+        }
+
+        auto isBlindPosition(Position position, bool headsUp) -> bool {
+            return position == GameHandler::BIG_BLIND || (!headsUp && position == GameHandler::SMALL_BLIND);
+        }
+    }  // namespace
+
+    auto HudAggregator::getStats(std::string_view playerName) const -> PlayerStats {
+        auto stats = _stats.find(playerName);
+
+        return stats == _stats.end() ? PlayerStats() : stats->second;
+    }
+
+    /**
+     * @brief Add the ended round actions to the stats of each player dealt in the round.
+     *
+     * The blinds are not part of the actions, so the first pre-flop raise is the open raise and the second one is a 3-bet.
+     */
+    auto HudAggregator::addRound(const Round& round, const Game& game) -> void {
+        if (round.isInProgress()) { throw std::invalid_argument("Only the ended rounds can be added to the stats"); }
+
+        std::array<SeatState, MAX_SEATS> states {};
+
+        const auto& seats   = round.getSeats();
+        const auto& actions = round.getActions();
+
+        auto state = [&states](int32_t playerNum) -> SeatState& { return states.at(static_cast<std::size_t>(playerNum - 1)); };
+
+        int32_t dealtNumber = 0;
+
+        // The players busted in this round are already marked as eliminated, only the ones eliminated before have no stack
+        for (const auto& seat : seats) {
+            if (seat.initialStack > 0) {
+                state(seat.number).dealt = true;
+                ++dealtNumber;
+            }
+        }
+
+        auto headsUp       = dealtNumber == 2;
+        auto raisesNumber  = 0;
+        auto openRaiserNum = 0;
+        auto onlyFolds     = true;  // No player entered the pot yet
+        auto stealPending  = false;
+
+        for (const auto& action : actions.at(Round::PREFLOP)) {
+            auto        playerNum  = action.getPlayerNum();
+            auto        actionType = action.getAction();
+            auto&       seatState  = state(playerNum);
+            const auto& seat       = seats.at(playerNum);
+
+            if (!seatState.actedPreflop) {
+                seatState.actedPreflop = true;
+
+                if (stealPending && isBlindPosition(seat.position, headsUp)) {
+                    seatState.faceSteal   = true;
+                    seatState.foldToSteal = actionType == FOLD;
+                }
+            }
+
+            if (raisesNumber == 1 && !seatState.threeBetChance && playerNum != openRaiserNum) {
+                seatState.threeBetChance = true;
+                seatState.threeBet       = isAggressive(actionType);
+            }
+
+            if (actionType == FOLD) {
+                seatState.foldedPreflop = true;
+                continue;
+            }
+
+            if (actionType == CALL || isAggressive(actionType)) { seatState.vpip = true; }
+
+            if (isAggressive(actionType)) {
+                seatState.pfr = true;
+                stealPending  = onlyFolds && isStealPosition(seat.position, headsUp);
+
+                if (++raisesNumber == 1) { openRaiserNum = playerNum; }
+            } else if (actionType == CALL) {
+                stealPending = false;
+            }
+
+            onlyFolds = false;
+        }
+
+        for (auto street : {Round::FLOP, Round::TURN, Round::RIVER}) {
+            for (const auto& action : actions.at(street)) {
+                if (isAggressive(action.getAction())) { ++state(action.getPlayerNum()).postflopAggressions; }
+                if (action.getAction() == CALL) { ++state(action.getPlayerNum()).postflopCalls; }
+            }
+        }
+
+        for (const auto& pot : round.getPots()) {
+            for (auto winnerNum : pot.winnersNum) { state(winnerNum).wonAtShowdown = true; }
+        }
+
+        auto flopPlayersNumber     = std::ranges::count_if(states, [](const SeatState& s) { return s.dealt && !s.foldedPreflop; });
+        auto showdownPlayersNumber = std::ranges::count_if(seats, [](const Seat& seat) { return seat.inRound; });
+
+        for (const auto& seat : seats) {
+            const auto& seatState = state(seat.number);
+
+            if (!seatState.dealt) { continue; }
+
+            auto& stats    = _getOrCreate(game.getPlayer(seat.number).getName());
+            auto  bucket   = PlayerStats::depthBucket(seat.initialStack, round.getBlinds().BB());
+            auto  sawFlop  = !seatState.foldedPreflop && flopPlayersNumber > 1;
+            auto  showdown = seat.inRound && showdownPlayersNumber > 1;
+
+            stats.hands                 += 1;
+            stats.vpip                  += seatState.vpip ? 1 : 0;
+            stats.pfr                   += seatState.pfr ? 1 : 0;
+            stats.threeBetOpportunities += seatState.threeBetChance ? 1 : 0;
+            stats.threeBets             += seatState.threeBet ? 1 : 0;
+            stats.stealsFaced           += seatState.faceSteal ? 1 : 0;
+            stats.foldsToSteal          += seatState.foldToSteal ? 1 : 0;
+            stats.postflopAggressions   += static_cast<uint32_t>(seatState.postflopAggressions);
+            stats.postflopCalls         += static_cast<uint32_t>(seatState.postflopCalls);
+            stats.sawFlop               += sawFlop ? 1 : 0;
+            stats.wentToShowdown        += showdown ? 1 : 0;
+            stats.wonAtShowdown         += showdown && seatState.wonAtShowdown ? 1 : 0;
+            stats.handsByDepth[bucket]  += 1;
+            stats.allInsByDepth[bucket] += seat.isAllIn ? 1 : 0;
+        }
+    }
+
+    auto HudAggregator::addGame(const Game& game) -> void {
+        game.forEachRound([this, &game](const Round& round) {
+            if (!round.isInProgress()) { addRound(round, game); }
+        });
+    }
+
+    auto HudAggregator::merge(const HudAggregator& other) -> void {
+        for (const auto& [playerName, stats] : other._stats) { _getOrCreate(playerName) += stats; }
+    }
+
+    auto HudAggregator::toJson() const -> json {
+        json players = json::object();
+
+        for (const auto& [playerName, stats] : _stats) { players[playerName] = stats.toJson(); }
+
+        return players;
+    }
+
+    auto HudAggregator::backfill(std::span<const Game> games, std::size_t threadsNumber) -> HudAggregator {
+        auto                       chunksNumber = std::clamp<std::size_t>(threadsNumber, 1, std::max<std::size_t>(1, games.size()));
+        auto                       chunkSize    = (games.size() + chunksNumber - 1) / chunksNumber;
+        std::vector<HudAggregator> partials(chunksNumber);
+
+        HandHistory::parallelFor(chunksNumber, chunksNumber, [&](std::size_t chunk) {
+            auto first = std::min(chunk * chunkSize, games.size());
+            auto last  = std::min(first + chunkSize, games.size());
+
+            for (const auto& game : games.subspan(first, last - first)) { partials[chunk].addGame(game); }
+        });
+
+        for (std::size_t chunk = 1; chunk < chunksNumber; ++chunk) { partials.front().merge(partials[chunk]); }
+
+        return std::move(partials.front());
+    }
+
+    auto HudAggregator::_getOrCreate(std::string_view playerName) -> PlayerStats& {
+        auto stats = _stats.find(playerName);
+
+        if (stats == _stats.end()) { stats = _stats.emplace(playerName, PlayerStats()).first; }
+
+        return stats->second;
+    }
+}  // namespace Analytics
@@ -0,0 +1,368 @@
+#include "analytics/OpponentDatabase.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+
+    #include <windows.h>
+
+#else
+
+    #include <fcntl.h>
+    #include <sys/file.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+#endif
+
+namespace Analytics {
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+
+    static constexpr int32_t     RECORD_NUMBER_BITS = 40;
+    static constexpr uint64_t    RECORD_NUMBER_MASK = (uint64_t {1} << RECORD_NUMBER_BITS) - 1;
+    static constexpr std::size_t SECTION_ALIGNMENT  = 64;
+
+    struct OpponentDatabase::Header {
+        public:
+            std::array<char, 4> magic;
+            uint32_t            version;
+            uint64_t            slotsNumber;
+            uint64_t            recordsCapacity;
+            uint64_t            namesCapacity;
+            uint64_t            recordsNumber;  // Published by the writer after the record is written
+            uint64_t            namesSize;
+    };
+
+    struct OpponentDatabase::Record {
+        public:
+            uint32_t    sequence;  // Odd while the writer updates the stats
+            uint32_t    nameSize;
+            uint64_t    nameOffset;
+            PlayerStats stats;
+    };
+
+    namespace {
+        auto align(std::size_t size) -> std::size_t { return (size + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT; }
+        // Twice more slots than opponents so the probe sequences stay short
+        auto slotsNumber(std::size_t capacity) -> std::size_t { return std::bit_ceil(std::max<std::size_t>(2, capacity * 2)); }
+    }  // namespace
+
+    OpponentDatabase::OpponentDatabase(const std::filesystem::path& path, Mode mode, std::size_t capacity)
+      : _mode(mode) {
+        auto create = mode == Mode::READ_WRITE && (!std::filesystem::exists(path) || std::filesystem::file_size(path) == 0);
+
+        if (create && (capacity == 0 || capacity > RECORD_NUMBER_MASK)) {
+            throw std::invalid_argument("Invalid opponent database capacity");
+        }
+        // Only the writer holding the lock initializes the file, another one may have created it since the check
+        create = _map(path, create ? _fileSize(capacity) : 0);
+
+        try {
+            if (create) { _initialize(capacity); }
+
+            _checkHeader();
+
+            if (mode == Mode::READ_WRITE) { _resetInterruptedUpdates(); }
+        } catch (...) {
+            _unmap();
+            throw;
+        }
+    }
+
+    OpponentDatabase::~OpponentDatabase() { _unmap(); }
+
+    auto OpponentDatabase::size() const -> std::size_t { return std::atomic_ref(_header->recordsNumber).load(memory_order_acquire); }
+    auto OpponentDatabase::getCapacity() const -> std::size_t { return _header->recordsCapacity; }
+
+    auto OpponentDatabase::find(std::string_view playerName) const -> std::optional<PlayerStats> {
+        auto slot = std::atomic_ref(*_findSlot(playerName, _hash(playerName))).load(memory_order_acquire);
+
+        if (slot == 0) { return std::nullopt; }
+
+        auto&                     record = _records[(slot & RECORD_NUMBER_MASK) - 1];
+        std::atomic_ref<uint32_t> sequence(record.sequence);
+        PlayerStats               stats;
+        // Copy the stats again if the writer updated them during the copy
+        for (int32_t retry = 0; retry < MAX_READ_RETRIES; ++retry) {
+            auto before = sequence.load(memory_order_acquire);
+
+            if ((before & 1) != 0) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::memcpy(&stats, &record.stats, sizeof(PlayerStats));
+            std::atomic_thread_fence(memory_order_acquire);
+
+            if (sequence.load(memory_order_relaxed) == before) { return stats; }
+        }
+        // The sequence of a writer stopped during an update stays odd until the next writer opens the database
+        return std::nullopt;
+    }
+
+    auto OpponentDatabase::add(std::string_view playerName, const PlayerStats& stats) -> void {
+        if (_mode == Mode::READ_ONLY) { throw invalid_opponent_database("The opponent database is opened in read only mode"); }
+
+        auto                      hash = _hash(playerName);
+        std::atomic_ref<uint64_t> slot(*_findSlot(playerName, hash));
+
+        if (auto slotValue = slot.load(memory_order_relaxed); slotValue != 0) {
+            auto&                     record = _records[(slotValue & RECORD_NUMBER_MASK) - 1];
+            std::atomic_ref<uint32_t> sequence(record.sequence);
+            auto                      current = sequence.load(memory_order_relaxed);
+
+            sequence.store(current + 1, memory_order_relaxed);
+            std::atomic_thread_fence(memory_order_release);
+            record.stats += stats;
+            sequence.store(current + 2, memory_order_release);
+
+            return;
+        }
+
+        auto recordsNumber = _header->recordsNumber;
+        auto namesSize     = _header->namesSize;
+
+        if (recordsNumber == _header->recordsCapacity || namesSize + playerName.size() > _header->namesCapacity) {
+            throw invalid_opponent_database("The opponent database is full");
+        }
+        // The record and its name are written before the slot is published to the readers
+        std::memcpy(_names + namesSize, playerName.data(), playerName.size());
+        _records[recordsNumber] = {0, static_cast<uint32_t>(playerName.size()), namesSize, stats};
+
+        std::atomic_ref(_header->namesSize).store(namesSize + playerName.size(), memory_order_release);
+        std::atomic_ref(_header->recordsNumber).store(recordsNumber + 1, memory_order_release);
+        slot.store((hash & ~RECORD_NUMBER_MASK) | (recordsNumber + 1), memory_order_release);
+    }
+
+    auto OpponentDatabase::add(const HudAggregator& hud) -> void {
+        hud.forEachPlayer([this](std::string_view playerName, const PlayerStats& stats) { add(playerName, stats); });
+    }
+
+    // FNV-1a, the hash is stored in the file so it must not depend on the standard library implementation
+    auto OpponentDatabase::_hash(std::string_view playerName) -> uint64_t {
+        static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        static constexpr uint64_t FNV_PRIME        = 1099511628211ULL;
+        static constexpr int32_t  HALF_BITS        = 32;
+
+        uint64_t hash = FNV_OFFSET_BASIS;
+
+        for (auto character : playerName) {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= FNV_PRIME;
+        }
+
+        return hash ^ (hash >> HALF_BITS);  // Mix the high bits into the low bits used for the slot index
+    }
+
+    auto OpponentDatabase::_fileSize(std::size_t capacity) -> std::size_t {
+        return align(sizeof(Header)) + align(slotsNumber(capacity) * sizeof(uint64_t)) + align(capacity * sizeof(Record))
+             + capacity * AVERAGE_NAME_SIZE;
+    }
+
+    // The slot holding the player or the empty slot ending its probe sequence
+    auto OpponentDatabase::_findSlot(std::string_view playerName, uint64_t hash) const -> uint64_t* {
+        auto mask = _header->slotsNumber - 1;
+        auto tag  = hash & ~RECORD_NUMBER_MASK;
+
+        for (auto index = hash & mask;; index = (index + 1) & mask) {
+            auto slot = std::atomic_ref(_slots[index]).load(memory_order_acquire);
+
+            if (slot == 0) { return &_slots[index]; }
+
+            if ((slot & ~RECORD_NUMBER_MASK) == tag && _name(_records[(slot & RECORD_NUMBER_MASK) - 1]) == playerName) {
+                return &_slots[index];
+            }
+        }
+    }
+
+    auto OpponentDatabase::_name(const Record& record) const -> std::string_view {
+        return {_names + record.nameOffset, record.nameSize};
+    }
+
+    auto OpponentDatabase::_initialize(std::size_t capacity) -> void {
+        _header = reinterpret_cast<Header*>(_data);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        *_header = {
+            OPPONENT_DATABASE_MAGIC, OPPONENT_DATABASE_VERSION, slotsNumber(capacity), capacity, capacity * AVERAGE_NAME_SIZE, 0, 0};
+    }
+
+    auto OpponentDatabase::_checkHeader() -> void {
+        if (_size < sizeof(Header)) { throw invalid_opponent_database("The file is not an opponent database"); }
+
+        _header = reinterpret_cast<Header*>(_data);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        if (_header->magic != OPPONENT_DATABASE_MAGIC) { throw invalid_opponent_database("The file is not an opponent database"); }
+
+        if (_header->version != OPPONENT_DATABASE_VERSION) {
+            throw invalid_opponent_database(fmt::format("Unsupported opponent database version {}", _header->version));
+        }
+
+        auto capacity = _header->recordsCapacity;
+
+        if (_header->slotsNumber != slotsNumber(capacity) || _header->namesCapacity != capacity * AVERAGE_NAME_SIZE
+            || _size < _fileSize(capacity)) {
+            throw invalid_opponent_database("Truncated opponent database");
+        }
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        _slots   = reinterpret_cast<uint64_t*>(_data + align(sizeof(Header)));
+        _records = reinterpret_cast<Record*>(_data + align(sizeof(Header)) + align(_header->slotsNumber * sizeof(uint64_t)));
+        _names   = reinterpret_cast<char*>(_records) + align(capacity * sizeof(Record));
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    auto OpponentDatabase::_resetInterruptedUpdates() -> void {
+        for (uint64_t recordNum = 0; recordNum < _header->recordsNumber; ++recordNum) {
+            std::atomic_ref<uint32_t> sequence(_records[recordNum].sequence);
+
+            if (auto value = sequence.load(memory_order_relaxed); (value & 1) != 0) {
+                sequence.store(value + 1, memory_order_release);
+            }
+        }
+    }
+
+#ifdef _WIN32
+
+    auto OpponentDatabase::_map(const std::filesystem::path& path, std::size_t createSize) -> bool {
+        auto   readOnly = _mode == Mode::READ_ONLY;
+        HANDLE file     = CreateFileW(path.c_str(),
+                                  readOnly ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                  nullptr,
+                                  readOnly ? OPEN_EXISTING : OPEN_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error(fmt::format("Cannot open the opponent database {}", path.string()));
+        }
+        // The locked byte is past any file end so the mapped views are not blocked by the lock
+        OVERLAPPED lockOffset = {};
+
+        lockOffset.Offset     = MAXDWORD;
+        lockOffset.OffsetHigh = MAXDWORD;
+
+        if (!readOnly && !LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &lockOffset)) {
+            CloseHandle(file);
+            throw opponent_database_locked("The opponent database is already opened for writing");
+        }
+
+        LARGE_INTEGER fileSize;
+
+        if (!GetFileSizeEx(file, &fileSize)) { fileSize.QuadPart = 0; }
+
+        auto created = fileSize.QuadPart == 0 && createSize > 0;
+        // The mapping extends the new file to its size
+        if (fileSize.QuadPart == 0) { fileSize.QuadPart = static_cast<LONGLONG>(createSize); }
+
+        if (fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            throw invalid_opponent_database("The file is not an opponent database");
+        }
+
+        _mapping = CreateFileMappingW(
+            file, nullptr, readOnly ? PAGE_READONLY : PAGE_READWRITE, fileSize.HighPart, fileSize.LowPart, nullptr);
+        // The writer keeps its file opened until it is destroyed to hold the lock
+        if (readOnly) {
+            CloseHandle(file);
+        } else {
+            _file = reinterpret_cast<intptr_t>(file);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+
+        if (_mapping == nullptr) {
+            _unmap();
+            throw std::runtime_error(fmt::format("Cannot map the opponent database {}", path.string()));
+        }
+
+        _data = static_cast<uint8_t*>(MapViewOfFile(_mapping, readOnly ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0));
+        _size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        if (_data == nullptr) {
+            _unmap();
+            throw std::runtime_error(fmt::format("Cannot map the opponent database {}", path.string()));
+        }
+
+        return created;
+    }
+
+    auto OpponentDatabase::_unmap() -> void {
+        if (_data != nullptr) { UnmapViewOfFile(_data); }
+        if (_mapping != nullptr) { CloseHandle(_mapping); }
+        if (_file != -1) { CloseHandle(reinterpret_cast<HANDLE>(_file)); }  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        _data    = nullptr;
+        _mapping = nullptr;
+        _file    = -1;
+    }
+
+    auto OpponentDatabase::flush() -> void { FlushViewOfFile(_data, 0); }
+
+#else
+
+    auto OpponentDatabase::_map(const std::filesystem::path& path, std::size_t createSize) -> bool {
+        static constexpr mode_t FILE_PERMISSIONS = 0644;
+
+        auto readOnly = _mode == Mode::READ_ONLY;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+        auto file     = open(path.c_str(), readOnly ? O_RDONLY : O_RDWR | O_CREAT, FILE_PERMISSIONS);
+
+        if (file == -1) { throw std::runtime_error(fmt::format("Cannot open the opponent database {}", path.string())); }
+
+        if (!readOnly && flock(file, LOCK_EX | LOCK_NB) == -1) {
+            close(file);
+            throw opponent_database_locked("The opponent database is already opened for writing");
+        }
+
+        struct stat fileStat {};
+        auto        created = false;
+
+        if (fstat(file, &fileStat) == -1) { fileStat.st_size = 0; }
+        // Sparse file, the pages are only allocated when they are written
+        if (fileStat.st_size == 0 && createSize > 0 && ftruncate(file, static_cast<off_t>(createSize)) == 0) {
+            fileStat.st_size = static_cast<off_t>(createSize);
+            created          = true;
+        }
+
+        if (fileStat.st_size == 0) {
+            close(file);
+            throw invalid_opponent_database("The file is not an opponent database");
+        }
+
+        _size    = static_cast<std::size_t>(fileStat.st_size);
+        _mapping = mmap(nullptr, _size, readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        // The writer keeps its file opened until it is destroyed to hold the lock
+        if (readOnly) {
+            close(file);
+        } else {
+            _file = file;
+        }
+
+        if (_mapping == MAP_FAILED) {
+            _mapping = nullptr;
+            _unmap();
+            throw std::runtime_error(fmt::format("Cannot map the opponent database {}", path.string()));
+        }
+
+        _data = static_cast<uint8_t*>(_mapping);
+
+        return created;
+    }
+
+    auto OpponentDatabase::_unmap() -> void {
+        if (_mapping != nullptr) { munmap(_mapping, _size); }
+        if (_file != -1) { close(static_cast<int>(_file)); }
+
+        _data    = nullptr;
+        _mapping = nullptr;
+        _file    = -1;
+    }
+
+    auto OpponentDatabase::flush() -> void { msync(_data, _size, MS_SYNC); }
+
+#endif
+}  // namespace Analytics
@@ -0,0 +1,55 @@
+#include "analytics/PlayerStats.hpp"
+
+#include <algorithm>
+
+namespace Analytics {
+    auto PlayerStats::operator+=(const PlayerStats& other) -> PlayerStats& {
+        hands                 += other.hands;
+        vpip                  += other.vpip;
+        pfr                   += other.pfr;
+        threeBetOpportunities += other.threeBetOpportunities;
+        threeBets             += other.threeBets;
+        stealsFaced           += other.stealsFaced;
+        foldsToSteal          += other.foldsToSteal;
+        postflopAggressions   += other.postflopAggressions;
+        postflopCalls         += other.postflopCalls;
+        sawFlop               += other.sawFlop;
+        wentToShowdown        += other.wentToShowdown;
+        wonAtShowdown         += other.wonAtShowdown;
+
+        for (std::size_t bucket = 0; bucket < STACK_DEPTH_BUCKETS; ++bucket) {
+            handsByDepth[bucket]  += other.handsByDepth[bucket];
+            allInsByDepth[bucket] += other.allInsByDepth[bucket];
+        }
+
+        return *this;
+    }
+
+    auto PlayerStats::depthBucket(int32_t stack, int32_t bigBlind) -> std::size_t {
+        if (bigBlind <= 0) { return STACK_DEPTH_BUCKETS - 1; }
+
+        auto depth = stack / bigBlind;
+
+        return static_cast<std::size_t>(std::ranges::count_if(STACK_DEPTH_BOUNDS, [depth](int32_t bound) { return depth >= bound; }));
+    }
+
+    auto PlayerStats::toJson() const -> json {
+        json allIns = json::array();
+
+        for (std::size_t bucket = 0; bucket < STACK_DEPTH_BUCKETS; ++bucket) {
+            allIns.push_back({{"min_depth", bucket == 0 ? 0 : STACK_DEPTH_BOUNDS.at(bucket - 1)},
+                              {"hands", handsByDepth[bucket]},
+                              {"all_in", getAllIn(bucket)}});
+        }
+
+        return {{"hands", hands},
+                {"vpip", getVpip()},
+                {"pfr", getPfr()},
+                {"three_bet", getThreeBet()},
+                {"fold_to_steal", getFoldToSteal()},
+                {"af", getAf()},
+                {"wtsd", getWtsd()},
+                {"wsd", getWsd()},
+                {"all_in_by_depth", allIns}};
+    }
+}  // namespace Analytics
@@ -0,0 +1,384 @@
+#include "analytics/PushFoldAdvisor.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace Analytics {
+    using GameHandler::Seat;
+    using std::chrono::duration_cast;
+    using std::chrono::steady_clock;
+
+    using Action  = PushFoldAdvice::Action;
+    using Quality = PushFoldAdvice::Quality;
+
+    namespace {
+        using stacks_t = std::vector<int32_t>;  // By player number - 1
+
+        constexpr double   PUSH_RANGE_BIG_BLINDS = 6;     // The hero pushes the strongest 6 / stack in big blinds of the hands
+        constexpr double   MIN_PUSH_RANGE        = 0.15;  // The share of the hands the hero pushes deep stacked
+        constexpr double   EQUITY_BY_STRENGTH    = 0.4;   // The equity gained from the weakest to the strongest class
+        constexpr uint64_t SIMULATION_SEED       = 0;
+
+        // A villain who can contest the pot and its range when it does
+        struct Contender {
+                int32_t playerNum   = 0;
+                double  probability = 1;    // Of playing the pot, to call the push or to have pushed
+                double  equity      = 0.5;  // Of the hero against the contender range
+                Range   range;
+        };
+
+        auto classStrengths() -> const Range::class_weights_t& {
+            static const auto STRENGTHS = ActionLikelihoods::classStrengths();
+
+            return STRENGTHS;
+        }
+
+        // The weight of each class in a full range, 6 pairs, 4 suited or 12 off-suit combos
+        auto classCombosNumber() -> const Range::class_weights_t& {
+            static const auto COMBOS_NUMBER_BY_CLASS = [] {
+                Range::class_weights_t combos {};
+
+                for (int32_t combo = 0; combo < COMBOS_NUMBER; ++combo) { combos.at(Range::comboClass(combo)) += 1; }
+
+                return combos;
+            }();
+
+            return COMBOS_NUMBER_BY_CLASS;
+        }
+
+        // The strongest classes covering the share of the combos, weighted by their combos number
+        auto strongestClasses(double share) -> Range::class_weights_t {
+            Range::class_weights_t classes {};
+
+            for (int32_t handClass = 0; handClass < HAND_CLASSES_NUMBER; ++handClass) {
+                if (classStrengths().at(handClass) >= 1 - share) { classes.at(handClass) = classCombosNumber().at(handClass); }
+            }
+
+            return classes;
+        }
+
+        // The range keeping only the combos of the given classes
+        auto restrictRange(Range range, const Range::class_weights_t& classes) -> Range {
+            Range::weights_t likelihoods {};
+
+            for (int32_t combo = 0; combo < COMBOS_NUMBER; ++combo) {
+                likelihoods.at(combo) = classes.at(Range::comboClass(combo)) > 0 ? 1 : 0;
+            }
+
+            range.update(likelihoods);
+
+            return range;
+        }
+
+        // Class against class equities, from the table when loaded or from the classes strength
+        class ClassEquities {
+            public:
+                explicit ClassEquities(std::shared_ptr<const EquityTable> table)
+                  : _table(std::move(table)) {}
+
+                [[nodiscard]] auto hasTable() const -> bool { return _table != nullptr; }
+
+                [[nodiscard]] auto get(int32_t heroClass, int32_t villainClass) const -> double {
+                    if (_table) { return _table->getEquity(heroClass, villainClass); }
+
+                    return 0.5 + EQUITY_BY_STRENGTH * (classStrengths().at(heroClass) - classStrengths().at(villainClass));
+                }
+
+                [[nodiscard]] auto get(int32_t heroClass, const Range::class_weights_t& villainClasses) const -> double {
+                    if (_table) { return _table->getEquity(heroClass, villainClasses); }
+
+                    double equity = 0;
+                    double total  = 0;
+
+                    for (int32_t villainClass = 0; villainClass < HAND_CLASSES_NUMBER; ++villainClass) {
+                        equity += villainClasses.at(villainClass) * get(heroClass, villainClass);
+                        total  += villainClasses.at(villainClass);
+                    }
+
+                    return total > 0 ? equity / total : 0.5;
+                }
+
+            private:
+                std::shared_ptr<const EquityTable> _table;
+        };
+
+        // Draw combos of a range by their weight, the combos holding a hero card excluded
+        class ComboSampler {
+            public:
+                ComboSampler(const Range& range, uint64_t heroCards) {
+                    float total = 0;
+
+                    for (int32_t combo = 0; combo < COMBOS_NUMBER; ++combo) {
+                        auto cards = Range::comboCards(combo);
+
+                        if ((heroCards & ((1ULL << cards[0]) | (1ULL << cards[1]))) == 0) { total += range.getWeight(combo); }
+
+                        _cumulativeWeights.at(combo) = total;
+                    }
+                }
+
+                [[nodiscard]] auto isEmpty() const -> bool { return _cumulativeWeights.back() <= 0; }
+
+                auto draw(std::mt19937_64& generator) const -> int32_t {
+                    std::uniform_real_distribution<float> distribution(0, _cumulativeWeights.back());
+
+                    auto found = std::upper_bound(_cumulativeWeights.begin(), _cumulativeWeights.end(), distribution(generator));
+
+                    return static_cast<int32_t>(std::min<std::ptrdiff_t>(found - _cumulativeWeights.begin(), COMBOS_NUMBER - 1));
+                }
+
+            private:
+                std::array<float, COMBOS_NUMBER> _cumulativeWeights {};
+        };
+
+        // The hero ICM equity after the pot is won or lost against a contender who matched the hero bet
+        struct Showdown {
+                double win  = 0;
+                double lose = 0;
+        };
+
+        auto heroEv(const Showdown& showdown, double equity) -> double { return equity * showdown.win + (1 - equity) * showdown.lose; }
+    }  // namespace
+
+    /**
+     * @brief The hero EV of each action is the ICM equity of its stack after each outcome, weighted by the outcome probability.
+     *
+     * A fold gives the pot to the highest bettor. A call is a showdown against the pusher. A push wins the blinds when every
+     * villain folds, otherwise it is a showdown against the first villain to call, the villains behind being assumed to fold.
+     */
+    auto PushFoldAdvisor::advise(const Round& round, const Game& game, const RangeTracker* ranges, milliseconds budget) const
+        -> PushFoldAdvice {
+        auto           start    = steady_clock::now();
+        auto           deadline = start + budget - DEADLINE_MARGIN;
+        PushFoldAdvice advice;
+        const auto&    seats = round.getSeats();
+        auto           hand  = round.getPlayerHand(1);
+
+        const auto& hero = seats.at(1);
+
+        if (!round.isInProgress() || round.getCurrentStreet() != Round::PREFLOP || !hero.inRound || hero.isAllIn || !hand.isSet()) {
+            return advice;
+        }
+
+        int32_t highestBet   = 0;
+        int32_t aggressorNum = 0;
+
+        for (const auto& seat : seats) {
+            if (seat.number != 1 && seat.inRound && seat.totalStreetBet > highestBet) {
+                highestBet   = seat.totalStreetBet;
+                aggressorNum = seat.number;
+            }
+        }
+
+        auto toCall = std::min(highestBet - hero.totalStreetBet, hero.stack);
+        // The hero can check, the big blind option is not a push or fold spot
+        if (aggressorNum == 0 || toCall <= 0) { return advice; }
+
+        const auto&   aggressor = seats.at(aggressorNum);
+        auto          callSpot  = aggressor.isAllIn || hero.stack <= toCall;
+        auto          pot       = round.getPot();
+        auto          heroTotal = hero.totalStreetBet + hero.stack;
+        auto          bigBlind  = std::max(1, round.getBlinds().BB());
+        const auto&   cards     = hand.getCards();
+        auto          heroClass = Range::comboClass(Range::comboIndex(cards[0], cards[1]));
+        uint64_t      heroMask  = (1ULL << Range::cardIndex(cards[0])) | (1ULL << Range::cardIndex(cards[1]));
+        auto          payouts   = _payouts.empty() ? std::vector<double> {static_cast<double>(game.getMultipliers())} : _payouts;
+        stacks_t      stacks(static_cast<std::size_t>(seats.size()), 0);
+        ClassEquities equities(_equityTable.load());
+
+        for (const auto& seat : seats) { stacks.at(seat.number - 1) = seat.stack; }
+
+        // The strongest hands pushed with the chips, wider on short stacks
+        auto pushRange = [&](int32_t chips) {
+            return strongestClasses(std::clamp(PUSH_RANGE_BIG_BLINDS * bigBlind / chips, MIN_PUSH_RANGE, 1.0));
+        };
+        auto heroPushRange = pushRange(heroTotal);
+        auto heroIcm       = [&](const stacks_t& outcome) { return icm(outcome, payouts).front(); };
+        auto villainRange = [&](int32_t playerNum) {
+            if (ranges != nullptr && ranges->isTracked(playerNum)) { return ranges->getRange(playerNum); }
+
+            Range range;
+
+            range.removeCard(cards[0]);
+            range.removeCard(cards[1]);
+
+            return range;
+        };
+
+        // The fold outcome, the pot goes to the highest bettor
+        auto foldStacks = stacks;
+
+        foldStacks.at(aggressorNum - 1) += pot;
+
+        auto foldEv = heroIcm(foldStacks);
+
+        // The contenders and the hero stacks after a showdown against each of them
+        std::vector<Contender> contenders;
+        std::vector<Showdown>  showdowns;
+        double                 noContestEv = 0;  // Weighted by the probability that no villain calls the push
+
+        auto addShowdown = [&](const Seat& villain, double probability, Range range) {
+            auto matched  = std::min(heroTotal, villain.totalStreetBet + villain.stack);
+            auto heroAdd  = matched - hero.totalStreetBet;
+            auto excess   = std::max(0, villain.totalStreetBet - matched);  // Returned to the villain
+            auto potAfter = pot + heroAdd + std::max(0, matched - villain.totalStreetBet) - excess;
+            auto win      = stacks;
+            auto lose     = stacks;
+
+            win.at(0)                   = hero.stack - heroAdd + potAfter;
+            lose.at(0)                  = hero.stack - heroAdd;
+            win.at(villain.number - 1)  = villain.stack - std::max(0, matched - villain.totalStreetBet) + excess;
+            lose.at(villain.number - 1) = win.at(villain.number - 1) + potAfter;
+
+            contenders.push_back({villain.number, probability, equities.get(heroClass, range.getClassWeights()), std::move(range)});
+            showdowns.push_back({heroIcm(win), heroIcm(lose)});
+        };
+
+        if (callSpot) {
+            auto range = villainRange(aggressorNum);
+            // Without a tracked range, the pusher is assumed to push the strongest hands for its stack
+            if (ranges == nullptr || !ranges->isTracked(aggressorNum)) {
+                range = restrictRange(std::move(range), pushRange(aggressor.totalStreetBet));
+            }
+
+            addShowdown(aggressor, 1, std::move(range));
+        } else {
+            double stillFolded = 1;  // The probability that the villains before have folded
+
+            for (int32_t playerNum = 2; playerNum <= seats.size(); ++playerNum) {
+                const auto& villain = seats.at(playerNum);
+
+                if (!villain.inRound || villain.isAllIn) { continue; }
+
+                auto matched = std::min(heroTotal, villain.totalStreetBet + villain.stack);
+                auto toPay   = matched - villain.totalStreetBet;
+                auto potOdds = static_cast<double>(toPay) / (pot + matched - hero.totalStreetBet + toPay);
+                auto range   = villainRange(playerNum);
+                // The villain calls with the classes which equity against the hero pushing range beats its pot odds
+                Range::class_weights_t callingClasses {};
+                double                 callProbability = 0;
+                auto                   classWeights    = range.getClassWeights();
+
+                for (int32_t villainClass = 0; villainClass < HAND_CLASSES_NUMBER; ++villainClass) {
+                    if (equities.get(villainClass, heroPushRange) >= potOdds) {
+                        callingClasses.at(villainClass) = 1;
+                        callProbability                 += classWeights.at(villainClass);
+                    }
+                }
+
+                if (callProbability <= 0) { continue; }
+
+                addShowdown(villain, stillFolded * callProbability, restrictRange(std::move(range), callingClasses));
+                stillFolded *= 1 - callProbability;
+            }
+
+            auto noContestStacks = stacks;
+
+            noContestStacks.at(0) += pot;
+            noContestEv = stillFolded * heroIcm(noContestStacks);
+        }
+
+        auto publish = [&](Quality quality) {
+            double contestEv = noContestEv;
+
+            for (std::size_t index = 0; index < contenders.size(); ++index) {
+                contestEv += contenders[index].probability * heroEv(showdowns[index], contenders[index].equity);
+            }
+
+            auto playAction = callSpot ? Action::CALL : Action::PUSH;
+
+            advice.action       = contestEv > foldEv ? playAction : Action::FOLD;
+            advice.quality      = quality;
+            advice.evDifference = std::abs(contestEv - foldEv);
+            advice.equity       = contenders.empty() ? 0 : contenders.front().equity;
+        };
+
+        publish(equities.hasTable() ? Quality::TABLE : Quality::APPROXIMATE);
+
+        // Simulate the hero cards against each contender range, a batch per contender in turn until the deadline is near
+        std::vector<ComboSampler> samplers;
+        std::vector<double>       shares(contenders.size(), 0);
+        std::vector<int32_t>      samples(contenders.size(), 0);
+        std::mt19937_64           generator(SIMULATION_SEED);
+        EquityTable::board_t      board {};
+        std::array<int32_t, 2>    heroCards = {Range::cardIndex(cards[0]), Range::cardIndex(cards[1])};
+        auto                      simulated = !contenders.empty();
+
+        for (const auto& contender : contenders) { samplers.emplace_back(contender.range, heroMask); }
+
+        while (simulated && steady_clock::now() < deadline) {
+            auto done = true;
+
+            for (std::size_t index = 0; index < contenders.size(); ++index) {
+                if (samples[index] >= MAX_SIMULATIONS || samplers[index].isEmpty()) { continue; }
+
+                done = false;
+
+                for (int32_t sample = 0; sample < SIMULATION_BATCH; ++sample) {
+                    auto     villainCards = Range::comboCards(samplers[index].draw(generator));
+                    uint64_t used         = heroMask | (1ULL << villainCards[0]) | (1ULL << villainCards[1]);
+
+                    for (auto& card : board) {
+                        do {
+                            card = static_cast<EquityTable::card_t>(generator() % DECK_CARDS_NUMBER);
+                        } while ((used & (1ULL << card)) != 0);
+
+                        used |= 1ULL << card;
+                    }
+
+                    shares[index] += EquityTable::showdown(heroCards, villainCards, board);
+                }
+
+                samples[index] += SIMULATION_BATCH;
+            }
+
+            if (done) { break; }
+        }
+
+        for (std::size_t index = 0; index < contenders.size(); ++index) {
+            simulated = simulated && samples[index] >= MIN_SIMULATIONS;
+        }
+
+        if (simulated) {
+            for (std::size_t index = 0; index < contenders.size(); ++index) {
+                contenders[index].equity = shares[index] / samples[index];
+            }
+
+            advice.samplesNumber = std::accumulate(samples.begin(), samples.end(), 0);
+            publish(Quality::SIMULATED);
+        }
+
+        advice.elapsed = duration_cast<microseconds>(steady_clock::now() - start);
+
+        return advice;
+    }
+
+    /**
+     * @brief Each place is taken by a remaining player with a probability proportional to its stack, the payouts of every
+     * finishing order of the paid places are summed weighted by the order probability.
+     */
+    auto PushFoldAdvisor::icm(std::span<const int32_t> stacks, std::span<const double> payouts) -> std::vector<double> {
+        std::vector<double> equities(stacks.size(), 0);
+        int64_t             total = 0;
+
+        for (auto stack : stacks) { total += std::max(0, stack); }
+
+        auto place = [&](auto& self, std::size_t placeIndex, double probability, int64_t remaining, uint32_t placed) -> void {
+            if (placeIndex >= payouts.size() || remaining <= 0) { return; }
+
+            for (std::size_t player = 0; player < stacks.size(); ++player) {
+                if (stacks[player] <= 0 || (placed & (1U << player)) != 0) { continue; }
+
+                auto placeProbability = probability * stacks[player] / static_cast<double>(remaining);
+
+                equities[player] += placeProbability * payouts[placeIndex];
+                self(self, placeIndex + 1, placeProbability, remaining - stacks[player], placed | (1U << player));
+            }
+        };
+
+        place(place, 0, 1, total, 0);
+
+        return equities;
+    }
+}  // namespace Analytics
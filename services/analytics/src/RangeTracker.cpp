@@ -0,0 +1,310 @@
+#include "analytics/RangeTracker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Analytics {
+    using GameHandler::MAX_SEATS;
+    using GameHandler::RANK_CARDS_NUMBER;
+    using GameHandler::SUIT_CARDS_NUMBER;
+
+    using ActionType = RoundAction::ActionType;
+    using enum Round::Street;
+
+    namespace {
+        struct ComboCards {
+            public:
+                int32_t first  = 0;
+                int32_t second = 0;  // Always above the first one
+        };
+
+        // The cards of each combo in the combos order
+        auto comboCardsTable() -> const std::array<ComboCards, COMBOS_NUMBER>& {
+            static const auto COMBO_CARDS = [] {
+                std::array<ComboCards, COMBOS_NUMBER> combos {};
+
+                for (int32_t second = 1; second < DECK_CARDS_NUMBER; ++second) {
+                    for (int32_t first = 0; first < second; ++first) {
+                        combos.at(Range::comboIndex(first, second)) = {.first = first, .second = second};
+                    }
+                }
+
+                return combos;
+            }();
+
+            return COMBO_CARDS;
+        }
+
+        auto cardRank(int32_t card) -> Card::Rank { return static_cast<Card::Rank>(card / SUIT_CARDS_NUMBER + Card::Rank::TWO); }
+        auto cardSuit(int32_t card) -> int32_t { return card % SUIT_CARDS_NUMBER; }
+
+        // Chen formula score of a hand class from its ranks (from 0 for a two) without the final rounding
+        auto chenScore(int32_t highRank, int32_t lowRank, bool suited) -> float {
+            static constexpr std::array<float, RANK_CARDS_NUMBER> HIGH_CARD_POINTS = {1, 1.5, 2, 2.5, 3, 3.5, 4, 4.5, 5, 6, 7, 8, 10};
+            static constexpr std::array<float, 5>                 GAP_PENALTIES    = {0, 1, 2, 4, 5};
+            static constexpr int32_t                              QUEEN_RANK       = Card::Rank::QUEEN - Card::Rank::TWO;
+
+            if (highRank == lowRank) { return std::max(5.0F, 2 * HIGH_CARD_POINTS.at(highRank)); }
+
+            auto gap   = std::min<int32_t>(highRank - lowRank - 1, GAP_PENALTIES.size() - 1);
+            auto score = HIGH_CARD_POINTS.at(highRank) - GAP_PENALTIES.at(gap);
+
+            if (suited) { score += 2; }
+            if (gap <= 1 && highRank < QUEEN_RANK) { score += 1; }
+
+            return score;
+        }
+
+        auto clampLikelihood(float likelihood) -> float { return std::clamp(likelihood, ActionLikelihoods::MIN_LIKELIHOOD, 1.0F); }
+    }  // namespace
+
+    Range::Range() { std::fill_n(_weights.begin(), COMBOS_NUMBER, 1.0F / COMBOS_NUMBER); }
+
+    auto Range::getWeight(const Hand& hand) const -> float {
+        const auto& cards = hand.getCards();
+
+        return _weights.at(comboIndex(cards[0], cards[1]));
+    }
+
+    auto Range::getClassWeights() const -> class_weights_t {
+        class_weights_t classWeights {};
+
+        for (int32_t combo = 0; combo < COMBOS_NUMBER; ++combo) { classWeights.at(comboClass(combo)) += _weights[combo]; }
+
+        return classWeights;
+    }
+
+    auto Range::update(const weights_t& likelihoods) -> void {
+        for (std::size_t combo = 0; combo < _weights.size(); ++combo) { _weights[combo] *= likelihoods[combo]; }
+
+        _normalize();
+    }
+
+    auto Range::removeCard(const Card& card) -> void {
+        auto removed = cardIndex(card);
+
+        for (int32_t other = 0; other < DECK_CARDS_NUMBER; ++other) {
+            if (other != removed) { _weights.at(comboIndex(removed, other)) = 0; }
+        }
+
+        _normalize();
+    }
+
+    auto Range::cardIndex(const Card& card) -> int32_t {
+        if (card.isUnknown()) { throw std::invalid_argument("An unknown card has no combo"); }
+
+        return (card.getRank() - Card::Rank::TWO) * SUIT_CARDS_NUMBER + card.getSuit();
+    }
+
+    auto Range::comboIndex(const Card& first, const Card& second) -> int32_t {
+        return comboIndex(cardIndex(first), cardIndex(second));
+    }
+
+    auto Range::comboIndex(int32_t firstCard, int32_t secondCard) -> int32_t {
+        auto [low, high] = std::minmax(firstCard, secondCard);
+
+        return high * (high - 1) / 2 + low;
+    }
+
+    auto Range::comboCards(int32_t combo) -> std::array<int32_t, 2> {
+        const auto& cards = comboCardsTable().at(combo);
+
+        return {cards.first, cards.second};
+    }
+
+    auto Range::classIndex(Card::Rank firstRank, Card::Rank secondRank, bool suited) -> int32_t {
+        auto low  = std::min(firstRank, secondRank) - Card::Rank::TWO;
+        auto high = std::max(firstRank, secondRank) - Card::Rank::TWO;
+
+        return suited ? high * RANK_CARDS_NUMBER + low : low * RANK_CARDS_NUMBER + high;
+    }
+
+    auto Range::comboClass(int32_t combo) -> int32_t {
+        static const auto COMBO_CLASSES = [] {
+            std::array<int32_t, COMBOS_NUMBER> classes {};
+
+            for (int32_t index = 0; index < COMBOS_NUMBER; ++index) {
+                auto [first, second] = comboCardsTable().at(index);
+
+                classes.at(index) = classIndex(cardRank(first), cardRank(second), cardSuit(first) == cardSuit(second));
+            }
+
+            return classes;
+        }();
+
+        return COMBO_CLASSES.at(combo);
+    }
+
+    auto Range::_normalize() -> void {
+        std::array<float, COMBO_LANES> lanes {};
+        // One partial sum per lane, so the sum is vectorized without reordering the additions
+        for (std::size_t combo = 0; combo < _weights.size(); combo += COMBO_LANES) {
+            for (std::size_t lane = 0; lane < COMBO_LANES; ++lane) { lanes[lane] += _weights[combo + lane]; }
+        }
+
+        auto total = std::accumulate(lanes.begin(), lanes.end(), 0.0F);
+
+        if (total <= 0) { return; }
+
+        auto scale = 1.0F / total;
+
+        for (auto& weight : _weights) { weight *= scale; }
+    }
+
+    ActionLikelihoods::ActionLikelihoods()
+      : _tables(static_cast<std::size_t>(SHOWDOWN * ACTIONS_NUMBER)) {
+        auto strengths = classStrengths();
+        // Likelihood by strength of each action, pre-flop then post-flop
+        auto setTables = [&](Round::Street street, auto&& likelihood) {
+            for (auto action : {ActionType::CHECK, ActionType::CALL, ActionType::BET, ActionType::RAISE, ActionType::FOLD}) {
+                class_likelihoods_t likelihoods {};
+
+                std::ranges::transform(strengths, likelihoods.begin(), [&](float strength) { return likelihood(action, strength); });
+
+                set(street, action, likelihoods);
+            }
+        };
+
+        setTables(PREFLOP, [](ActionType action, float strength) {
+            switch (action) {
+                case ActionType::CHECK: return 1 - 0.8F * std::pow(strength, 4.0F);
+                case ActionType::CALL: return 0.1F + 3.6F * strength * (1 - strength);
+                case ActionType::BET:
+                case ActionType::RAISE: return std::pow(strength, 4.0F);
+                default: return 1 - strength;
+            }
+        });
+
+        for (auto street : {FLOP, TURN, RIVER}) {
+            setTables(street, [](ActionType action, float strength) {
+                switch (action) {
+                    case ActionType::CHECK: return 1 - 0.5F * strength * strength;
+                    case ActionType::CALL: return 0.4F + 0.6F * strength;
+                    case ActionType::BET:
+                    case ActionType::RAISE: return 0.3F + 0.7F * strength * strength;
+                    default: return 1 - 0.8F * strength;
+                }
+            });
+        }
+    }
+
+    auto ActionLikelihoods::get(Round::Street street, ActionType action) const -> const Range::weights_t& {
+        return _tables.at(_tableIndex(street, action));
+    }
+
+    auto ActionLikelihoods::set(Round::Street street, ActionType action, const class_likelihoods_t& likelihoods) -> void {
+        auto& table = _tables.at(_tableIndex(street, action));
+
+        table.fill(0);
+
+        for (int32_t combo = 0; combo < COMBOS_NUMBER; ++combo) {
+            table.at(combo) = clampLikelihood(likelihoods.at(Range::comboClass(combo)));
+        }
+    }
+
+    auto ActionLikelihoods::classStrengths() -> class_likelihoods_t {
+        std::array<float, HAND_CLASSES_NUMBER>   scores {};
+        std::array<int32_t, HAND_CLASSES_NUMBER> combos {};
+        std::array<int32_t, HAND_CLASSES_NUMBER> classes {};
+        class_likelihoods_t                      strengths {};
+
+        for (int32_t row = 0; row < RANK_CARDS_NUMBER; ++row) {
+            for (int32_t column = 0; column < RANK_CARDS_NUMBER; ++column) {
+                auto handClass = row * RANK_CARDS_NUMBER + column;
+                // Suited above the diagonal, with the higher rank as row
+                scores.at(handClass) = chenScore(std::max(row, column), std::min(row, column), row > column);
+                combos.at(handClass) = row == column ? 6 : row > column ? 4 : 12;
+            }
+        }
+
+        std::iota(classes.begin(), classes.end(), 0);
+        std::ranges::sort(classes, {}, [&](int32_t handClass) { return scores.at(handClass); });
+        // The classes of a same score share the percentile of their middle combo
+        int32_t weaker = 0;
+
+        for (auto first = classes.begin(); first != classes.end();) {
+            auto last  = std::find_if(
+                first, classes.end(), [&](int32_t handClass) { return scores.at(handClass) != scores.at(*first); });
+            auto equal = std::accumulate(first, last, 0, [&](int32_t sum, int32_t handClass) { return sum + combos.at(handClass); });
+
+            for (auto handClass = first; handClass != last; ++handClass) {
+                strengths.at(*handClass) = (weaker + equal / 2.0F) / COMBOS_NUMBER;
+            }
+
+            weaker += equal;
+            first   = last;
+        }
+
+        return strengths;
+    }
+
+    auto ActionLikelihoods::_tableIndex(Round::Street street, ActionType action) -> std::size_t {
+        auto actionIndex = static_cast<int32_t>(action);
+
+        if (street < PREFLOP || street >= SHOWDOWN) { throw std::invalid_argument("The actions are played from pre-flop to river"); }
+        if (actionIndex < 0 || actionIndex >= ACTIONS_NUMBER) { throw std::invalid_argument("Only the played actions are likely"); }
+
+        return static_cast<std::size_t>(street * ACTIONS_NUMBER + actionIndex);
+    }
+
+    auto RangeTracker::isTracked(int32_t playerNum) const -> bool {
+        return playerNum >= 1 && playerNum <= MAX_SEATS && _tracked.at(playerNum - 1);
+    }
+
+    auto RangeTracker::getRange(int32_t playerNum) const -> const Range& {
+        if (!isTracked(playerNum)) { throw std::invalid_argument("The player range is not tracked"); }
+
+        return _ranges.at(playerNum - 1);
+    }
+
+    auto RangeTracker::track(Round& round) -> void {
+        reset(round);
+
+        round.setActionListener([this](const Round& trackedRound, const RoundAction& action) { update(trackedRound, action); });
+    }
+
+    // The villains in the round start from a full range without the known hero and board cards
+    auto RangeTracker::reset(const Round& round) -> void {
+        _tracked      = {};
+        _removedCards = {};
+
+        for (const auto& seat : round.getSeats()) {
+            if (seat.number == 1 || !seat.inRound) { continue; }
+
+            _tracked.at(seat.number - 1) = true;
+            _ranges.at(seat.number - 1)  = Range();
+        }
+
+        auto heroHand = round.getPlayerHand(1);
+
+        for (const auto& card : heroHand.getCards()) { _removeCard(card); }
+        for (const auto& card : round.getBoard().getCards()) { _removeCard(card); }
+    }
+
+    auto RangeTracker::update(const Round& round, const RoundAction& action) -> void {
+        // The board cards are set by the session between two actions
+        for (const auto& card : round.getBoard().getCards()) { _removeCard(card); }
+
+        auto actionIndex = static_cast<int32_t>(action.getAction());
+
+        if (!isTracked(action.getPlayerNum()) || actionIndex < 0 || actionIndex >= ActionLikelihoods::ACTIONS_NUMBER) { return; }
+        // The action is the last one recorded, the round may already be on the next street which has no action yet
+        const auto& actions = round.getActions();
+        auto        street  = static_cast<int32_t>(RIVER);
+
+        while (street > PREFLOP && actions.at(street).empty()) { --street; }
+
+        _ranges.at(action.getPlayerNum() - 1).update(_likelihoods.get(static_cast<Round::Street>(street), action.getAction()));
+    }
+
+    auto RangeTracker::_removeCard(const Card& card) -> void {
+        if (card.isUnknown() || _removedCards.at(Range::cardIndex(card))) { return; }
+
+        _removedCards.at(Range::cardIndex(card)) = true;
+
+        for (int32_t playerNum = 2; playerNum <= MAX_SEATS; ++playerNum) {
+            if (_tracked.at(playerNum - 1)) { _ranges.at(playerNum - 1).removeCard(card); }
+        }
+    }
+}  // namespace Analytics
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+
+#include <analytics/EquityTable.hpp>
+#include <game_handler/Board.hpp>
+#include <game_handler/CardFactory.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using Analytics::DECK_CARDS_NUMBER;
+using Analytics::EquityTable;
+using Analytics::HAND_CLASSES_NUMBER;
+using Analytics::invalid_equity_table;
+using Analytics::Range;
+using GameHandler::Board;
+using GameHandler::Card;
+using GameHandler::Hand;
+using GameHandler::Factory::card;
+
+namespace {
+    auto indexCard(int32_t index) -> Card {
+        return {static_cast<Card::Rank>(index / 4 + Card::TWO), static_cast<Card::Suit>(index % 4)};
+    }
+
+    auto classOf(const char* first, const char* second) -> int32_t {
+        return Range::comboClass(Range::comboIndex(card(first), card(second)));
+    }
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(EquityTableTest, showdownShouldAgreeWithTheBoardEvaluation) {
+    std::mt19937_64 generator(42);
+
+    for (int32_t deal = 0; deal < 5'000; ++deal) {
+        std::array<int32_t, DECK_CARDS_NUMBER> deck {};
+
+        std::iota(deck.begin(), deck.end(), 0);
+        std::shuffle(deck.begin(), deck.end(), generator);
+
+        EquityTable::board_t board = {deck[4], deck[5], deck[6], deck[7], deck[8]};
+
+        Board gameBoard({indexCard(board[0]), indexCard(board[1]), indexCard(board[2]), indexCard(board[3]), indexCard(board[4])});
+        Hand  first(indexCard(deck[0]), indexCard(deck[1]));
+        Hand  second(indexCard(deck[2]), indexCard(deck[3]));
+        auto  expected = gameBoard.compareHands(first, second);
+
+        ASSERT_EQ(EquityTable::showdown({deck[0], deck[1]}, {deck[2], deck[3]}, board), (expected + 1) / 2.0)
+            << fmt::format("deal {}", deal);
+    }
+}
+
+TEST(EquityTableTest, computedEquitiesShouldMatchTheKnownMatchups) {
+    auto table  = EquityTable::compute(1'000, 4);
+    auto aces   = classOf("AH", "AS");
+    auto trash  = classOf("7H", "2S");
+    auto kings  = classOf("KH", "KS");
+    auto suited = classOf("AH", "KH");
+
+    EXPECT_EQ(table.getSamplesNumber(), 1'000);
+    EXPECT_NEAR(table.getEquity(aces, trash), 0.87, 0.03);
+    EXPECT_NEAR(table.getEquity(aces, kings), 0.82, 0.03);
+    EXPECT_NEAR(table.getEquity(kings, suited), 0.66, 0.03);
+    EXPECT_EQ(table.getEquity(aces, aces), 0.5);
+
+    for (int32_t hero = 0; hero < HAND_CLASSES_NUMBER; hero += 7) {
+        for (int32_t villain = 0; villain < HAND_CLASSES_NUMBER; villain += 5) {
+            EXPECT_NEAR(table.getEquity(hero, villain) + table.getEquity(villain, hero), 1, 1e-5);
+        }
+    }
+    // The table does not depend on the threads number
+    EXPECT_EQ(EquityTable::compute(50, 1).getEquity(aces, kings), EquityTable::compute(50, 3).getEquity(aces, kings));
+}
+
+TEST(EquityTableTest, tableShouldBeSavedAndLoaded) {
+    auto path  = std::filesystem::temp_directory_path() / "equity_table_test.bin";
+    auto table = EquityTable::compute(20, 2);
+
+    table.save(path);
+
+    auto loaded = EquityTable::load(path);
+
+    EXPECT_EQ(loaded.getSamplesNumber(), 20);
+
+    for (int32_t hero = 0; hero < HAND_CLASSES_NUMBER; hero += 3) {
+        for (int32_t villain = 0; villain < HAND_CLASSES_NUMBER; villain += 4) {
+            EXPECT_EQ(loaded.getEquity(hero, villain), table.getEquity(hero, villain));
+        }
+    }
+
+    std::filesystem::resize_file(path, 100);
+
+    EXPECT_THROW_WITH_MESSAGE(static_cast<void>(EquityTable::load(path)), invalid_equity_table, "Truncated equity table");
+
+    std::ofstream(path, std::ios::trunc) << "not an equity table";
+
+    EXPECT_THROW_WITH_MESSAGE(static_cast<void>(EquityTable::load(path)), invalid_equity_table, "The file is not an equity table");
+    std::filesystem::remove(path);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
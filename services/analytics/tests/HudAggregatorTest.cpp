@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <analytics/HudAggregator.hpp>
+#include <game_handler/CardFactory.hpp>
+#include <utilities/GtestGames.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using Analytics::HudAggregator;
+using Analytics::PlayerStats;
+using GameHandler::Game;
+using GameHandler::Factory::card;
+using Utilities::Gtest::playFlopBetThenAllInShowdown;
+
+class HudAggregatorTest : public ::testing::Test {};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(HudAggregatorTest, preflopStatsShouldBeCounted) {
+    Game          game;
+    HudAggregator hud;
+
+    playFlopBetThenAllInShowdown(game);
+    hud.addGame(game);
+
+    auto hero     = hud.getStats("player 1");
+    auto stealer  = hud.getStats("player 2");
+    auto defender = hud.getStats("player 3");
+
+    EXPECT_EQ(hud.getPlayersNumber(), 3);
+    EXPECT_EQ(hero.hands, 2);
+    EXPECT_DOUBLE_EQ(hero.getVpip(), 100.0);
+    EXPECT_DOUBLE_EQ(hero.getPfr(), 50.0);
+    EXPECT_EQ(hero.threeBetOpportunities, 1);
+    EXPECT_DOUBLE_EQ(hero.getThreeBet(), 0.0);
+    // The small blind called the steal before the hero acted in the big blind
+    EXPECT_EQ(hero.stealsFaced, 0);
+    EXPECT_DOUBLE_EQ(stealer.getVpip(), 50.0);
+    EXPECT_EQ(stealer.stealsFaced, 1);
+    EXPECT_DOUBLE_EQ(stealer.getFoldToSteal(), 100.0);
+    EXPECT_EQ(defender.stealsFaced, 2);
+    EXPECT_DOUBLE_EQ(defender.getFoldToSteal(), 0.0);
+    EXPECT_EQ(defender.threeBetOpportunities, 2);
+}
+
+TEST_F(HudAggregatorTest, postflopAndShowdownStatsShouldBeCounted) {
+    Game          game;
+    HudAggregator hud;
+
+    playFlopBetThenAllInShowdown(game);
+    hud.addGame(game);
+
+    auto hero     = hud.getStats("player 1");
+    auto stealer  = hud.getStats("player 2");
+    auto defender = hud.getStats("player 3");
+
+    EXPECT_DOUBLE_EQ(hero.getAf(), 1.0);
+    EXPECT_EQ(hero.sawFlop, 2);
+    EXPECT_DOUBLE_EQ(hero.getWtsd(), 50.0);
+    EXPECT_DOUBLE_EQ(hero.getWsd(), 100.0);
+    EXPECT_EQ(stealer.sawFlop, 1);
+    EXPECT_DOUBLE_EQ(stealer.getWtsd(), 100.0);
+    EXPECT_DOUBLE_EQ(stealer.getWsd(), 0.0);
+    EXPECT_EQ(defender.postflopAggressions, 0);
+    EXPECT_DOUBLE_EQ(defender.getWtsd(), 50.0);
+}
+
+TEST_F(HudAggregatorTest, allInsShouldBeCountedByStackDepth) {
+    Game          game;
+    HudAggregator hud;
+
+    playFlopBetThenAllInShowdown(game);
+    hud.addGame(game);
+
+    auto stealer = hud.getStats("player 2");
+
+    EXPECT_EQ(PlayerStats::depthBucket(199, 20), 0);
+    EXPECT_EQ(PlayerStats::depthBucket(200, 20), 1);
+    EXPECT_EQ(PlayerStats::depthBucket(5000, 20), 3);
+    EXPECT_EQ(stealer.handsByDepth, PlayerStats::depth_counters_t({1, 1, 0, 0}));
+    EXPECT_DOUBLE_EQ(stealer.getAllIn(0), 100.0);
+    EXPECT_DOUBLE_EQ(stealer.getAllIn(1), 0.0);
+    EXPECT_DOUBLE_EQ(hud.getStats("player 1").getAllIn(0), 0.0);
+}
+
+TEST_F(HudAggregatorTest, mergedAggregatesShouldEqualTheBackfill) {
+    std::vector<Game> games(4);
+    HudAggregator     first;
+    HudAggregator     second;
+
+    for (auto& game : games) { playFlopBetThenAllInShowdown(game); }
+
+    first.addGame(games[0]);
+    first.addGame(games[1]);
+    second.addGame(games[2]);
+    second.addGame(games[3]);
+    first.merge(second);
+
+    auto backfilled = HudAggregator::backfill(games, 3);
+
+    EXPECT_EQ(first.getStats("player 1").hands, 8);
+    EXPECT_JSON_EQ(backfilled.toJson(), first.toJson());
+    EXPECT_EQ(backfilled.getStats("player 3"), first.getStats("player 3"));
+}
+
+TEST_F(HudAggregatorTest, unknownPlayerShouldHaveEmptyStats) {
+    HudAggregator hud;
+
+    EXPECT_FALSE(hud.contains("villain"));
+    EXPECT_EQ(hud.getStats("villain"), PlayerStats());
+    EXPECT_DOUBLE_EQ(hud.getStats("villain").getVpip(), 0.0);
+}
+
+TEST_F(HudAggregatorTest, roundInProgressShouldNotBeAdded) {
+    Game          game;
+    HudAggregator hud;
+
+    game.setInitialStack(1000);
+    game.init({"player 1", "player 2", "player 3"});
+
+    auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+    EXPECT_THROW_WITH_MESSAGE(hud.addRound(round, game), std::invalid_argument, "Only the ended rounds can be added to the stats");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include <analytics/OpponentDatabase.hpp>
+#include <game_handler/CardFactory.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using Analytics::invalid_opponent_database;
+using Analytics::opponent_database_locked;
+using Analytics::OpponentDatabase;
+using Analytics::PlayerStats;
+using GameHandler::Factory::card;
+
+class OpponentDatabaseTest : public ::testing::Test {
+    protected:
+        std::filesystem::path path = Utilities::Gtest::testTempPath("opponent_database.ptod");
+
+        auto SetUp() -> void override { std::filesystem::remove(path); }
+        auto TearDown() -> void override { std::filesystem::remove(path); }
+
+    public:
+        static auto makeStats(uint32_t hands) -> PlayerStats {
+            PlayerStats stats;
+
+            stats.hands = hands;
+            stats.vpip  = hands;
+
+            return stats;
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(OpponentDatabaseTest, addedStatsShouldBeFoundAfterReopening) {
+    {
+        OpponentDatabase database(path, OpponentDatabase::Mode::READ_WRITE, 16);
+
+        database.add("villain 1", makeStats(10));
+        database.add("villain 2", makeStats(20));
+        database.flush();
+    }
+
+    OpponentDatabase database(path, OpponentDatabase::Mode::READ_ONLY);
+
+    EXPECT_EQ(database.size(), 2);
+    EXPECT_EQ(database.getCapacity(), 16);
+    EXPECT_EQ(database.find("villain 1"), makeStats(10));
+    EXPECT_EQ(database.find("villain 2"), makeStats(20));
+    EXPECT_EQ(database.find("villain 3"), std::nullopt);
+    EXPECT_THROW_WITH_MESSAGE(
+        database.add("villain 3", makeStats(1)), invalid_opponent_database, "The opponent database is opened in read only mode");
+}
+
+TEST_F(OpponentDatabaseTest, statsOfAKnownPlayerShouldBeMerged) {
+    OpponentDatabase database(path, OpponentDatabase::Mode::READ_WRITE, 16);
+
+    database.add("villain", makeStats(10));
+    database.add("villain", makeStats(5));
+
+    EXPECT_EQ(database.size(), 1);
+    EXPECT_EQ(database.find("villain")->hands, 15);
+}
+
+TEST_F(OpponentDatabaseTest, hudStatsShouldBeAdded) {
+    GameHandler::Game        game;
+    Analytics::HudAggregator hud;
+    OpponentDatabase         database(path, OpponentDatabase::Mode::READ_WRITE, 16);
+
+    game.setInitialStack(1000);
+    game.init({"player 1", "player 2", "player 3"});
+
+    auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+    round.raiseTo(1, 300);
+    round.fold(2);
+    round.fold(3);
+
+    hud.addGame(game);
+    database.add(hud);
+    database.add(hud);
+
+    EXPECT_EQ(database.size(), 3);
+    EXPECT_EQ(database.find("player 1")->pfr, 2);
+    EXPECT_EQ(database.find("player 2")->foldsToSteal, 2);
+}
+
+TEST_F(OpponentDatabaseTest, fullDatabaseShouldThrowException) {
+    OpponentDatabase database(path, OpponentDatabase::Mode::READ_WRITE, 2);
+
+    database.add("villain 1", makeStats(1));
+    database.add("villain 2", makeStats(1));
+
+    EXPECT_THROW_WITH_MESSAGE(database.add("villain 3", makeStats(1)), invalid_opponent_database, "The opponent database is full");
+    EXPECT_NO_THROW(database.add("villain 1", makeStats(1)));
+}
+
+TEST_F(OpponentDatabaseTest, invalidFileShouldThrowException) {
+    std::ofstream(path) << "not an opponent database, not an opponent database, not an opponent database";
+
+    EXPECT_THROW_WITH_MESSAGE(OpponentDatabase database(path), invalid_opponent_database, "The file is not an opponent database");
+}
+
+TEST_F(OpponentDatabaseTest, secondWriterShouldThrowException) {
+    OpponentDatabase database(path, OpponentDatabase::Mode::READ_WRITE, 16);
+
+    database.add("villain", makeStats(10));
+
+    EXPECT_THROW_WITH_MESSAGE(
+        OpponentDatabase writer(path), opponent_database_locked, "The opponent database is already opened for writing");
+    EXPECT_EQ(OpponentDatabase(path, OpponentDatabase::Mode::READ_ONLY).find("villain"), makeStats(10));
+}
+
+TEST_F(OpponentDatabaseTest, interruptedUpdateShouldBeResetByTheNextWriter) {
+    // The first record is after the 64 bytes header and the 32 slots of a 16 opponents capacity, its sequence comes first
+    static constexpr std::streamoff FIRST_SEQUENCE_OFFSET = 64 + 32 * 8;
+
+    {
+        OpponentDatabase database(path, OpponentDatabase::Mode::READ_WRITE, 16);
+
+        database.add("villain", makeStats(10));
+    }
+    // A writer stopped in the middle of the update
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        uint32_t     sequence = 1;
+
+        file.seekp(FIRST_SEQUENCE_OFFSET);
+        file.write(reinterpret_cast<const char*>(&sequence), sizeof(sequence));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    EXPECT_EQ(OpponentDatabase(path, OpponentDatabase::Mode::READ_ONLY).find("villain"), std::nullopt);
+    EXPECT_EQ(OpponentDatabase(path).find("villain"), makeStats(10));
+}
+
+TEST_F(OpponentDatabaseTest, readersShouldNeverSeePartialStats) {
+    static constexpr int32_t PLAYERS_NUMBER = 2'000;
+    static constexpr int32_t READERS_NUMBER = 3;
+
+    OpponentDatabase  database(path, OpponentDatabase::Mode::READ_WRITE, PLAYERS_NUMBER);
+    std::atomic<bool> done      = false;
+    std::atomic<bool> corrupted = false;
+
+    {
+        std::vector<std::jthread> readers;
+
+        for (int32_t reader = 0; reader < READERS_NUMBER; ++reader) {
+            readers.emplace_back([&]() {
+                while (!done) {
+                    for (int32_t playerNum = 0; playerNum < PLAYERS_NUMBER; playerNum += 7) {
+                        auto stats = database.find(fmt::format("villain {}", playerNum));
+                        // The writer always adds hands and vpip together
+                        if (stats && stats->hands != stats->vpip) { corrupted = true; }
+                    }
+                }
+            });
+        }
+        // Insert all the players then update them while the readers look them up
+        for (int32_t round = 0; round < 5; ++round) {
+            for (int32_t playerNum = 0; playerNum < PLAYERS_NUMBER; ++playerNum) {
+                database.add(fmt::format("villain {}", playerNum), makeStats(1));
+            }
+        }
+
+        done = true;
+    }
+
+    EXPECT_FALSE(corrupted);
+    EXPECT_EQ(database.size(), PLAYERS_NUMBER);
+    EXPECT_EQ(database.find("villain 1999")->hands, 5);
+}
+
+TEST_F(OpponentDatabaseTest, lookupsLatencyShouldBeRecorded) {
+    static constexpr int32_t PLAYERS_NUMBER = 200'000;
+
+    OpponentDatabase database(path, OpponentDatabase::Mode::READ_WRITE, PLAYERS_NUMBER);
+
+    for (int32_t playerNum = 0; playerNum < PLAYERS_NUMBER; ++playerNum) {
+        database.add(fmt::format("villain {}", playerNum), makeStats(1));
+    }
+
+    std::vector<std::string> names;
+
+    for (int32_t playerNum = 0; playerNum < PLAYERS_NUMBER; playerNum += 3) { names.push_back(fmt::format("villain {}", playerNum)); }
+
+    auto     start = std::chrono::steady_clock::now();
+    uint32_t hands = 0;
+
+    for (const auto& name : names) { hands += database.find(name)->hands; }
+
+    auto elapsed       = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+    auto lookupLatency = elapsed.count() / static_cast<double>(names.size());
+
+    RecordProperty("lookup_microseconds", std::to_string(lookupLatency));
+
+    EXPECT_EQ(hands, names.size());
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include <analytics/PushFoldAdvisor.hpp>
+#include <game_handler/CardFactory.hpp>
+
+using Analytics::EquityTable;
+using Analytics::PushFoldAdvice;
+using Analytics::PushFoldAdvisor;
+using Analytics::RangeTracker;
+using GameHandler::Game;
+using GameHandler::Hand;
+using GameHandler::Factory::card;
+
+using Action  = PushFoldAdvice::Action;
+using Quality = PushFoldAdvice::Quality;
+
+namespace {
+    auto newGame(int32_t initialStack, int32_t playersNumber) -> Game {
+        Game                     game;
+        std::vector<std::string> names = {"hero"};
+
+        for (int32_t player = 2; player <= playersNumber; ++player) { names.push_back(fmt::format("villain {}", player)); }
+
+        game.setBuyIn(10);
+        game.setMultipliers(2);
+        game.setInitialStack(initialStack);
+        game.init(names);
+
+        return game;
+    }
+
+    auto sharedTable() -> std::shared_ptr<const EquityTable> {
+        static const auto TABLE = std::make_shared<const EquityTable>(EquityTable::compute(200));
+
+        return TABLE;
+    }
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(PushFoldAdvisorTest, icmShouldShareThePayoutsByStack) {
+    std::vector<int32_t> stacks     = {3'000, 1'000, 0};
+    std::vector<double>  winnerOnly = {2};
+    std::vector<double>  payouts    = {5, 3, 1};
+
+    auto linear  = PushFoldAdvisor::icm(stacks, winnerOnly);
+    auto shared  = PushFoldAdvisor::icm({{2'000, 1'000, 1'000}}, payouts);
+    auto evenSum = std::accumulate(shared.begin(), shared.end(), 0.0);
+
+    EXPECT_DOUBLE_EQ(linear[0], 1.5);
+    EXPECT_DOUBLE_EQ(linear[1], 0.5);
+    EXPECT_DOUBLE_EQ(linear[2], 0);
+    EXPECT_DOUBLE_EQ(evenSum, 9);
+    EXPECT_DOUBLE_EQ(shared[1], shared[2]);
+    // The chip leader equity is less than its chips share of the prize pool
+    EXPECT_GT(shared[0], shared[1]);
+    EXPECT_LT(shared[0], 9 * 0.5);
+}
+
+TEST(PushFoldAdvisorTest, shortStackedAcesShouldBePushed) {
+    auto            game  = newGame(1'000, 3);
+    auto&           round = game.newRound({100, 200}, {card("AH"), card("AS")}, 1);
+    PushFoldAdvisor advisor;
+
+    auto advice = advisor.advise(round, game, nullptr, std::chrono::milliseconds(0));
+
+    EXPECT_EQ(advice.action, Action::PUSH);
+    EXPECT_EQ(advice.quality, Quality::APPROXIMATE);
+    EXPECT_GT(advice.evDifference, 0);
+    EXPECT_GT(advice.equity, 0.5);
+}
+
+TEST(PushFoldAdvisorTest, trashFacingAnAllInShouldBeFolded) {
+    auto            game  = newGame(2'000, 3);
+    auto&           round = game.newRound({50, 100}, {card("7H"), card("2S")}, 3);
+    RangeTracker    tracker;
+    PushFoldAdvisor advisor(sharedTable());
+
+    tracker.track(round);
+    round.allIn(3);
+
+    auto trash = advisor.advise(round, game, &tracker);
+
+    EXPECT_EQ(trash.action, Action::FOLD);
+    EXPECT_LT(trash.equity, 0.4);
+
+    auto  acesGame  = newGame(2'000, 3);
+    auto& acesRound = acesGame.newRound({50, 100}, {card("AH"), card("AS")}, 3);
+
+    acesRound.allIn(3);
+
+    auto aces = advisor.advise(acesRound, acesGame);
+
+    EXPECT_EQ(aces.action, Action::CALL);
+    EXPECT_GT(aces.equity, 0.75);
+}
+
+TEST(PushFoldAdvisorTest, adviceShouldBeRefinedByTheEquityTableThenTheSimulations) {
+    auto            game  = newGame(1'500, 4);
+    auto&           round = game.newRound({100, 200}, {card("QH"), card("JH")}, 1);
+    PushFoldAdvisor advisor;
+
+    round.fold(4);
+
+    auto approximate = advisor.advise(round, game, nullptr, std::chrono::milliseconds(0));
+
+    advisor.setEquityTable(sharedTable());
+
+    auto table     = advisor.advise(round, game, nullptr, std::chrono::milliseconds(0));
+    auto simulated = advisor.advise(round, game);
+
+    RecordProperty("us_per_advice", std::to_string(simulated.elapsed.count()));
+
+    EXPECT_EQ(approximate.quality, Quality::APPROXIMATE);
+    EXPECT_EQ(table.quality, Quality::TABLE);
+    EXPECT_EQ(table.samplesNumber, 0);
+    EXPECT_EQ(simulated.quality, Quality::SIMULATED);
+    EXPECT_GE(simulated.samplesNumber, PushFoldAdvisor::MIN_SIMULATIONS);
+    EXPECT_NEAR(simulated.equity, table.equity, 0.05);
+}
+
+TEST(PushFoldAdvisorTest, onlyPreflopSpotsFacingABetShouldBeAdvised) {
+    auto            game  = newGame(1'000, 3);
+    auto&           round = game.newRound({100, 200}, {card("AH"), card("AS")}, 3);
+    PushFoldAdvisor advisor;
+
+    round.call(3);
+    round.call(1);
+    // The hero has matched the big blind
+    EXPECT_EQ(advisor.advise(round, game).action, Action::NONE);
+
+    round.check(2);
+    round.getBoard().setFlop({card("2C"), card("5D"), card("9H")});
+    round.bet(1, 200);
+
+    EXPECT_EQ(advisor.advise(round, game).action, Action::NONE);
+
+    auto  foldedGame  = newGame(1'000, 3);
+    auto& foldedRound = foldedGame.newRound({100, 200}, {card("AH"), card("AS")}, 1);
+
+    foldedRound.fold(1);
+
+    EXPECT_EQ(advisor.advise(foldedRound, foldedGame).action, Action::NONE);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <numeric>
+#include <set>
+
+#include <analytics/RangeTracker.hpp>
+#include <game_handler/CardFactory.hpp>
+#include <game_handler/Game.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using Analytics::ActionLikelihoods;
+using Analytics::COMBOS_NUMBER;
+using Analytics::DECK_CARDS_NUMBER;
+using Analytics::HAND_CLASSES_NUMBER;
+using Analytics::Range;
+using Analytics::RangeTracker;
+using GameHandler::Card;
+using GameHandler::Game;
+using GameHandler::Hand;
+using GameHandler::RoundAction;
+using GameHandler::Factory::card;
+
+using ActionType = RoundAction::ActionType;
+
+namespace {
+    auto totalWeight(const Range& range) -> float {
+        return std::accumulate(range.getWeights().begin(), range.getWeights().end(), 0.0F);
+    }
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(RangeTrackerTest, combosShouldBeIndexedOncePerCardsPair) {
+    std::set<int32_t>                        combos;
+    std::array<int32_t, HAND_CLASSES_NUMBER> classCombos {};
+
+    for (int32_t first = 0; first < DECK_CARDS_NUMBER; ++first) {
+        for (int32_t second = first + 1; second < DECK_CARDS_NUMBER; ++second) {
+            combos.insert(Range::comboIndex(first, second));
+            EXPECT_EQ(Range::comboIndex(first, second), Range::comboIndex(second, first));
+        }
+    }
+
+    for (int32_t combo = 0; combo < COMBOS_NUMBER; ++combo) { ++classCombos.at(Range::comboClass(combo)); }
+
+    EXPECT_EQ(combos.size(), COMBOS_NUMBER);
+    EXPECT_EQ(*combos.rbegin(), COMBOS_NUMBER - 1);
+    EXPECT_EQ(classCombos.at(Range::classIndex(Card::ACE, Card::ACE, false)), 6);
+    EXPECT_EQ(classCombos.at(Range::classIndex(Card::ACE, Card::KING, true)), 4);
+    EXPECT_EQ(classCombos.at(Range::classIndex(Card::KING, Card::ACE, false)), 12);
+    EXPECT_EQ(Range::comboClass(Range::comboIndex(card("7D"), card("2D"))), Range::classIndex(Card::SEVEN, Card::TWO, true));
+}
+
+TEST(RangeTrackerTest, chenScoreShouldRankTheHandClasses) {
+    auto strengths = ActionLikelihoods::classStrengths();
+    auto strength  = [&](Card::Rank first, Card::Rank second, bool suited) {
+        return strengths.at(Range::classIndex(first, second, suited));
+    };
+
+    EXPECT_GT(strength(Card::ACE, Card::ACE, false), 0.99);
+    EXPECT_GT(strength(Card::ACE, Card::ACE, false), strength(Card::ACE, Card::KING, true));
+    EXPECT_GT(strength(Card::ACE, Card::KING, true), strength(Card::ACE, Card::KING, false));
+    EXPECT_GT(strength(Card::JACK, Card::TEN, true), strength(Card::JACK, Card::FIVE, true));
+    EXPECT_LT(strength(Card::SEVEN, Card::TWO, false), 0.05);
+}
+
+TEST(RangeTrackerTest, knownCardsShouldBeRemovedFromTheRanges) {
+    Game         game;
+    RangeTracker tracker;
+
+    game.setInitialStack(1'000);
+    game.init({"hero", "villain 1", "villain 2"});
+
+    auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+    tracker.track(round);
+
+    EXPECT_FALSE(tracker.isTracked(1));
+    EXPECT_TRUE(tracker.isTracked(2));
+    EXPECT_TRUE(tracker.isTracked(3));
+    EXPECT_EQ(tracker.getRange(2).getWeight(Hand(card("AH"), card("AS"))), 0);
+    EXPECT_NEAR(tracker.getRange(2).getWeight(Hand(card("AS"), card("AD"))), 1.0 / (50 * 49 / 2), 1e-7);
+
+    round.call(1);
+    round.call(2);
+    round.check(3);
+    round.getBoard().setFlop({card("2C"), card("5D"), card("9H")});
+    round.check(2);
+
+    for (auto playerNum : {2, 3}) {
+        EXPECT_EQ(tracker.getRange(playerNum).getWeight(Hand(card("9H"), card("9S"))), 0);
+        EXPECT_EQ(tracker.getRange(playerNum).getWeight(Hand(card("KH"), card("2D"))), 0);
+        EXPECT_GT(tracker.getRange(playerNum).getWeight(Hand(card("9S"), card("9D"))), 0);
+        EXPECT_NEAR(totalWeight(tracker.getRange(playerNum)), 1, 1e-4);
+    }
+}
+
+TEST(RangeTrackerTest, villainActionsShouldNarrowTheirRange) {
+    Game         game;
+    RangeTracker tracker;
+
+    game.setInitialStack(1'000);
+    game.init({"hero", "villain 1", "villain 2"});
+
+    auto& round = game.newRound({50, 100}, {card("2H"), card("2S")}, 1);
+
+    tracker.track(round);
+
+    round.raiseTo(1, 300);
+    round.raiseTo(2, 900);
+
+    const auto& raiser = tracker.getRange(2);
+    const auto& waiter = tracker.getRange(3);
+    auto        aces   = Hand(card("AS"), card("AD"));
+    auto        trash  = Hand(card("7C"), card("2D"));
+
+    EXPECT_GT(raiser.getWeight(aces), 40 * raiser.getWeight(trash));
+    EXPECT_EQ(waiter.getWeight(aces), waiter.getWeight(trash));
+
+    round.fold(3);
+
+    EXPECT_GT(waiter.getWeight(trash), 10 * waiter.getWeight(aces));
+    // The hero actions do not change the villains range
+    auto raiserAces = raiser.getWeight(aces);
+
+    round.call(1);
+
+    EXPECT_EQ(raiser.getWeight(aces), raiserAces);
+}
+
+TEST(RangeTrackerTest, likelihoodsShouldBeConfigurable) {
+    ActionLikelihoods::class_likelihoods_t onlyAces {};
+    Game                                   game;
+
+    onlyAces.at(Range::classIndex(Card::ACE, Card::ACE, false)) = 1;
+
+    ActionLikelihoods likelihoods;
+
+    likelihoods.set(GameHandler::Round::FLOP, ActionType::BET, onlyAces);
+
+    RangeTracker tracker(likelihoods);
+
+    game.setInitialStack(1'000);
+    game.init({"hero", "villain"});
+
+    auto& round = game.newRound({50, 100}, {card("KH"), card("QH")}, 1);
+
+    tracker.track(round);
+
+    round.call(1);
+    round.check(2);
+    round.getBoard().setFlop({card("2C"), card("5D"), card("9H")});
+
+    const auto& range  = tracker.getRange(2);
+    auto        aces   = Hand(card("AS"), card("AD"));
+    auto        kings  = Hand(card("KS"), card("KD"));
+    auto        before = range.getWeight(aces) / range.getWeight(kings);
+
+    round.bet(2, 200);
+
+    EXPECT_NEAR(range.getWeight(aces) / range.getWeight(kings) / before, 1 / ActionLikelihoods::MIN_LIKELIHOOD, 1e-2);
+    EXPECT_THROW(likelihoods.set(GameHandler::Round::SHOWDOWN, ActionType::BET, onlyAces), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(likelihoods.get(GameHandler::Round::FLOP, ActionType::ALL_IN)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(tracker.getRange(1)), std::invalid_argument);
+}
+
+TEST(RangeTrackerTest, rangeUpdateLatencyShouldBeRecorded) {
+    static constexpr int32_t UPDATES_NUMBER = 100'000;
+    static constexpr int32_t ROUND_UPDATES  = 16;  // The range is reset on each round
+
+    ActionLikelihoods likelihoods;
+    Range             range;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int32_t update = 0; update < UPDATES_NUMBER; ++update) {
+        if (update % ROUND_UPDATES == 0) { range = Range(); }
+
+        range.update(likelihoods.get(update % 2 == 0 ? GameHandler::Round::FLOP : GameHandler::Round::TURN, ActionType::CHECK));
+    }
+
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start) / UPDATES_NUMBER;
+
+    RecordProperty("us_per_update", std::to_string(elapsed.count()));
+
+    EXPECT_NEAR(totalWeight(range), 1, 1e-4);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,462 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <game_handler/Board.hpp>
+#include <game_handler/CardFactory.hpp>
+
+/**
+ * @brief Validation and throughput harness of the 7 cards hand evaluators.
+ *
+ * - The exhaustive pass evaluates the 133,784,560 distinct 7 cards sets with `Board::getHandRank` and each registered
+ *   evaluator, then checks the hand ranks count against the known distribution.
+ * - The cross check pass deals random pairs of hands on a random board and checks that each registered evaluator orders them as
+ *   `Board::compareHands` does.
+ *
+ * An evaluator is plugged by adding it to EVALUATORS, it scores 7 cards so that a better hand has a greater score and its hand
+ * rank is `score >> CATEGORY_SHIFT`. The program exits with a failure status on any difference.
+ *
+ * Usage: evaluator_harness [--pairs <number>] [--threads <number>] [--skip-exhaustive]
+ */
+
+using GameHandler::Board;
+using GameHandler::Card;
+using GameHandler::Hand;
+using GameHandler::HandRank;
+
+using seven_cards_t = std::array<Card, GameHandler::TOTAL_CARDS_SIZE>;
+using score_t       = uint32_t;
+using evaluator_t   = std::function<score_t(const seven_cards_t&)>;
+
+static constexpr int32_t     DECK_SIZE        = GameHandler::RANK_CARDS_NUMBER * GameHandler::SUIT_CARDS_NUMBER;
+static constexpr int32_t     HAND_RANKS       = static_cast<int32_t>(HandRank::STRAIGHT_FLUSH) + 1;
+static constexpr int32_t     CATEGORY_SHIFT   = 20;
+static constexpr int32_t     KICKER_BITS      = 4;
+static constexpr int32_t     ACE_LOW          = 0;  // Rank of the ace in a wheel straight
+static constexpr uint64_t    DEFAULT_PAIRS    = 1'000'000;
+static constexpr std::size_t MAX_REPORTED     = 10;  // Differences printed by pass
+static constexpr uint64_t    SEVEN_CARDS_SETS = 133'784'560;
+
+// Number of 7 cards sets by hand rank
+static constexpr std::array<uint64_t, HAND_RANKS> EXPECTED_DISTRIBUTION = {
+    23'294'460,  // High card
+    58'627'800,  // Pair
+    31'433'400,  // Two pair
+    6'461'620,   // Trips
+    6'180'020,   // Straight
+    4'047'644,   // Flush
+    3'473'184,   // Full
+    224'848,     // Quads
+    41'584,      // Straight flush
+};
+
+static constexpr std::array<std::string_view, HAND_RANKS> HAND_RANK_NAMES = {
+    "High card", "Pair", "Two pair", "Trips", "Straight", "Flush", "Full", "Quads", "Straight flush"};
+
+/**
+ * @brief Straightforward evaluator on ranks bit masks, independent of the Board implementation.
+ */
+namespace ReferenceEvaluator {
+    using rank_mask_t = uint16_t;  // Bit n set for the rank n, the ace also sets the ACE_LOW bit
+
+    static constexpr rank_mask_t WHEEL_MASK = 0b1'1111;  // Ranks ACE_LOW to FIVE
+
+    static auto score(HandRank rank, std::initializer_list<int32_t> ranks) -> score_t {
+        auto    value = static_cast<score_t>(rank) << CATEGORY_SHIFT;
+        int32_t shift = CATEGORY_SHIFT;
+
+        for (auto cardRank : ranks) { value |= static_cast<score_t>(cardRank) << (shift -= KICKER_BITS); }
+
+        return value;
+    }
+
+    // The highest card rank of the best straight in the mask, 0 if there is none
+    static auto straightHigh(rank_mask_t mask) -> int32_t {
+        for (int32_t high = Card::Rank::ACE; high >= Card::Rank::FIVE; --high) {
+            auto straight = static_cast<rank_mask_t>(WHEEL_MASK << (high - Card::Rank::FIVE));
+
+            if ((mask & straight) == straight) { return high; }
+        }
+
+        return 0;
+    }
+
+    // The count highest ranks of the mask, the ACE_LOW bit excluded
+    static auto highest(rank_mask_t mask, int32_t count) -> std::array<int32_t, GameHandler::COMPARISON_CARDS_NUMBER> {
+        std::array<int32_t, GameHandler::COMPARISON_CARDS_NUMBER> ranks {};
+
+        for (int32_t cardRank = Card::Rank::ACE, found = 0; cardRank > ACE_LOW && found < count; --cardRank) {
+            if ((mask & (1U << cardRank)) != 0) { ranks.at(found++) = cardRank; }
+        }
+
+        return ranks;
+    }
+
+    static auto evaluate(const seven_cards_t& cards) -> score_t {
+        std::array<int32_t, Card::Rank::ACE + 1>                rankCounts {};
+        std::array<int32_t, GameHandler::SUIT_CARDS_NUMBER>     suitCounts {};
+        std::array<rank_mask_t, GameHandler::SUIT_CARDS_NUMBER> suitMasks {};
+        rank_mask_t                                             mask = 0;
+
+        for (const auto& card : cards) {
+            auto cardBit = static_cast<rank_mask_t>((1U << card.getRank()) | (card.getRank() == Card::Rank::ACE ? 1U : 0U));
+
+            rankCounts.at(card.getRank())++;
+            suitCounts.at(card.getSuit())++;
+            suitMasks.at(card.getSuit()) |= cardBit;
+            mask |= cardBit;
+        }
+
+        int32_t quads       = 0;
+        int32_t trips       = 0;
+        int32_t secondTrips = 0;
+        int32_t pair        = 0;
+        int32_t secondPair  = 0;
+        int32_t flushSuit   = -1;
+        // From the highest rank so the first trips or pair found is the best one
+        for (int32_t cardRank = Card::Rank::ACE; cardRank > ACE_LOW; --cardRank) {
+            if (rankCounts.at(cardRank) == GameHandler::QUADS_SIZE) {
+                quads = cardRank;
+            } else if (rankCounts.at(cardRank) == GameHandler::TRIPS_SIZE) {
+                if (trips == 0) {
+                    trips = cardRank;
+                } else {
+                    secondTrips = cardRank;
+                }
+            } else if (rankCounts.at(cardRank) == GameHandler::PAIR_SIZE) {
+                if (pair == 0) {
+                    pair = cardRank;
+                } else if (secondPair == 0) {
+                    secondPair = cardRank;
+                }
+            }
+        }
+
+        for (int32_t suit = 0; suit < GameHandler::SUIT_CARDS_NUMBER; ++suit) {
+            if (suitCounts.at(suit) >= GameHandler::FLUSH_SIZE) { flushSuit = suit; }
+        }
+
+        auto without = [&](std::initializer_list<int32_t> ranks) {
+            auto kickers = mask;
+
+            for (auto cardRank : ranks) { kickers &= static_cast<rank_mask_t>(~(1U << cardRank)); }
+
+            return kickers;
+        };
+
+        if (flushSuit != -1) {
+            if (auto high = straightHigh(suitMasks.at(flushSuit)); high != 0) { return score(HandRank::STRAIGHT_FLUSH, {high}); }
+        }
+
+        if (quads != 0) { return score(HandRank::QUADS, {quads, highest(without({quads}), 1)[0]}); }
+        if (trips != 0 && (secondTrips != 0 || pair != 0)) { return score(HandRank::FULL, {trips, std::max(secondTrips, pair)}); }
+
+        if (flushSuit != -1) {
+            auto flush = highest(suitMasks.at(flushSuit), GameHandler::FLUSH_SIZE);
+
+            return score(HandRank::FLUSH, {flush[0], flush[1], flush[2], flush[3], flush[4]});
+        }
+
+        if (auto high = straightHigh(mask); high != 0) { return score(HandRank::STRAIGHT, {high}); }
+
+        if (trips != 0) {
+            auto kickers = highest(without({trips}), 2);
+
+            return score(HandRank::TRIPS, {trips, kickers[0], kickers[1]});
+        }
+
+        if (secondPair != 0) { return score(HandRank::TWO_PAIR, {pair, secondPair, highest(without({pair, secondPair}), 1)[0]}); }
+
+        if (pair != 0) {
+            auto kickers = highest(without({pair}), 3);
+
+            return score(HandRank::PAIR, {pair, kickers[0], kickers[1], kickers[2]});
+        }
+
+        auto kickers = highest(mask, GameHandler::COMPARISON_CARDS_NUMBER);
+
+        return score(HandRank::HIGH_CARD, {kickers[0], kickers[1], kickers[2], kickers[3], kickers[4]});
+    }
+}  // namespace ReferenceEvaluator
+
+struct NamedEvaluator {
+    public:
+        std::string_view name;
+        evaluator_t      evaluate;
+};
+
+static const std::array<NamedEvaluator, 1> EVALUATORS = {{{"reference", ReferenceEvaluator::evaluate}}};
+
+struct Options {
+    public:
+        uint64_t pairs          = DEFAULT_PAIRS;
+        uint32_t threadsNumber  = std::max(1U, std::thread::hardware_concurrency());
+        bool     skipExhaustive = false;
+};
+
+static auto deck() -> const std::array<Card, DECK_SIZE>& {
+    static const auto cards = []() {
+        std::array<Card, DECK_SIZE> deckCards;
+
+        for (int32_t cardNum = 0; cardNum < DECK_SIZE; ++cardNum) {
+            deckCards.at(cardNum) = Card(static_cast<Card::Rank>(cardNum / GameHandler::SUIT_CARDS_NUMBER + Card::Rank::TWO),
+                                         static_cast<Card::Suit>(cardNum % GameHandler::SUIT_CARDS_NUMBER));
+        }
+
+        return deckCards;
+    }();
+
+    return cards;
+}
+
+static auto toString(const seven_cards_t& cards) -> std::string {
+    std::string text;
+
+    for (const auto& card : cards) { text += fmt::format("{} ", card); }
+
+    return text;
+}
+
+// Run task(threadNum) on threadsNumber threads and return the elapsed seconds
+template<typename Task> static auto runOnThreads(uint32_t threadsNumber, Task&& task) -> double {
+    auto start = std::chrono::steady_clock::now();
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (uint32_t threadNum = 0; threadNum < threadsNumber; ++threadNum) { threads.emplace_back(task, threadNum); }
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static auto printThroughput(std::string_view name, uint64_t evaluations, double seconds, uint32_t threadsNumber) -> void {
+    fmt::print("  {:<24} {:>14.0f} evaluations/s per core\n", name, static_cast<double>(evaluations) / seconds / threadsNumber);
+}
+
+/**
+ * @brief Count the hand ranks of every 7 cards set, the first 5 cards are the board so a Board is built once for 1 to 1,081 hands.
+ */
+static auto exhaustivePass(const Options& options) -> bool {
+    using distribution_t = std::array<std::atomic<uint64_t>, HAND_RANKS>;
+
+    const auto&                 cards = deck();
+    distribution_t              boardDistribution {};
+    std::vector<distribution_t> evaluatorsDistribution(EVALUATORS.size());
+    std::atomic<int32_t>        nextFirstCard = 0;
+    std::atomic<uint64_t>       differences   = 0;
+    std::mutex                  printMutex;
+
+    fmt::print("Exhaustive pass on {} threads\n", options.threadsNumber);
+
+    auto seconds = runOnThreads(options.threadsNumber, [&](uint32_t /* threadNum */) {
+        std::array<uint64_t, HAND_RANKS>              boardCounts {};
+        std::vector<std::array<uint64_t, HAND_RANKS>> evaluatorsCounts(EVALUATORS.size());
+        seven_cards_t                                 set;
+        // The sets are distributed by first card, the lowest ones have far more sets
+        for (int32_t c0 = nextFirstCard++; c0 < DECK_SIZE - 6; c0 = nextFirstCard++) {
+            for (int32_t c1 = c0 + 1; c1 < DECK_SIZE - 5; ++c1) {
+                for (int32_t c2 = c1 + 1; c2 < DECK_SIZE - 4; ++c2) {
+                    for (int32_t c3 = c2 + 1; c3 < DECK_SIZE - 3; ++c3) {
+                        for (int32_t c4 = c3 + 1; c4 < DECK_SIZE - 2; ++c4) {
+                            Board board({cards.at(c0), cards.at(c1), cards.at(c2), cards.at(c3), cards.at(c4)});
+
+                            set = {cards.at(c0), cards.at(c1), cards.at(c2), cards.at(c3), cards.at(c4)};
+
+                            for (int32_t c5 = c4 + 1; c5 < DECK_SIZE - 1; ++c5) {
+                                for (int32_t c6 = c5 + 1; c6 < DECK_SIZE; ++c6) {
+                                    set[5]         = cards.at(c5);
+                                    set[6]         = cards.at(c6);
+                                    auto boardRank = static_cast<int32_t>(board.getHandRank(Hand(set[5], set[6])));
+
+                                    boardCounts.at(boardRank)++;
+
+                                    for (std::size_t i = 0; i < EVALUATORS.size(); ++i) {
+                                        auto rank = static_cast<int32_t>(EVALUATORS.at(i).evaluate(set) >> CATEGORY_SHIFT);
+
+                                        evaluatorsCounts[i].at(rank)++;
+
+                                        if (rank != boardRank && differences++ < MAX_REPORTED) {
+                                            std::lock_guard lock(printMutex);
+
+                                            fmt::print("  {}: Board rank {} but {} rank {}\n", toString(set),
+                                                       HAND_RANK_NAMES.at(boardRank), EVALUATORS.at(i).name, HAND_RANK_NAMES.at(rank));
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        for (int32_t rank = 0; rank < HAND_RANKS; ++rank) {
+            boardDistribution.at(rank) += boardCounts.at(rank);
+
+            for (std::size_t i = 0; i < EVALUATORS.size(); ++i) { evaluatorsDistribution[i].at(rank) += evaluatorsCounts[i].at(rank); }
+        }
+    });
+
+    bool valid = true;
+
+    fmt::print("  {:<16} {:>12} {:>12}", "Hand rank", "Expected", "Board");
+
+    for (const auto& evaluator : EVALUATORS) { fmt::print(" {:>12}", evaluator.name); }
+
+    fmt::print("\n");
+
+    for (int32_t rank = 0; rank < HAND_RANKS; ++rank) {
+        auto expected = EXPECTED_DISTRIBUTION.at(rank);
+
+        valid = valid && boardDistribution.at(rank) == expected;
+
+        fmt::print("  {:<16} {:>12} {:>12}", HAND_RANK_NAMES.at(rank), expected, boardDistribution.at(rank).load());
+
+        for (const auto& distribution : evaluatorsDistribution) {
+            valid = valid && distribution.at(rank) == expected;
+
+            fmt::print(" {:>12}", distribution.at(rank).load());
+        }
+
+        fmt::print("\n");
+    }
+
+    fmt::print("  {} sets in {:.1f} s, {} hand rank differences, distribution {}\n", SEVEN_CARDS_SETS, seconds, differences.load(),
+               valid ? "valid" : "INVALID");
+    printThroughput("Board + evaluators", SEVEN_CARDS_SETS, seconds, options.threadsNumber);
+
+    return valid && differences == 0;
+}
+
+/**
+ * @brief Compare random pairs of hands with Board::compareHands and each evaluator, then time each of them on the same deals.
+ */
+static auto crossCheckPass(const Options& options) -> bool {
+    struct Deal {
+        public:
+            seven_cards_t set1;
+            seven_cards_t set2;
+    };
+
+    const auto&           cards       = deck();
+    auto                  pairsNumber = options.pairs / options.threadsNumber;
+    std::atomic<uint64_t> differences = 0;
+    std::mutex            printMutex;
+    std::vector<Deal>     deals(pairsNumber * options.threadsNumber);
+
+    fmt::print("Cross check pass of {} pairs on {} threads\n", deals.size(), options.threadsNumber);
+
+    runOnThreads(options.threadsNumber, [&](uint32_t threadNum) {
+        std::mt19937                   random(threadNum);
+        std::array<int32_t, DECK_SIZE> order {};
+        std::span<Deal>                threadDeals(deals.data() + threadNum * pairsNumber, pairsNumber);
+
+        std::iota(order.begin(), order.end(), 0);
+
+        for (auto& deal : threadDeals) {
+            // A partial Fisher-Yates shuffle for the 5 board cards and the 2 hands
+            for (int32_t i = 0; i < GameHandler::TOTAL_CARDS_SIZE + GameHandler::HAND_CARDS_NUMBER; ++i) {
+                std::swap(order.at(i), order.at(std::uniform_int_distribution<int32_t>(i, DECK_SIZE - 1)(random)));
+            }
+
+            for (int32_t i = 0; i < GameHandler::BOARD_CARDS_NUMBER; ++i) {
+                deal.set1.at(i) = cards.at(order.at(i));
+                deal.set2.at(i) = cards.at(order.at(i));
+            }
+
+            deal.set1[5] = cards.at(order[5]);
+            deal.set1[6] = cards.at(order[6]);
+            deal.set2[5] = cards.at(order[7]);
+            deal.set2[6] = cards.at(order[8]);
+        }
+    });
+
+    auto boardSeconds = runOnThreads(options.threadsNumber, [&](uint32_t threadNum) {
+        for (const auto& deal : std::span<Deal>(deals.data() + threadNum * pairsNumber, pairsNumber)) {
+            Board board({deal.set1[0], deal.set1[1], deal.set1[2], deal.set1[3], deal.set1[4]});
+            auto  boardOrder = board.compareHands(Hand(deal.set1[5], deal.set1[6]), Hand(deal.set2[5], deal.set2[6]));
+
+            for (const auto& evaluator : EVALUATORS) {
+                auto score1 = evaluator.evaluate(deal.set1);
+                auto score2 = evaluator.evaluate(deal.set2);
+                auto order  = score1 > score2 ? 1 : score1 < score2 ? -1 : 0;
+
+                if (order != boardOrder && differences++ < MAX_REPORTED) {
+                    std::lock_guard lock(printMutex);
+
+                    fmt::print("  {}vs {}: Board {} but {} {}\n", toString(deal.set1), toString(deal.set2), boardOrder,
+                               evaluator.name, order);
+                }
+            }
+        }
+    });
+
+    fmt::print("  {} order differences\n", differences.load());
+    // Both hands are evaluated for each pair
+    printThroughput("Board::compareHands", 2 * deals.size(), boardSeconds, options.threadsNumber);
+
+    for (const auto& evaluator : EVALUATORS) {
+        std::atomic<score_t> checksum = 0;  // Keeps the evaluations from being optimized out
+
+        auto seconds = runOnThreads(options.threadsNumber, [&](uint32_t threadNum) {
+            score_t threadChecksum = 0;
+
+            for (const auto& deal : std::span<Deal>(deals.data() + threadNum * pairsNumber, pairsNumber)) {
+                threadChecksum ^= evaluator.evaluate(deal.set1) ^ evaluator.evaluate(deal.set2);
+            }
+
+            checksum ^= threadChecksum;
+        });
+
+        printThroughput(evaluator.name, 2 * deals.size(), seconds, options.threadsNumber);
+    }
+
+    return differences == 0;
+}
+
+static auto parseOptions(int argc, char** argv) -> Options {
+    Options          options;
+    std::span<char*> arguments(argv + 1, static_cast<std::size_t>(argc - 1));
+
+    for (std::size_t i = 0; i < arguments.size(); ++i) {
+        std::string_view argument = arguments[i];
+
+        if (argument == "--skip-exhaustive") {
+            options.skipExhaustive = true;
+        } else if (argument == "--pairs" && i + 1 < arguments.size()) {
+            options.pairs = std::stoull(arguments[++i]);
+        } else if (argument == "--threads" && i + 1 < arguments.size()) {
+            options.threadsNumber = std::max(1UL, std::stoul(arguments[++i]));
+        } else {
+            throw std::invalid_argument(fmt::format("Unknown argument `{}`", argument));
+        }
+    }
+
+    return options;
+}
+
+auto main(int argc, char** argv) -> int {
+    try {
+        auto options = parseOptions(argc, argv);
+        bool valid   = crossCheckPass(options);
+
+        if (!options.skipExhaustive) { valid = exhaustivePass(options) && valid; }
+
+        return valid ? EXIT_SUCCESS : EXIT_FAILURE;
+    } catch (const std::exception& error) {
+        fmt::print(stderr, "{}\n", error.what());
+
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,300 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+#include <game_handler/CardFactory.hpp>
+#include <game_handler/Game.hpp>
+#include <game_handler/RoundReplay.hpp>
+
+using GameHandler::Blinds;
+using GameHandler::Board;
+using GameHandler::Game;
+using GameHandler::Hand;
+using GameHandler::LoggedAction;
+using GameHandler::Round;
+using GameHandler::RoundLog;
+using GameHandler::RoundReplayer;
+using GameHandler::Factory::card;
+
+using Type = LoggedAction::Type;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+
+/**
+ * @brief Seeded random deals, the same boards and hands are benchmarked from one run to the next.
+ */
+class Deals {
+    public:
+        static constexpr std::size_t DEALS_NUMBER = 1'024;
+
+        struct Deal {
+            public:
+                Board::board_t board;
+                Hand           hand1;
+                Hand           hand2;
+        };
+
+        static auto instance() -> const Deals& {
+            static const Deals deals;
+
+            return deals;
+        }
+
+        [[nodiscard]] auto getDeals() const -> const std::vector<Deal>& { return _deals; }
+        [[nodiscard]] auto getCardNames() const -> const std::vector<std::string>& { return _cardNames; }
+
+    private:
+        std::vector<Deal>        _deals;
+        std::vector<std::string> _cardNames;
+
+        Deals() {
+            std::vector<std::string> deck;
+
+            for (const auto& [name, prototype] : GameHandler::Factory::CARD_PROTOTYPES) {
+                if (!prototype.isUnknown()) { deck.push_back(name); }
+            }
+            // The prototypes map order is not specified
+            std::ranges::sort(deck);
+
+            std::mt19937 random(42);
+
+            for (std::size_t i = 0; i < DEALS_NUMBER; ++i) {
+                std::ranges::shuffle(deck, random);
+
+                _deals.push_back({.board = {card(deck[0]), card(deck[1]), card(deck[2]), card(deck[3]), card(deck[4])},
+                                  .hand1 = Hand(card(deck[5]), card(deck[6])),
+                                  .hand2 = Hand(card(deck[7]), card(deck[8]))});
+                _cardNames.push_back(deck[0]);
+            }
+        }
+};
+
+/**
+ * @brief A 6 handed round: open raise, 3-bet and call pre-flop, bet and call on the flop, checked turn, bet and call on the river.
+ */
+static auto sixHandedRoundLog() -> RoundLog {
+    RoundLog log;
+
+    log.blinds    = Blinds(50, 100);
+    log.dealerNum = 1;
+    log.board     = {card("AS"), card("KD"), card("7C"), card("2H"), card("9S")};
+
+    for (int32_t playerNum = 1; playerNum <= 6; ++playerNum) { log.stacks.push_back(10'000); }
+
+    log.hands = {Hand(card("QH"), card("QC")), Hand(card("4D"), card("3D")), Hand(card("AH"), card("JH")),
+                 Hand(card("KS"), card("KC")), Hand(card("8C"), card("6C")), Hand(card("TD"), card("TH"))};
+    // The small blind is player 2 and the big blind player 3
+    log.actions = {{.type = Type::RAISE_TO, .playerNum = 4, .amount = 300},
+                   {.type = Type::FOLD, .playerNum = 5},
+                   {.type = Type::FOLD, .playerNum = 6},
+                   {.type = Type::CALL, .playerNum = 1},
+                   {.type = Type::FOLD, .playerNum = 2},
+                   {.type = Type::RAISE_TO, .playerNum = 3, .amount = 1'000},
+                   {.type = Type::CALL, .playerNum = 4},
+                   {.type = Type::FOLD, .playerNum = 1},
+                   {.type = Type::BET, .playerNum = 3, .amount = 1'200},
+                   {.type = Type::CALL, .playerNum = 4},
+                   {.type = Type::CHECK, .playerNum = 3},
+                   {.type = Type::CHECK, .playerNum = 4},
+                   {.type = Type::BET, .playerNum = 3, .amount = 2'500},
+                   {.type = Type::CALL, .playerNum = 4},
+                   {.type = Type::SHOWDOWN}};
+
+    return log;
+}
+
+/**
+ * @brief Play a round with an open raise and a call pre-flop, checks until the river, then a half pot bet and a call.
+ */
+static auto playRound(Round& round, int32_t bigBlind) -> void {
+    auto    street        = round.getCurrentStreet();
+    int32_t streetActions = 0;
+
+    while (round.isInProgress()) {
+        if (round.waitingShowdown()) {
+            round.showdown();
+
+            continue;
+        }
+
+        if (round.getCurrentStreet() != street) {
+            street        = round.getCurrentStreet();
+            streetActions = 0;
+        }
+
+        auto playerNum = round.getCurrentPlayerNum();
+
+        if (street == Round::Street::PREFLOP) {
+            if (streetActions == 0) {
+                round.raiseTo(playerNum, 3 * bigBlind);
+            } else if (streetActions == 1) {
+                round.call(playerNum);
+            } else {
+                round.fold(playerNum);
+            }
+        } else if (street == Round::Street::RIVER) {
+            if (streetActions == 0) {
+                round.bet(playerNum, round.getPot() / 2);
+            } else {
+                round.call(playerNum);
+            }
+        } else {
+            round.check(playerNum);
+        }
+
+        ++streetActions;
+    }
+}
+
+/**
+ * @brief A 6 handed game of roundsNumber rounds played with the Game API, the dealer button moves at each round.
+ */
+static auto sixHandedGame(int32_t roundsNumber) -> Game {
+    static constexpr int32_t PLAYERS_NUMBER = 6;
+
+    const auto& deals = Deals::instance().getDeals();
+    Game        game;
+    Blinds      blinds(50, 100);
+
+    game.setBuyIn(10);
+    game.setMultipliers(2);
+    game.setInitialStack(1'000'000);
+    game.init({"hero", "villain 1", "villain 2", "villain 3", "villain 4", "villain 5"});
+
+    for (int32_t roundNum = 0; roundNum < roundsNumber; ++roundNum) {
+        const auto& deal  = deals[static_cast<std::size_t>(roundNum) % deals.size()];
+        auto&       round = game.newRound(blinds, deal.hand1, roundNum % PLAYERS_NUMBER + 1);
+
+        round.getBoard().setCards(deal.board);
+
+        for (int32_t playerNum = 2; playerNum <= PLAYERS_NUMBER; ++playerNum) { round.setPlayerHand(deal.hand2, playerNum); }
+
+        playRound(round, blinds.BB());
+    }
+
+    game.end();
+
+    return game;
+}
+
+static auto boardGetHandRank(benchmark::State& state) -> void {
+    const auto&        deals = Deals::instance().getDeals();
+    std::vector<Board> boards(deals.size());
+    std::size_t        dealNum = 0;
+
+    for (std::size_t i = 0; i < deals.size(); ++i) { boards[i] = Board(deals[i].board); }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(boards[dealNum].getHandRank(deals[dealNum].hand1));
+
+        dealNum = (dealNum + 1) % deals.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static auto boardCompareHands(benchmark::State& state) -> void {
+    const auto&        deals = Deals::instance().getDeals();
+    std::vector<Board> boards(deals.size());
+    std::size_t        dealNum = 0;
+
+    for (std::size_t i = 0; i < deals.size(); ++i) { boards[i] = Board(deals[i].board); }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(boards[dealNum].compareHands(deals[dealNum].hand1, deals[dealNum].hand2));
+
+        dealNum = (dealNum + 1) % deals.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static auto boardSetStreets(benchmark::State& state) -> void {
+    const auto& deals   = Deals::instance().getDeals();
+    std::size_t dealNum = 0;
+
+    for (auto _ : state) {
+        const auto& cards = deals[dealNum].board;
+        Board       board;
+
+        board.setFlop({cards[0], cards[1], cards[2]});
+        board.setTurn(cards[3]);
+        board.setRiver(cards[4]);
+        benchmark::DoNotOptimize(board);
+
+        dealNum = (dealNum + 1) % deals.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static auto handConstruction(benchmark::State& state) -> void {
+    const auto& deals   = Deals::instance().getDeals();
+    std::size_t dealNum = 0;
+
+    for (auto _ : state) {
+        const auto& cards = deals[dealNum].board;
+        Hand        hand(cards[0], cards[1]);
+
+        benchmark::DoNotOptimize(hand);
+
+        dealNum = (dealNum + 1) % deals.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static auto cardFactoryCreate(benchmark::State& state) -> void {
+    const auto& cardNames = Deals::instance().getCardNames();
+    std::size_t cardNum   = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GameHandler::Factory::CardFactory::create(cardNames[cardNum]));
+
+        cardNum = (cardNum + 1) % cardNames.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static auto roundActionsSequence(benchmark::State& state) -> void {
+    auto          log = sixHandedRoundLog();
+    RoundReplayer replayer;
+
+    for (auto _ : state) { benchmark::DoNotOptimize(replayer.replay(log).getPot()); }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(log.actions.size()));
+    state.SetLabel("items are actions");
+}
+
+static auto roundToJson(benchmark::State& state) -> void {
+    auto          log = sixHandedRoundLog();
+    RoundReplayer replayer;
+    const auto&   round = replayer.replay(log);
+
+    for (auto _ : state) { benchmark::DoNotOptimize(round.toJson()); }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static auto gameDump(benchmark::State& state) -> void {
+    auto roundsNumber = static_cast<int32_t>(state.range(0));
+    auto game         = sixHandedGame(roundsNumber);
+
+    for (auto _ : state) { benchmark::DoNotOptimize(game.dump()); }
+
+    state.SetItemsProcessed(state.iterations() * roundsNumber);
+    state.SetLabel("items are rounds");
+}
+
+BENCHMARK(boardGetHandRank);
+BENCHMARK(boardCompareHands);
+BENCHMARK(boardSetStreets);
+BENCHMARK(handConstruction);
+BENCHMARK(cardFactoryCreate);
+BENCHMARK(roundActionsSequence);
+BENCHMARK(roundToJson);
+BENCHMARK(gameDump)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -64,8 +64,11 @@ namespace GameHandler {
             auto compareHands(const Hand& hand1, const Hand& hand2) -> int;
 
             [[nodiscard]] auto toJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
             [[nodiscard]] auto toDetailedJson() const -> json;
 
+            [[nodiscard]] static auto fromJson(JsonReader& reader) -> Board;
+
         private:
             board_t  _cards;
             rank_f_t _rankFrequencies {};
@@ -85,7 +88,7 @@ namespace GameHandler {
             auto _countPossibleStraights(int32_t otherCards, std::optional<rank_f_t> frequencies = std::nullopt) -> int32_t;
             auto _computeRankFrequencies(std::optional<Hand> hand = std::nullopt) -> rank_f_t;
             auto _computeSuitFrequencies(std::optional<Hand> hand = std::nullopt) -> suit_f_t;
-            auto _isStraightFlush(const all_cards_t& cards, rank_f_t& rankF, suit_f_t& suitF) -> bool;
+            auto _isStraightFlush(const all_cards_t& cards, const suit_f_t& suitF) -> bool;
 
             auto _hasPossibleFlush() -> bool;
             auto _hasPossibleFlushDraw() -> bool;
@@ -104,7 +107,7 @@ namespace GameHandler {
                 -> combo_t;
             auto _trimCombo(HandRank rank, combo_t& combo) -> void;
             auto _extractCombo(const all_cards_t& cards, HandRank rank, rank_f_t& rankF, suit_f_t& suitF) -> combo_t;
-            auto _extractHigherCards(all_cards_t& cards, HandRank rank, const combo_t& combo) -> best_hand_t;
+            auto _extractHigherCards(all_cards_t& cards, const combo_t& combo) -> best_hand_t;
             auto _getHandRankAndBestCombo(const Hand& value) -> std::pair<HandRank, best_hand_t>;
     };
 }  // namespace GameHandler
\ No newline at end of file
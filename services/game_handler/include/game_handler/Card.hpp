@@ -6,6 +6,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include <game_handler/JsonReader.hpp>
+#include <game_handler/JsonWriter.hpp>
 #include <logger/Logger.hpp>
 
 namespace GameHandler {
@@ -76,6 +78,9 @@ namespace GameHandler {
             [[nodiscard]] auto isUnknown() const -> bool { return _suit == Suit::UNKNOWN || _rank == Rank::UNDEFINED; };
 
             [[nodiscard]] auto toJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
+
+            [[nodiscard]] static auto fromJson(JsonReader& reader) -> Card;
 
         private:
             Rank _rank;
@@ -1,10 +1,14 @@
 #pragma once
 
-#include <array>
+#include <filesystem>
+#include <functional>
+#include <vector>
 
+#include <game_handler/GameResults.hpp>
 #include <game_handler/Round.hpp>
 
 namespace GameHandler {
+    using std::chrono::duration_cast;
     using std::chrono::system_clock;
     using std::chrono::time_point;
 
@@ -14,6 +18,15 @@ namespace GameHandler {
               : runtime_error(arg) {};
     };
 
+    // Compact summary kept in memory for a round spilled to the rounds segment file
+    struct RoundSummary {
+        public:
+            std::streamoff offset = 0;  // Offset of the round JSON line in the segment file
+            std::size_t    size   = 0;
+            int32_t        pot    = 0;
+            bool           won    = false;
+    };
+
     class Game {
         public:
             Game()                  = default;
@@ -26,39 +39,66 @@ namespace GameHandler {
             auto operator=(Game&& other) noexcept -> Game&;
 
             auto getCurrentRound() -> Round& { return _rounds.back(); };
-            auto getPlayers() -> std::array<Player, 3>& { return _players; };
+            auto getPlayers() -> std::vector<Player>& { return _players; };
 
             [[nodiscard]] auto hasNoRound() const -> bool { return _rounds.empty(); };
             [[nodiscard]] auto isOver() const -> bool { return _ended; };
+            [[nodiscard]] auto isWon() const -> bool { return _isGameWon(); };
+            [[nodiscard]] auto isComplete() const -> bool { return _complete; };
+            [[nodiscard]] auto getDuration() const -> seconds { return duration_cast<seconds>(_endTime - _startTime); };
             [[nodiscard]] auto getBuyIn() const -> int32_t { return _buyIn; };
             [[nodiscard]] auto getMultipliers() const -> int32_t { return _multipliers; };
             [[nodiscard]] auto getInitialStack() const -> int32_t { return _initialStack; };
+            [[nodiscard]] auto getPlayersNumber() const -> int32_t { return static_cast<int32_t>(_players.size()); };
             [[nodiscard]] auto getPlayer(int32_t playerNum) const -> const Player&;
+            [[nodiscard]] auto getRoundsNumber() const -> std::size_t { return _spilledRounds.size() + _rounds.size(); };
+            [[nodiscard]] auto getResidentRoundsNumber() const -> std::size_t { return _rounds.size(); };
+            [[nodiscard]] auto getSpilledRounds() const -> const std::vector<RoundSummary>& { return _spilledRounds; };
+            // The hero results of the ended rounds, updated when a round is finalized
+            [[nodiscard]] auto getResults() const -> const GameResults& { return _results; };
 
             auto setBuyIn(int32_t buyIn) -> void { _buyIn = buyIn; }
             auto setMultipliers(int32_t multipliers) -> void { _multipliers = multipliers; }
             auto setInitialStack(int32_t stack) -> void { _initialStack = stack; };
             auto setComplete(bool complete) -> void { _complete = complete; }
+            auto spillRoundsTo(const std::filesystem::path& segmentPath) -> void;
+            auto setHandHistoryPath(const std::filesystem::path& path) -> void { _handHistoryPath = path; }
 
-            auto init(std::string_view player1Name, std::string_view player2Name, std::string_view player3Name) -> void;
+            auto init(const std::vector<std::string>& playersName) -> void;
             auto newRound(const Blinds& blinds, const Hand& hand, int32_t dealerNumber) -> Round&;
             auto end() -> void;
+            auto forEachRound(const std::function<void(const Round&)>& callback) const -> void;
 
             [[nodiscard]] auto toJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
+            [[nodiscard]] auto dump() const -> std::string;
+
+            [[nodiscard]] static auto fromJson(std::string_view json) -> Game;
+            [[nodiscard]] static auto fromJsonFile(const std::filesystem::path& path) -> Game;
 
         private:
-            std::vector<Round>       _rounds;
-            std::array<Player, 3>    _players;  // Player 1 is the Hero, others are Villains
-            time_point<system_clock> _startTime;
-            time_point<system_clock> _endTime;
-            int32_t                  _buyIn        = 0;
-            int32_t                  _multipliers  = 2;
-            int32_t                  _initialStack = 0;
-            bool                     _complete     = true;
-            bool                     _ended        = false;
+            std::vector<Round>        _rounds;
+            std::vector<RoundSummary> _spilledRounds;
+            std::vector<std::string>  _roundsFragment;  // Serialized JSON of the first ended rounds still in memory
+            std::vector<Player>       _players;  // Player 1 is the Hero, others are Villains, ordered by seat number
+            GameResults               _results;
+            std::filesystem::path     _segmentPath;  // The ended rounds are spilled to this file when set
+            std::filesystem::path     _handHistoryPath;  // The binary hand history is written to this file on end() when set
+            time_point<system_clock>  _startTime;
+            time_point<system_clock>  _endTime;
+            std::streamoff            _segmentSize  = 0;
+            int32_t                   _buyIn        = 0;
+            int32_t                   _multipliers  = 2;
+            int32_t                   _initialStack = 0;
+            bool                      _complete     = true;
+            bool                      _ended        = false;
 
             [[nodiscard]] auto _computeBalance() const -> int32_t;
             [[nodiscard]] auto _isGameWon() const -> bool;
+
+            auto _finalizeEndedRounds() -> void;
+            auto _spillRoundsFragment() -> void;
+            auto _forEachSpilledRound(const std::function<void(std::string_view)>& callback) const -> void;
     };
 }  // namespace GameHandler
 
@@ -68,15 +108,17 @@ namespace fmt {
 
     template<> struct formatter<Game> : formatter<string_view> {
             template<typename FormatContext> auto format(const Game& game, FormatContext& ctx) const {
-                return fmt::format_to(ctx.out(),
-                                      "Game information:\n\tBuy-in: {}\n\tPrize pool: {}\n\tInitial stack: "
-                                      "{}\n\tPlayer 1: {}\n\tPlayer 2: {}\n\tPlayer 3: {}",
-                                      game.getBuyIn(),
-                                      game.getBuyIn() * game.getMultipliers(),
-                                      game.getInitialStack(),
-                                      game.getPlayer(1).getName(),
-                                      game.getPlayer(2).getName(),
-                                      game.getPlayer(3).getName());
+                auto out = fmt::format_to(ctx.out(),
+                                          "Game information:\n\tBuy-in: {}\n\tPrize pool: {}\n\tInitial stack: {}",
+                                          game.getBuyIn(),
+                                          game.getBuyIn() * game.getMultipliers(),
+                                          game.getInitialStack());
+
+                for (int32_t playerNum = 1; playerNum <= game.getPlayersNumber(); ++playerNum) {
+                    out = fmt::format_to(out, "\n\tPlayer {}: {}", playerNum, game.getPlayer(playerNum).getName());
+                }
+
+                return out;
             }
     };
 }  // namespace fmt
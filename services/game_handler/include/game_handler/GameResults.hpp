@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <map>
+
+#include <game_handler/JsonReader.hpp>
+#include <game_handler/JsonWriter.hpp>
+#include <game_handler/Round.hpp>
+
+namespace GameHandler {
+    struct ChipsResult {
+        public:
+            int64_t rounds = 0;
+            int64_t chips  = 0;  // Won, negative when lost
+
+            auto add(int64_t roundChips) -> void {
+                rounds++;
+                chips += roundChips;
+            }
+
+            auto merge(const ChipsResult& other) -> void {
+                rounds += other.rounds;
+                chips  += other.chips;
+            }
+
+            auto operator==(const ChipsResult& other) const -> bool = default;
+    };
+
+    /**
+     * @brief The hero chips result of the rounds, broken down by big blind, position, last street and showdown.
+     *
+     * The street of a round is the street the hero folded on, the showdown when the hero went to a contested showdown, the
+     * last street with an action otherwise. The results of several games merge into the results of all of them.
+     */
+    class GameResults {
+        public:
+            using blind_levels_t = std::map<int32_t, ChipsResult>;  // By big blind
+            using positions_t    = std::array<ChipsResult, MAX_SEATS>;
+            using streets_t      = std::array<ChipsResult, STREET_NUMBER>;
+
+            [[nodiscard]] auto getByBlindLevel() const -> const blind_levels_t& { return _blindLevels; }
+            [[nodiscard]] auto getByPosition() const -> const positions_t& { return _positions; }
+            [[nodiscard]] auto getByStreet() const -> const streets_t& { return _streets; }
+            [[nodiscard]] auto getShowdown() const -> const ChipsResult& { return _showdown; }
+            [[nodiscard]] auto getNonShowdown() const -> const ChipsResult& { return _nonShowdown; }
+            [[nodiscard]] auto getTotal() const -> ChipsResult;
+
+            // Add the result of an ended round
+            auto add(const Round& round) -> void;
+            auto merge(const GameResults& other) -> void;
+
+            [[nodiscard]] auto toJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
+
+            [[nodiscard]] static auto fromJson(JsonReader& reader) -> GameResults;
+
+            auto operator==(const GameResults& other) const -> bool = default;
+
+        private:
+            blind_levels_t _blindLevels;
+            positions_t    _positions {};
+            streets_t      _streets {};
+            ChipsResult    _showdown;
+            ChipsResult    _nonShowdown;
+    };
+}  // namespace GameHandler
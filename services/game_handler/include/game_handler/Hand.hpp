@@ -45,8 +45,11 @@ namespace GameHandler {
             [[nodiscard]] auto isSet() const -> bool { return !_firstCard.isUnknown() && !_secondCard.isUnknown(); };
 
             [[nodiscard]] auto toJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
             [[nodiscard]] auto toDetailedJson() const -> json;
 
+            [[nodiscard]] static auto fromJson(JsonReader& reader) -> Hand;
+
         private:
             Card             _firstCard;
             Card             _secondCard;
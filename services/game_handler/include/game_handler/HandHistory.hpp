@@ -0,0 +1,198 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <span>
+
+#include <game_handler/Game.hpp>
+
+namespace GameHandler {
+    static constexpr std::array<char, 4> HAND_HISTORY_MAGIC   = {'P', 'T', 'H', 'H'};
+    static constexpr uint16_t            HAND_HISTORY_VERSION = 1;
+
+    class invalid_hand_history : public std::runtime_error {
+        public:
+            explicit invalid_hand_history(const std::string& arg)
+              : runtime_error(arg) {};
+    };
+
+    /**
+     * @brief Binary hand history encoding helpers, the multi bytes integers are little endian.
+     *
+     * File layout (version 1):
+     *  - Header: magic `PTHH`, u16 version, u8 players number, u8 flags (complete, won), varints buy-in, multipliers,
+     *    initial stack and duration in seconds.
+     *  - String table: the players name, each one as a varint size followed by its bytes.
+     *  - Varint rounds number, then each round as a u32 size followed by its body.
+     *  - Round body: u8 dealer, u8 flags (won), 5 board cards, 2 cards per player, varints small blind, big blind and pot,
+     *    the varint start then end stack of each player, the ranking as a u8 steps number then a u8 players number and the
+     *    players number of each step, then for each street a varint actions number, the fixed 4 bytes action records
+     *    (u8 action, u8 player, u16 elapsed seconds) and the varint amount of each action.
+     *  - A card is one byte, `rank << 2 | suit`, 0xFF for an unknown card.
+     */
+    namespace HandHistoryFormat {
+        static constexpr uint8_t     UNKNOWN_CARD        = 0xFF;
+        static constexpr uint8_t     COMPLETE_FLAG       = 0x01;
+        static constexpr uint8_t     WON_FLAG            = 0x02;
+        static constexpr std::size_t ACTION_RECORD_SIZE  = 4;
+        static constexpr std::size_t ROUND_SIZE_BYTES    = 4;
+        static constexpr int32_t     RECORDED_STREETS    = 4;  // Pre-flop, flop, turn and river
+        static constexpr uint8_t     VARINT_PAYLOAD_MASK = 0x7F;
+        static constexpr uint8_t     VARINT_CONTINUE_BIT = 0x80;
+        static constexpr int32_t     VARINT_PAYLOAD_BITS = 7;
+
+        inline auto readVarint(const uint8_t*& cursor, const uint8_t* end) -> uint64_t {
+            uint64_t value = 0;
+
+            for (int32_t shift = 0; cursor < end; shift += VARINT_PAYLOAD_BITS) {
+                auto byte = *cursor++;
+
+                value |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK) << shift;
+
+                if ((byte & VARINT_CONTINUE_BIT) == 0) { return value; }
+            }
+
+            throw invalid_hand_history("Truncated varint");
+        }
+
+        inline auto readU16(const uint8_t* cursor) -> uint16_t {
+            return static_cast<uint16_t>(cursor[0] | (cursor[1] << 8));  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        }
+
+        inline auto decodeCard(uint8_t byte) -> Card {
+            if (byte == UNKNOWN_CARD) { return {}; }
+
+            return {static_cast<Card::Rank>(byte >> 2), static_cast<Card::Suit>(byte & 0x3)};
+        }
+    }  // namespace HandHistoryFormat
+
+    /**
+     * @brief Serialize a game in the binary hand history format, see HandHistoryFormat for the layout.
+     */
+    class HandHistoryWriter {
+        public:
+            HandHistoryWriter() = delete;
+
+            [[nodiscard]] static auto encode(const Game& game) -> std::string;
+
+            static auto write(const Game& game, const std::filesystem::path& path) -> void;
+    };
+
+    /**
+     * @brief View on a round record of a mapped hand history, the values are decoded on access.
+     */
+    class RoundView {
+        public:
+            RoundView(std::span<const uint8_t> record, int32_t playersNumber);
+
+            [[nodiscard]] auto getDealerNum() const -> int32_t { return _record[0]; }
+            [[nodiscard]] auto hasWon() const -> bool { return (_record[1] & HandHistoryFormat::WON_FLAG) != 0; }
+            [[nodiscard]] auto getBlinds() const -> Blinds { return _blinds; }
+            [[nodiscard]] auto getPot() const -> int32_t { return _pot; }
+            [[nodiscard]] auto getPlayersNumber() const -> int32_t { return _playersNumber; }
+            [[nodiscard]] auto getBoardCard(int32_t index) const -> Card;
+            [[nodiscard]] auto getPlayerHand(int32_t playerNum) const -> Hand;
+            [[nodiscard]] auto getStartStack(int32_t playerNum) const -> int32_t;
+            [[nodiscard]] auto getEndStack(int32_t playerNum) const -> int32_t;
+            [[nodiscard]] auto getActionsNumber(Round::Street street) const -> int32_t;
+
+            // Call the callback on each action of the street, in order
+            template<typename Callback> auto forEachAction(Round::Street street, Callback&& callback) const -> void {
+                auto        actionsNumber = getActionsNumber(street);
+                const auto* records       = _streetRecords.at(street);
+                const auto* amounts       = records + static_cast<std::ptrdiff_t>(actionsNumber)
+                                                        * static_cast<std::ptrdiff_t>(HandHistoryFormat::ACTION_RECORD_SIZE);
+
+                for (int32_t i = 0; i < actionsNumber; ++i, records += HandHistoryFormat::ACTION_RECORD_SIZE) {
+                    auto amount = static_cast<int32_t>(HandHistoryFormat::readVarint(amounts, _end()));
+                    auto time   = seconds(HandHistoryFormat::readU16(records + 2));
+
+                    callback(RoundAction(static_cast<RoundAction::ActionType>(records[0]), records[1], time, amount));
+                }
+            }
+
+        private:
+            std::span<const uint8_t>                                        _record;
+            std::array<const uint8_t*, HandHistoryFormat::RECORDED_STREETS> _streetRecords {};  // First action record of each street
+            std::array<int32_t, HandHistoryFormat::RECORDED_STREETS>        _actionsNumbers {};
+            std::array<int32_t, MAX_SEATS>                                  _startStacks {};
+            std::array<int32_t, MAX_SEATS>                                  _endStacks {};
+            Blinds                                                          _blinds;
+            int32_t                                                         _pot           = 0;
+            int32_t                                                         _playersNumber = 0;
+
+            [[nodiscard]] auto _end() const -> const uint8_t* { return _record.data() + _record.size(); }
+    };
+
+    /**
+     * @brief Memory mapped hand history reader, the rounds are iterated in place without copying the file.
+     */
+    class HandHistoryReader {
+        public:
+            class iterator {
+                public:
+                    using iterator_category = std::input_iterator_tag;
+                    using value_type        = RoundView;
+                    using difference_type   = std::ptrdiff_t;
+
+                    iterator(const uint8_t* cursor, const uint8_t* end, int32_t playersNumber)
+                      : _cursor(cursor)
+                      , _end(end)
+                      , _playersNumber(playersNumber) {}
+
+                    auto operator*() const -> RoundView;
+                    auto operator++() -> iterator&;
+                    auto operator==(const iterator& other) const -> bool { return _cursor == other._cursor; }
+
+                private:
+                    const uint8_t* _cursor;
+                    const uint8_t* _end;
+                    int32_t        _playersNumber;
+
+                    [[nodiscard]] auto _recordSize() const -> std::size_t;
+            };
+
+            explicit HandHistoryReader(const std::filesystem::path& path);
+            HandHistoryReader(const HandHistoryReader& other) = delete;
+            HandHistoryReader(HandHistoryReader&& other)      = delete;
+
+            ~HandHistoryReader();
+
+            auto operator=(const HandHistoryReader& other) -> HandHistoryReader& = delete;
+            auto operator=(HandHistoryReader&& other) -> HandHistoryReader&      = delete;
+
+            [[nodiscard]] auto getVersion() const -> uint16_t { return _version; }
+            [[nodiscard]] auto getPlayersNumber() const -> int32_t { return static_cast<int32_t>(_playersName.size()); }
+            [[nodiscard]] auto getPlayerName(int32_t playerNum) const -> std::string_view { return _playersName[playerNum - 1]; }
+            [[nodiscard]] auto getBuyIn() const -> int32_t { return _buyIn; }
+            [[nodiscard]] auto getMultipliers() const -> int32_t { return _multipliers; }
+            [[nodiscard]] auto getInitialStack() const -> int32_t { return _initialStack; }
+            [[nodiscard]] auto getDuration() const -> seconds { return _duration; }
+            [[nodiscard]] auto isComplete() const -> bool { return (_flags & HandHistoryFormat::COMPLETE_FLAG) != 0; }
+            [[nodiscard]] auto isWon() const -> bool { return (_flags & HandHistoryFormat::WON_FLAG) != 0; }
+            [[nodiscard]] auto getRoundsNumber() const -> std::size_t { return _roundsNumber; }
+
+            [[nodiscard]] auto begin() const -> iterator { return {_rounds, _data + _size, getPlayersNumber()}; }
+            [[nodiscard]] auto end() const -> iterator { return {_data + _size, _data + _size, getPlayersNumber()}; }
+
+        private:
+            const uint8_t*                            _data    = nullptr;
+            std::size_t                               _size    = 0;
+            const uint8_t*                            _rounds  = nullptr;
+            void*                                     _mapping = nullptr;  // Platform file mapping handle
+            StaticVector<std::string_view, MAX_SEATS> _playersName;
+            std::size_t                               _roundsNumber = 0;
+            seconds                                   _duration     = seconds(0);
+            int32_t                                   _buyIn        = 0;
+            int32_t                                   _multipliers  = 0;
+            int32_t                                   _initialStack = 0;
+            uint16_t                                  _version      = 0;
+            uint8_t                                   _flags        = 0;
+
+            auto _map(const std::filesystem::path& path) -> void;
+            auto _unmap() -> void;
+            auto _parseHeader() -> void;
+    };
+}  // namespace GameHandler
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include <fmt/format.h>
+
+namespace GameHandler {
+    class invalid_json : public std::runtime_error {
+        public:
+            explicit invalid_json(const std::string& arg)
+              : runtime_error(arg) {};
+    };
+
+    /**
+     * @brief Pull JSON parser reading the values in place, without building a JSON document.
+     *
+     * The strings are returned as views on the parsed text, only the strings with escaped characters are decoded into an
+     * internal buffer, which is reused, so a returned view is only valid until the next read.
+     */
+    class JsonReader {
+        public:
+            explicit JsonReader(std::string_view json)
+              : _json(json) {}
+
+            auto startObject() -> void { _expect('{'); }
+            auto startArray() -> void { _expect('['); }
+
+            // Read the next object key, return false and consume the closing brace when the object is over
+            auto nextKey(std::string_view& key) -> bool {
+                if (!_nextMember('}')) { return false; }
+
+                key = readString();
+                _expect(':');
+
+                return true;
+            }
+
+            // Return false and consume the closing bracket when the array is over
+            auto nextElement() -> bool { return _nextMember(']'); }
+
+            [[nodiscard]] auto readString() -> std::string_view {
+                _expect('"');
+
+                auto start = _position;
+
+                while (_position < _json.size() && _json[_position] != '"') {
+                    if (_json[_position] == '\\') { return _readEscapedString(start); }
+
+                    ++_position;
+                }
+
+                if (_position == _json.size()) { _throwError("unterminated string"); }
+
+                return _json.substr(start, _position++ - start);
+            }
+
+            template<std::integral T = int32_t> [[nodiscard]] auto readInt() -> T {
+                T value = 0;
+
+                _skipWhitespaces();
+
+                auto [end, error] = std::from_chars(_json.data() + _position, _json.data() + _json.size(), value);
+
+                if (error != std::errc()) { _throwError("integer expected"); }
+
+                _position = static_cast<std::size_t>(end - _json.data());
+
+                return value;
+            }
+
+            [[nodiscard]] auto readBool() -> bool {
+                if (_consumeLiteral("true")) { return true; }
+                if (_consumeLiteral("false")) { return false; }
+
+                _throwError("boolean expected");
+            }
+
+            // Skip the next value and return its raw text, to parse it later with another reader
+            auto skipValue() -> std::string_view {
+                _skipWhitespaces();
+
+                auto start = _position;
+
+                switch (_peek()) {
+                    case '"': std::ignore = readString(); break;
+                    case '{': _skipContainer('{', '}'); break;
+                    case '[': _skipContainer('[', ']'); break;
+                    default:
+                        while (_position < _json.size() && _json[_position] != ',' && _json[_position] != '}' && _json[_position] != ']'
+                               && !_isWhitespace(_json[_position])) {
+                            ++_position;
+                        }
+                }
+
+                return _json.substr(start, _position - start);
+            }
+
+        private:
+            std::string_view _json;
+            std::size_t      _position = 0;
+            std::string      _decoded;
+
+            static auto _isWhitespace(char character) -> bool {
+                return character == ' ' || character == '\n' || character == '\r' || character == '\t';
+            }
+
+            auto _skipWhitespaces() -> void {
+                while (_position < _json.size() && _isWhitespace(_json[_position])) { ++_position; }
+            }
+
+            auto _peek() -> char {
+                _skipWhitespaces();
+
+                if (_position == _json.size()) { _throwError("unexpected end of input"); }
+
+                return _json[_position];
+            }
+
+            auto _expect(char character) -> void {
+                if (_peek() != character) { _throwError(fmt::format("`{}` expected", character)); }
+
+                ++_position;
+            }
+
+            auto _consumeLiteral(std::string_view literal) -> bool {
+                _skipWhitespaces();
+
+                if (!_json.substr(_position).starts_with(literal)) { return false; }
+
+                _position += literal.size();
+
+                return true;
+            }
+
+            auto _nextMember(char closing) -> bool {
+                auto character = _peek();
+
+                if (character == closing) {
+                    ++_position;
+                    return false;
+                }
+
+                if (!_isFirstMember()) {
+                    if (character != ',') { _throwError("`,` expected"); }
+
+                    ++_position;
+                }
+
+                return true;
+            }
+
+            auto _isFirstMember() const -> bool {
+                auto position = _position;
+
+                while (position > 0 && _isWhitespace(_json[position - 1])) { --position; }
+
+                return position > 0 && (_json[position - 1] == '{' || _json[position - 1] == '[');
+            }
+
+            auto _skipContainer(char opening, char closing) -> void {
+                int32_t depth = 0;
+
+                do {
+                    auto character = _peek();
+
+                    if (character == '"') {
+                        std::ignore = readString();
+                        continue;
+                    }
+
+                    if (character == opening) { ++depth; }
+                    if (character == closing) { --depth; }
+
+                    ++_position;
+                } while (depth > 0);
+            }
+
+            auto _readEscapedString(std::size_t start) -> std::string_view {
+                _decoded.assign(_json.substr(start, _position - start));
+
+                while (_position < _json.size() && _json[_position] != '"') {
+                    auto character = _json[_position++];
+
+                    if (character != '\\') {
+                        _decoded += character;
+                        continue;
+                    }
+
+                    if (_position == _json.size()) { break; }
+
+                    switch (_json[_position++]) {
+                        case '"': _decoded += '"'; break;
+                        case '\\': _decoded += '\\'; break;
+                        case '/': _decoded += '/'; break;
+                        case 'b': _decoded += '\b'; break;
+                        case 'f': _decoded += '\f'; break;
+                        case 'n': _decoded += '\n'; break;
+                        case 'r': _decoded += '\r'; break;
+                        case 't': _decoded += '\t'; break;
+                        case 'u': _appendCodePoint(_readCodePoint()); break;
+                        default: _throwError("invalid escaped character");
+                    }
+                }
+
+                if (_position == _json.size()) { _throwError("unterminated string"); }
+
+                ++_position;
+
+                return _decoded;
+            }
+
+            auto _readHex() -> uint32_t {
+                static constexpr int32_t HEX_DIGITS_NUMBER = 4;
+
+                uint32_t value = 0;
+
+                if (_position + HEX_DIGITS_NUMBER > _json.size()) { _throwError("invalid unicode escape"); }
+
+                auto [end, error] = std::from_chars(_json.data() + _position, _json.data() + _position + HEX_DIGITS_NUMBER, value, 16);
+
+                if (error != std::errc() || end != _json.data() + _position + HEX_DIGITS_NUMBER) { _throwError("invalid unicode escape"); }
+
+                _position += HEX_DIGITS_NUMBER;
+
+                return value;
+            }
+
+            auto _readCodePoint() -> uint32_t {
+                auto codePoint = _readHex();
+                // UTF-16 surrogate pair
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF && _json.substr(_position).starts_with("\\u")) {
+                    _position += 2;
+                    codePoint  = 0x10000 + ((codePoint - 0xD800) << 10) + (_readHex() - 0xDC00);
+                }
+
+                return codePoint;
+            }
+
+            // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+            auto _appendCodePoint(uint32_t codePoint) -> void {
+                if (codePoint < 0x80) {
+                    _decoded += static_cast<char>(codePoint);
+                } else if (codePoint < 0x800) {
+                    _decoded += static_cast<char>(0xC0 | (codePoint >> 6));
+                    _decoded += static_cast<char>(0x80 | (codePoint & 0x3F));
+                } else if (codePoint < 0x10000) {
+                    _decoded += static_cast<char>(0xE0 | (codePoint >> 12));
+                    _decoded += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    _decoded += static_cast<char>(0x80 | (codePoint & 0x3F));
+                } else {
+                    _decoded += static_cast<char>(0xF0 | (codePoint >> 18));
+                    _decoded += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                    _decoded += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    _decoded += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            }
+            // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+            [[noreturn]] auto _throwError(std::string_view error) const -> void {
+                throw invalid_json(fmt::format("Invalid JSON at offset {}: {}", _position, error));
+            }
+    };
+}  // namespace GameHandler
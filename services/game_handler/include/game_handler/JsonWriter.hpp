@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace GameHandler {
+    /**
+     * @brief Streaming JSON writer appending straight into a reusable buffer, without building a JSON document.
+     *
+     * The commas are handled by the writer, a key must be followed by a value, an object or an array. The buffer keeps its
+     * capacity between two clear() or flush() calls so exporting many games does not allocate once the buffer is warm.
+     */
+    class JsonWriter {
+        public:
+            static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+
+            explicit JsonWriter(std::size_t capacity = DEFAULT_CAPACITY) { _buffer.reserve(capacity); }
+
+            auto startObject() -> JsonWriter& {
+                _separate();
+                _buffer += '{';
+                _needsComma = false;
+
+                return *this;
+            }
+
+            auto endObject() -> JsonWriter& {
+                _buffer     += '}';
+                _needsComma  = true;
+
+                return *this;
+            }
+
+            auto startArray() -> JsonWriter& {
+                _separate();
+                _buffer += '[';
+                _needsComma = false;
+
+                return *this;
+            }
+
+            auto endArray() -> JsonWriter& {
+                _buffer     += ']';
+                _needsComma  = true;
+
+                return *this;
+            }
+
+            auto key(std::string_view key) -> JsonWriter& {
+                _separate();
+                _writeString(key);
+                _buffer     += ':';
+                _needsComma  = false;
+
+                return *this;
+            }
+
+            // Formatted key, it must not contain characters to escape
+            template<typename... Args> auto key(fmt::format_string<Args...> format, Args&&... args) -> JsonWriter& {
+                _separate();
+                _buffer += '"';
+                fmt::format_to(std::back_inserter(_buffer), format, std::forward<Args>(args)...);
+                _buffer     += "\":";
+                _needsComma  = false;
+
+                return *this;
+            }
+
+            auto value(std::string_view value) -> JsonWriter& {
+                _separate();
+                _writeString(value);
+                _needsComma = true;
+
+                return *this;
+            }
+
+            auto value(const char* value) -> JsonWriter& { return this->value(std::string_view(value)); }
+
+            auto value(bool value) -> JsonWriter& {
+                _separate();
+                _buffer     += value ? "true" : "false";
+                _needsComma  = true;
+
+                return *this;
+            }
+
+            template<std::integral T> auto value(T value) -> JsonWriter& {
+                std::array<char, INTEGER_MAX_CHARS> chars {};
+
+                _separate();
+                _buffer.append(chars.data(), std::to_chars(chars.begin(), chars.end(), value).ptr);
+                _needsComma = true;
+
+                return *this;
+            }
+
+            // Formatted string value, it must not contain characters to escape
+            template<typename... Args> auto value(fmt::format_string<Args...> format, Args&&... args) -> JsonWriter& {
+                _separate();
+                _buffer += '"';
+                fmt::format_to(std::back_inserter(_buffer), format, std::forward<Args>(args)...);
+                _buffer     += '"';
+                _needsComma  = true;
+
+                return *this;
+            }
+
+            // Already serialized JSON value
+            auto raw(std::string_view json) -> JsonWriter& {
+                _separate();
+                _buffer     += json;
+                _needsComma  = true;
+
+                return *this;
+            }
+
+            [[nodiscard]] auto view() const -> std::string_view { return _buffer; }
+            [[nodiscard]] auto str() const -> std::string { return _buffer; }
+            [[nodiscard]] auto size() const -> std::size_t { return _buffer.size(); }
+
+            auto clear() -> void {
+                _buffer.clear();
+                _needsComma = false;
+            }
+
+            auto flush(std::ostream& stream) -> void {
+                stream.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+                _buffer.clear();
+            }
+
+        private:
+            static constexpr std::size_t INTEGER_MAX_CHARS = 24;
+
+            std::string _buffer;
+            bool        _needsComma = false;
+
+            auto _separate() -> void {
+                if (_needsComma) { _buffer += ','; }
+            }
+
+            auto _writeString(std::string_view string) -> void {
+                static constexpr std::string_view HEX_DIGITS = "0123456789abcdef";
+
+                _buffer += '"';
+
+                for (char character : string) {
+                    switch (character) {
+                        case '"': _buffer += "\\\""; break;
+                        case '\\': _buffer += "\\\\"; break;
+                        case '\b': _buffer += "\\b"; break;
+                        case '\f': _buffer += "\\f"; break;
+                        case '\n': _buffer += "\\n"; break;
+                        case '\r': _buffer += "\\r"; break;
+                        case '\t': _buffer += "\\t"; break;
+                        default:
+                            if (static_cast<unsigned char>(character) < 0x20) {
+                                _buffer += "\\u00";
+                                _buffer += HEX_DIGITS[static_cast<unsigned char>(character) >> 4];
+                                _buffer += HEX_DIGITS[static_cast<unsigned char>(character) & 0xF];
+                            } else {
+                                _buffer += character;
+                            }
+                    }
+                }
+
+                _buffer += '"';
+            }
+    };
+}  // namespace GameHandler
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace GameHandler {
+    using name_id_t = uint32_t;
+
+    static constexpr name_id_t        DEFAULT_NAME_ID = 0;
+    static constexpr std::string_view DEFAULT_NAME    = "DEFAULT_PLAYER";
+
+    /**
+     * @brief Process wide pool of the players name, each distinct name is stored once and identified by a stable 32 bits id.
+     *
+     * The names are never removed so an id and the view it resolves to stay valid until the process ends. The pool is shared
+     * between the import threads, the names are interned under an exclusive lock and resolved under a shared one.
+     */
+    class NamePool {
+        public:
+            NamePool(const NamePool& other) = delete;
+            NamePool(NamePool&& other)      = delete;
+
+            ~NamePool() = default;
+
+            auto operator=(const NamePool& other) -> NamePool& = delete;
+            auto operator=(NamePool&& other) -> NamePool&      = delete;
+
+            [[nodiscard]] static auto instance() -> NamePool&;
+
+            [[nodiscard]] auto intern(std::string_view name) -> name_id_t;
+            [[nodiscard]] auto resolve(name_id_t nameId) const -> std::string_view;
+            [[nodiscard]] auto size() const -> std::size_t;
+
+        private:
+            mutable std::shared_mutex                       _mutex;
+            std::deque<std::string>                         _names;  // Indexed by id, a deque never moves its elements
+            std::unordered_map<std::string_view, name_id_t> _ids;    // Views on the stored names
+
+            NamePool();
+    };
+}  // namespace GameHandler
@@ -1,8 +1,23 @@
 #pragma once
 
 #include <game_handler/Hand.hpp>
+#include <game_handler/NamePool.hpp>
 
 namespace GameHandler {
+    // The players are named `player_{number}` in the JSON
+    inline auto playerNumFromName(std::string_view name) -> int32_t {
+        static constexpr std::string_view PREFIX = "player_";
+
+        int32_t playerNum = 0;
+
+        if (!name.starts_with(PREFIX)
+            || std::from_chars(name.data() + PREFIX.size(), name.data() + name.size(), playerNum).ec != std::errc()) {
+            throw invalid_json(fmt::format("Invalid player name `{}`", name));
+        }
+
+        return playerNum;
+    }
+
     class Player {
         public:
             Player()                        = default;
@@ -10,25 +25,29 @@ namespace GameHandler {
             Player(Player&& other) noexcept = default;
             Player(std::string_view name, int32_t number);
 
-            virtual ~Player() = default;
+            ~Player() = default;
 
             auto operator=(const Player& other) -> Player& = default;
-            auto operator=(Player&& other) noexcept -> Player&;
-            auto operator==(const Player& other) const -> bool { return _name == other._name; }
+            auto operator=(Player&& other) noexcept -> Player& = default;
+            auto operator==(const Player& other) const -> bool { return _nameId == other._nameId; }
 
-            [[nodiscard]] virtual auto getName() const -> std::string { return _name; }
-            [[nodiscard]] virtual auto getNumber() const -> int32_t { return _number; }
-            [[nodiscard]] virtual auto getStack() const -> int32_t { return _stack; }
-            [[nodiscard]] virtual auto isEliminated() const -> bool { return _eliminated; }
-            [[nodiscard]] virtual auto isHero() const -> bool { return _number == 1; }  // The player with number 1 is the hero
+            // The name is resolved from the pool once, the interned names never move. The players are compared by name id
+            [[nodiscard]] auto getName() const -> std::string_view { return _name; }
+            [[nodiscard]] auto getNameId() const -> name_id_t { return _nameId; }
+            [[nodiscard]] auto getNumber() const -> int32_t { return _number; }
+            [[nodiscard]] auto getStack() const -> int32_t { return _stack; }
+            [[nodiscard]] auto isEliminated() const -> bool { return _eliminated; }
+            [[nodiscard]] auto isHero() const -> bool { return _number == 1; }  // The player with number 1 is the hero
 
-            virtual auto setStack(int32_t stack) -> void { _stack = stack; }
-            virtual auto bust() -> void { _eliminated = true; }
+            auto setStack(int32_t stack) -> void { _stack = stack; }
+            auto bust() -> void { _eliminated = true; }
+            auto setEliminated(bool eliminated) -> void { _eliminated = eliminated; }
 
         private:
-            std::string _name       = "DEFAULT_PLAYER";
-            int32_t     _number     = 0;
-            int32_t     _stack      = 0;
-            bool        _eliminated = false;
+            name_id_t        _nameId     = DEFAULT_NAME_ID;
+            std::string_view _name       = DEFAULT_NAME;
+            int32_t          _number     = 0;
+            int32_t          _stack      = 0;
+            bool             _eliminated = false;
     };
 }  // namespace GameHandler
\ No newline at end of file
@@ -1,22 +1,21 @@
 #pragma once
 
-#include <stack>
+#include <functional>
 #include <utility>
 
 #include <game_handler/Board.hpp>
 #include <game_handler/RoundAction.hpp>
+#include <game_handler/SeatTable.hpp>
+#include <game_handler/SidePots.hpp>
 
 namespace GameHandler {
     using std::chrono::system_clock;
     using std::chrono::time_point;
 
-    using ActionType = RoundAction::ActionType;
-
     using enum ActionType;
 
-    static const int32_t STREET_NUMBER = 5;
-
-    enum Position : int32_t { DEALER = 0, SMALL_BLIND, BIG_BLIND };
+    static const int32_t STREET_NUMBER               = 5;
+    static const int32_t RESERVED_ACTIONS_PER_STREET = 16;  // Actions storage reserved upfront to not allocate on each action
 
     struct Blinds {
         public:
@@ -40,102 +39,53 @@ namespace GameHandler {
               , startStack(startStack)
               , endStack(endStack) {}
 
-            int32_t playerNumber;
-            int32_t startStack;
-            int32_t endStack;
-    };
-
-    struct PlayerStatus : public Player {
-        public:
-            ActionType lastAction     = NONE;
-            int32_t    totalBet       = 0;
-            int32_t    totalStreetBet = 0;
-            int32_t    maxWinnable    = 0;
-            int32_t    initialStack   = 0;
-            bool       inRound        = true;
-            bool       isAllIn        = false;
-            Hand       hand           = Hand();
-            Position   position;
-            Player*    player;
-
-            explicit PlayerStatus(Player* player, int32_t dealerNumber)
-              : position(static_cast<Position>((player->getNumber() - dealerNumber + 3) % 3))
-              , inRound(!player->isEliminated())
-              , initialStack(player->getStack())
-              , player(player)
-              , Player(*player) {};
-
-            auto winChips(int32_t chips) -> void { setStack(getStack() + chips); }
-            auto payBigBlind(int32_t amount) -> void { _updateStatus(std::min(amount, getStack()), PAY_BIG_BLIND); }
-            auto paySmallBlind(int32_t amount) -> void { _updateStatus(std::min(amount, getStack()), PAY_SMALL_BLIND); }
-            auto hasBet(int32_t amount) -> void { _updateStatus(amount, BET); }
-            auto hasRaised(int32_t amount) -> void { _updateStatus(amount, RAISE); }
-            auto hasCalled(int32_t amount) -> void { _updateStatus(amount, CALL); }
-            auto hasChecked() -> void { lastAction = CHECK; }
-
-            auto hasFolded() -> void {
-                inRound    = false;
-                lastAction = FOLD;
-            }
-
-            auto streetReset() -> void {
-                totalStreetBet = 0;
-                lastAction     = NONE;
-            }
-            // Adapter pattern to Player
-            [[nodiscard]] auto getName() const -> std::string override { return player->getName(); }
-            [[nodiscard]] auto getNumber() const -> int32_t override { return player->getNumber(); }
-            [[nodiscard]] auto getStack() const -> int32_t override { return player->getStack(); }
-            [[nodiscard]] auto isEliminated() const -> bool override { return player->isEliminated(); }
-            [[nodiscard]] auto isHero() const -> bool override { return player->isHero(); }
-
-            auto setStack(int32_t stack) -> void override { player->setStack(stack); }
-            auto bust() -> void override { player->bust(); }
-
-        private:
-            auto _updateStatus(int32_t amount, ActionType action) -> void {
-                totalBet       += amount;
-                totalStreetBet += amount;
-                isAllIn         = totalBet == initialStack;
-
-                if (action != PAY_BIG_BLIND && action != PAY_SMALL_BLIND) { lastAction = action; }
-
-                setStack(initialStack - totalBet);
-            }
+            int32_t playerNumber = 0;
+            int32_t startStack   = 0;
+            int32_t endStack     = 0;
     };
 
     class Round {
         public:
             using round_actions_t       = std::array<std::vector<RoundAction>, STREET_NUMBER>;
-            using players_round_recap_t = std::array<PlayerRoundRecap, 3>;
-            using ranking_t             = std::stack<std::vector<int32_t>>;
-            using players_status_t      = std::array<PlayerStatus, 3>;
-            using players_status_ptr    = std::unique_ptr<players_status_t>;
+            using players_round_recap_t = StaticVector<PlayerRoundRecap, MAX_SEATS>;
+            using players_num_t         = GameHandler::players_num_t;
+            using ranking_t             = GameHandler::ranking_t;
+            using version_t             = int32_t;
+            using action_to_json_t      = json (RoundAction::*)() const;
+            using action_listener_t     = std::function<void(const Round&, const RoundAction&)>;
 
             enum Street : int32_t { PREFLOP = 0, FLOP, TURN, RIVER, SHOWDOWN };
 
-            Round(const Blinds& blinds, std::array<Player, 3>& players, Hand hand, int32_t dealerNumber);
-            Round(const Round& other) { *this = other; }
-            Round(Round&& other) noexcept { *this = std::move(other); };
+            Round(const Blinds& blinds, std::span<Player> players, Hand hand, int32_t dealerNumber);
+            Round(const Round& other)     = default;
+            Round(Round&& other) noexcept = default;
 
             virtual ~Round() = default;
 
-            auto operator=(const Round& other) -> Round&;
-            auto operator=(Round&& other) noexcept -> Round&;
+            auto operator=(const Round& other) -> Round&     = default;
+            auto operator=(Round&& other) noexcept -> Round& = default;
 
             [[nodiscard]] auto getBoard() -> Board& { return _board; }
             [[nodiscard]] auto getBoard() const -> const Board& { return _board; }
             [[nodiscard]] auto getPot() const -> int32_t { return _pot; }
+            [[nodiscard]] auto getBlinds() const -> const Blinds& { return _blinds; }
+            [[nodiscard]] auto getDealerNum() const -> int32_t { return _dealerPlayerNum; }
+            [[nodiscard]] auto getActions() const -> const round_actions_t& { return _actions; }
+            [[nodiscard]] auto getRanking() const -> const ranking_t& { return _ranking; }
+            [[nodiscard]] auto getPlayersRoundRecap() const -> const players_round_recap_t& { return _playersRoundRecap; }
             [[nodiscard]] auto getLastAction() const -> RoundAction { return _currentAction; };
             [[nodiscard]] auto getCurrentPlayerStack(int32_t playerNum) const -> int32_t;
             [[nodiscard]] auto isInProgress() const -> bool { return !_ended; }
             [[nodiscard]] auto isNextActionTheLastStreetOne(int32_t playerNum) const -> bool;
             [[nodiscard]] auto waitingShowdown() const -> bool;
-            [[nodiscard]] auto getInRoundPlayersNum() const -> std::vector<int32_t>;
-            [[nodiscard]] auto getPlayerHand(int32_t playerNum) const -> Hand { return _getPlayerStatus(playerNum).hand; }
+            [[nodiscard]] auto getInRoundPlayersNum() const -> players_num_t;
+            [[nodiscard]] auto getPlayerHand(int32_t playerNum) const -> Hand { return _seats.hand(playerNum); }
+            [[nodiscard]] auto getSeats() const -> const SeatTable& { return _seats; }
+            [[nodiscard]] auto getPots() const -> const SidePots& { return _pots; }
             [[nodiscard]] auto getCurrentStreet() const -> Street { return _currentStreet; }
             [[nodiscard]] auto getCurrentPlayerNum() const -> int32_t { return _currentPlayerNum; }
             [[nodiscard]] auto playerGotBusted() const -> bool { return _playerGotBusted; }
+            [[nodiscard]] auto hasWon() const -> bool;
 
             auto call(int32_t playerNum) -> void;
             auto bet(int32_t playerNum, int32_t amount) -> void;
@@ -144,22 +94,52 @@ namespace GameHandler {
             auto fold(int32_t playerNum) -> void;
             auto allIn(int32_t playerNum) -> void;
             auto showdown() -> void;
-            auto setPlayerHand(const Hand& hand, int32_t playerNum) -> void { _getPlayerStatus(playerNum).hand = hand; }
+            auto setPlayerHand(const Hand& hand, int32_t playerNum) -> void { _seats.hand(playerNum) = hand; }
+            // Called with each action played through the actions API once it is recorded, the replayed actions are not notified
+            auto setActionListener(action_listener_t listener) -> void { _actionListener = std::move(listener); }
+
+            [[nodiscard]] auto snapshot() -> version_t;
+            auto               rollbackTo(version_t version) -> std::vector<RoundAction>;
+            auto               replay(const RoundAction& action) -> void;
+            // Drop the saved states once the actions are confirmed, the versions given so far become invalid
+            auto discardSnapshots() -> void { _snapshots.clear(); }
 
             [[nodiscard]] auto toJson() const -> json;
+            // Same as toJson() with the metrics of each action
+            [[nodiscard]] auto toDetailedJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
 
             [[nodiscard]] static auto toJson(const ranking_t& ranking) -> json;
             [[nodiscard]] static auto toJson(const players_round_recap_t& playersRoundRecap) -> json;
+            [[nodiscard]] static auto fromJson(JsonReader& reader, std::span<Player> players) -> Round;
 
         private:
+            // Round state saved by snapshot(), the actions are append only so only their number is saved
+            struct Snapshot {
+                    std::array<std::size_t, STREET_NUMBER> actionsNumber {};
+                    SeatTable                              seats;
+                    ranking_t                              ranking;
+                    SidePots                               pots;
+                    players_round_recap_t                  playersRoundRecap;
+                    int32_t                                pot;
+                    int32_t                                streetPot;
+                    int32_t                                lastBetOrRaise;
+                    int32_t                                currentPlayerNum;
+                    Street                                 currentStreet;
+                    RoundAction                            currentAction;
+                    RoundAction                            lastAction;
+                    bool                                   ended;
+                    bool                                   playerGotBusted;
+            };
+
             round_actions_t          _actions;
             Board                    _board;
             ranking_t                _ranking;
+            SidePots                 _pots;
             players_round_recap_t    _playersRoundRecap   = {};  // Used to store the players status statically in the json
             Blinds                   _blinds              = Blinds(0, 0);
             int32_t                  _pot                 = 0;
             int32_t                  _streetPot           = 0;
-            int32_t                  _frozenPot           = 0;
             int32_t                  _lastBetOrRaise      = 0;
             int32_t                  _currentPlayerNum    = 0;
             int32_t                  _dealerPlayerNum     = 0;
@@ -168,51 +148,41 @@ namespace GameHandler {
             Hand                     _hand                = Hand();
             Street                   _currentStreet       = Street::PREFLOP;
             time_point<system_clock> _lastActionTime      = system_clock::now();
-            std::array<Player, 3>*   _players             = nullptr;  // The Game class owns the players, so we use a pointer here
-            players_status_ptr       _playersStatus       = nullptr;
+            std::span<Player>        _players;  // The Game class owns the players, they are updated after each action
+            SeatTable                _seats;
             RoundAction              _currentAction       = RoundAction();
             RoundAction              _lastAction          = RoundAction();
             bool                     _ended               = false;
             bool                     _playerGotBusted     = false;
+            std::vector<Snapshot>    _snapshots;
+            action_listener_t        _actionListener;
 
-            [[nodiscard]] auto _hasWon() const -> bool;
-            [[nodiscard]] auto _getPlayerStatus(int32_t playerNum) const -> PlayerStatus;
             [[nodiscard]] auto _getNextPlayerNum(int32_t playerNum) const -> int32_t;
             [[nodiscard]] auto _isStreetOver() const -> bool;
 
-            auto _getPlayerStatus(int32_t playerNum) -> PlayerStatus&;
+            [[nodiscard]] auto _computeMetrics(const Seat& seat, int32_t amount) const -> ActionMetrics;
+            [[nodiscard]] auto _toJson(action_to_json_t actionToJson) const -> json;
+
+            [[nodiscard]] static auto _streetFromName(std::string_view name) -> Street;
+
             auto _getAndResetLastActionTime() -> seconds;
             auto _setAction(int32_t playerNum, ActionType actionType, int32_t amount = 0) -> void;
+            auto _applyAction(const RoundAction& action) -> void;
             auto _determineRoundOver() -> void;
             auto _processRanking() -> void;
-            auto _updateStacks() -> void;
+            auto _distributePots() -> void;
             auto _payBlinds() -> void;
-            auto _updatePlayersMaxWinnable() -> void;
             auto _endStreet() -> void;
             auto _endRound() -> void;
+            auto _syncPlayer(const Seat& seat) -> void;
     };
 }  // namespace GameHandler
 
-// Custom formatter for Position and Blinds
+// Custom formatter for Blinds and Street
 namespace fmt {
     using GameHandler::Blinds;
-    using GameHandler::Position;
     using GameHandler::Round;
 
-    template<> struct formatter<Position> : formatter<string_view> {
-            template<typename FormatContext> auto format(Position position, FormatContext& ctx) const {
-                string_view name = "unknown";
-
-                switch (position) {
-                    case Position::DEALER: name = "dealer"; break;
-                    case Position::SMALL_BLIND: name = "small_blind"; break;
-                    case Position::BIG_BLIND: name = "big_blind"; break;
-                }
-
-                return formatter<string_view>::format(name, ctx);
-            }
-    };
-
     template<> struct formatter<Blinds> : formatter<string_view> {
             template<typename FormatContext> auto format(const Blinds& blinds, FormatContext& ctx) const {
                 return fmt::format_to(ctx.out(), "({}-{})", blinds.SB(), blinds.BB());
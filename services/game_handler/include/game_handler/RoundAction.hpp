@@ -7,6 +7,22 @@
 namespace GameHandler {
     using std::chrono::seconds;
 
+    // Metrics of an action computed from the round state just before the action, the chips amounts are the action ones
+    struct ActionMetrics {
+        public:
+            int32_t potBefore      = 0;
+            int32_t toCall         = 0;
+            int32_t effectiveStack = 0;  // The player stack capped by the biggest stack of the other players in the round
+            double  potOdds        = 0;  // The call share of the pot after the call
+            double  spr            = 0;  // Effective stack to pot ratio
+            double  betPotFraction = 0;  // The action amount divided by the pot before the action
+            double  betBigBlinds   = 0;
+
+            auto operator==(const ActionMetrics& other) const -> bool = default;
+
+            [[nodiscard]] auto toJson() const -> json;
+    };
+
     class RoundAction {
         public:
             enum class ActionType : int32_t { CHECK = 0, CALL, BET, RAISE, FOLD, ALL_IN, PAY_SMALL_BLIND, PAY_BIG_BLIND, NONE };
@@ -14,27 +30,38 @@ namespace GameHandler {
             explicit RoundAction()                    = default;
             RoundAction(const RoundAction& other)     = default;
             RoundAction(RoundAction&& other) noexcept = default;
-            RoundAction(ActionType action, Player player, seconds time, int32_t amount = 0);
+            RoundAction(ActionType action, int32_t playerNum, seconds time, int32_t amount = 0);
 
             virtual ~RoundAction() = default;
 
             auto operator=(const RoundAction& other) -> RoundAction& = default;
-            auto operator=(RoundAction&& other) noexcept -> RoundAction&;
+            auto operator=(RoundAction&& other) noexcept -> RoundAction& = default;
 
             [[nodiscard]] auto getAction() const -> ActionType { return _action; }
-            [[nodiscard]] auto getPlayer() const -> const Player& { return _player; }
+            [[nodiscard]] auto getPlayerNum() const -> int32_t { return _playerNum; }
             [[nodiscard]] auto getTime() const -> const seconds& { return _time; }
             [[nodiscard]] auto getAmount() const -> int32_t { return _amount; }
+            [[nodiscard]] auto getMetrics() const -> const ActionMetrics& { return _metrics; }
+
+            auto setMetrics(const ActionMetrics& metrics) -> void { _metrics = metrics; }
 
             [[nodiscard]] auto toJson() const -> json;
+            // The JSON with the action metrics, they are not stored in the games JSON as they are computed again when it is read
+            [[nodiscard]] auto toDetailedJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
+
+            [[nodiscard]] static auto fromJson(JsonReader& reader) -> RoundAction;
 
         private:
-            ActionType _action = ActionType::NONE;
-            Player     _player = Player();
-            seconds    _time   = seconds(0);
-            int32_t    _amount = 0;
+            ActionType    _action    = ActionType::NONE;
+            int32_t       _playerNum = 0;  // Only the player number is stored so copying an action never allocates
+            seconds       _time      = seconds(0);
+            int32_t       _amount    = 0;
+            ActionMetrics _metrics;
 
             [[nodiscard]] auto _requiresAmount(ActionType action) const -> bool;
+
+            [[nodiscard]] static auto _actionFromName(std::string_view name) -> ActionType;
     };
 }  // namespace GameHandler
 
@@ -66,11 +93,11 @@ namespace fmt {
             template<typename FormatContext> auto format(const RoundAction& action, FormatContext& ctx) const {
                 if (action.getAmount() == 0) {
                     return fmt::format_to(
-                        ctx.out(), "Player {} {} after {}", action.getPlayer().getNumber(), action.getAction(), action.getTime());
+                        ctx.out(), "Player {} {} after {}", action.getPlayerNum(), action.getAction(), action.getTime());
                 } else {
                     return fmt::format_to(ctx.out(),
                                           "Player {} {} {} after {}",
-                                          action.getPlayer().getNumber(),
+                                          action.getPlayerNum(),
                                           action.getAction(),
                                           action.getAmount(),
                                           action.getTime());
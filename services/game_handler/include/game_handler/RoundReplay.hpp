@@ -0,0 +1,56 @@
+#pragma once
+
+#include <optional>
+
+#include <game_handler/Round.hpp>
+
+namespace GameHandler {
+    // Compact record of a call to the Round actions API
+    struct LoggedAction {
+        public:
+            enum class Type : uint8_t { CALL = 0, BET, RAISE_TO, CHECK, FOLD, ALL_IN, SHOWDOWN };
+
+            Type    type      = Type::CHECK;
+            uint8_t playerNum = 0;
+            int32_t amount    = 0;  // The bet amount or the raise total amount
+
+            auto operator==(const LoggedAction& other) const -> bool = default;
+    };
+
+    /**
+     * @brief Everything needed to play a round again: the round constructor arguments, the cards and the actions API calls.
+     */
+    struct RoundLog {
+        public:
+            Blinds                           blinds;
+            int32_t                          dealerNum = 0;
+            StaticVector<int32_t, MAX_SEATS> stacks;  // Starting stack by player number, 0 for an eliminated player
+            std::array<Hand, MAX_SEATS>      hands;
+            Board::board_t                   board;
+            std::vector<LoggedAction>        actions;
+    };
+
+    /**
+     * @brief Replay round logs on a fresh Round, the players are reused from one replay to the next.
+     */
+    class RoundReplayer {
+        public:
+            RoundReplayer()                           = default;
+            RoundReplayer(const RoundReplayer& other) = delete;
+            RoundReplayer(RoundReplayer&& other)      = delete;
+
+            ~RoundReplayer() = default;
+
+            auto operator=(const RoundReplayer& other) -> RoundReplayer& = delete;
+            auto operator=(RoundReplayer&& other) -> RoundReplayer&      = delete;
+
+            // The returned round is valid until the next replay
+            auto replay(const RoundLog& log) -> Round&;
+
+            static auto apply(Round& round, const LoggedAction& action) -> void;
+
+        private:
+            std::vector<Player>  _players;
+            std::optional<Round> _round;
+    };
+}  // namespace GameHandler
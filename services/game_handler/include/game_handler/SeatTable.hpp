@@ -0,0 +1,168 @@
+#pragma once
+
+#include <span>
+#include <utility>
+
+#include <game_handler/Player.hpp>
+#include <game_handler/RoundAction.hpp>
+
+namespace GameHandler {
+    using ActionType = RoundAction::ActionType;
+
+    static const int32_t MIN_SEATS = 2;
+    static const int32_t MAX_SEATS = 9;
+
+    // Positions are given from the dealer, the ones after the big blind are named from the end (cutoff, hijack, ...)
+    enum Position : int32_t {
+        DEALER = 0,
+        SMALL_BLIND,
+        BIG_BLIND,
+        UNDER_THE_GUN,
+        UNDER_THE_GUN_1,
+        MIDDLE,
+        LOJACK,
+        HIJACK,
+        CUTOFF
+    };
+
+    /**
+     * @brief A player's status during a round.
+     *
+     * Plain data copied from the Player when the round starts, the round writes the stack and status back to the player after each action.
+     */
+    struct Seat {
+        public:
+            int32_t    number         = 0;  // Same as the player number
+            int32_t    stack          = 0;
+            int32_t    initialStack   = 0;
+            int32_t    totalBet       = 0;
+            int32_t    totalStreetBet = 0;
+            ActionType lastAction     = ActionType::NONE;
+            Position   position       = DEALER;
+            bool       inRound        = false;
+            bool       isAllIn        = false;
+            bool       eliminated     = false;
+
+            auto winChips(int32_t chips) -> void { stack += chips; }
+            auto payBigBlind(int32_t amount) -> void { _updateStatus(std::min(amount, stack), ActionType::PAY_BIG_BLIND); }
+            auto paySmallBlind(int32_t amount) -> void { _updateStatus(std::min(amount, stack), ActionType::PAY_SMALL_BLIND); }
+            auto hasBet(int32_t amount) -> void { _updateStatus(amount, ActionType::BET); }
+            auto hasRaised(int32_t amount) -> void { _updateStatus(amount, ActionType::RAISE); }
+            auto hasCalled(int32_t amount) -> void { _updateStatus(amount, ActionType::CALL); }
+            auto hasChecked() -> void { lastAction = ActionType::CHECK; }
+            auto bust() -> void { eliminated = true; }
+
+            auto hasFolded() -> void {
+                inRound    = false;
+                lastAction = ActionType::FOLD;
+            }
+
+            auto streetReset() -> void {
+                totalStreetBet = 0;
+                lastAction     = ActionType::NONE;
+            }
+
+        private:
+            auto _updateStatus(int32_t amount, ActionType action) -> void {
+                totalBet       += amount;
+                totalStreetBet += amount;
+                isAllIn         = totalBet == initialStack;
+                stack           = initialStack - totalBet;
+
+                if (action != ActionType::PAY_BIG_BLIND && action != ActionType::PAY_SMALL_BLIND) { lastAction = action; }
+            }
+    };
+
+    /**
+     * @brief Contiguous seats of a table from 2 to 9 seats, the seat number is the player number (1-based).
+     *
+     * The hands are stored apart from the seats so the seats status iterations only walk through the hot data.
+     */
+    class SeatTable {
+        public:
+            using seats_t = std::array<Seat, MAX_SEATS>;
+            using hands_t = std::array<Hand, MAX_SEATS>;
+
+            SeatTable() = default;
+            SeatTable(std::span<const Player> players, int32_t dealerNumber);
+
+            [[nodiscard]] auto begin() -> Seat* { return _seats.data(); }
+            [[nodiscard]] auto end() -> Seat* { return _seats.data() + _size; }
+            [[nodiscard]] auto begin() const -> const Seat* { return _seats.data(); }
+            [[nodiscard]] auto end() const -> const Seat* { return _seats.data() + _size; }
+            [[nodiscard]] auto size() const -> int32_t { return _size; }
+            [[nodiscard]] auto nextSeatNum(int32_t seatNum) const -> int32_t { return (seatNum % _size) + 1; }
+            [[nodiscard]] auto getSmallBlindNum() const -> int32_t { return _smallBlindNum; }
+            [[nodiscard]] auto getBigBlindNum() const -> int32_t { return _bigBlindNum; }
+
+            [[nodiscard]] auto at(int32_t seatNum) -> Seat& { return _seats[_index(seatNum)]; }
+            [[nodiscard]] auto at(int32_t seatNum) const -> const Seat& { return _seats[_index(seatNum)]; }
+            [[nodiscard]] auto hand(int32_t seatNum) -> Hand& { return _hands[_index(seatNum)]; }
+            [[nodiscard]] auto hand(int32_t seatNum) const -> const Hand& { return _hands[_index(seatNum)]; }
+
+            /**
+             * @brief The small and big blinds seat numbers of a round, only the seats dealt in the round pay the blinds.
+             *
+             * @param isDealt Tells if the given seat number is dealt in the round.
+             */
+            template<typename IsDealt>
+            [[nodiscard]] static auto blindsSeatNum(int32_t dealerNumber, int32_t seatsNumber, IsDealt&& isDealt)
+                -> std::pair<int32_t, int32_t> {
+                auto dealtNumber = 0;
+
+                for (int32_t seatNum = 1; seatNum <= seatsNumber; ++seatNum) { dealtNumber += isDealt(seatNum) ? 1 : 0; }
+
+                if (dealtNumber < MIN_SEATS) { throw std::invalid_argument("The blinds need at least 2 dealt seats"); }
+
+                auto nextDealt = [&](int32_t seatNum) {
+                    do { seatNum = (seatNum % seatsNumber) + 1; } while (!isDealt(seatNum));
+
+                    return seatNum;
+                };
+                // Heads-up, the dealer is also the small blind
+                auto smallBlindNum = dealtNumber > MIN_SEATS ? nextDealt(dealerNumber) : dealerNumber;
+
+                return {smallBlindNum, nextDealt(smallBlindNum)};
+            }
+
+        private:
+            seats_t _seats         = {};
+            hands_t _hands         = {};
+            int32_t _size          = 0;
+            int32_t _smallBlindNum = 0;
+            int32_t _bigBlindNum   = 0;
+
+            [[nodiscard]] auto _index(int32_t seatNum) const -> std::size_t {
+                if (seatNum <= 0 || seatNum > _size) { throw std::invalid_argument("The given player number is invalid"); }
+
+                return static_cast<std::size_t>(seatNum - 1);
+            }
+
+            [[nodiscard]] static auto _getPosition(int32_t offsetFromDealer, int32_t playersNumber) -> Position;
+    };
+}  // namespace GameHandler
+
+// Custom formatter for Position
+namespace fmt {
+    using GameHandler::Position;
+
+    template<> struct formatter<Position> : formatter<string_view> {
+            template<typename FormatContext> auto format(Position position, FormatContext& ctx) const {
+                string_view name = "unknown";
+
+                switch (position) {
+                    case Position::DEALER: name = "dealer"; break;
+                    case Position::SMALL_BLIND: name = "small_blind"; break;
+                    case Position::BIG_BLIND: name = "big_blind"; break;
+                    case Position::UNDER_THE_GUN: name = "under_the_gun"; break;
+                    case Position::UNDER_THE_GUN_1: name = "under_the_gun_1"; break;
+                    case Position::MIDDLE: name = "middle"; break;
+                    case Position::LOJACK: name = "lojack"; break;
+                    case Position::HIJACK: name = "hijack"; break;
+                    case Position::CUTOFF: name = "cutoff"; break;
+                }
+
+                return formatter<string_view>::format(name, ctx);
+            }
+    };
+}  // namespace fmt
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <ranges>
+
+#include <game_handler/SeatTable.hpp>
+#include <game_handler/StaticVector.hpp>
+
+namespace GameHandler {
+    using players_num_t = StaticVector<int32_t, MAX_SEATS>;
+    using ranking_t     = StaticVector<players_num_t, MAX_SEATS>;  // Rank steps from the last to the first
+
+    // The ranking rank steps from the first to the last one
+    inline auto rankStepsFromFirst(const ranking_t& ranking) -> std::ranges::reverse_view<std::ranges::ref_view<const ranking_t>> {
+        return ranking | std::views::reverse;
+    }
+
+    struct Pot {
+        public:
+            int32_t       amount = 0;
+            players_num_t eligiblePlayersNum {};
+            players_num_t winnersNum {};
+
+            auto operator==(const Pot& other) const -> bool = default;
+    };
+
+    /**
+     * @brief Main pot and side pots built from the seats contributions at the end of a round.
+     *
+     * There is one pot per distinct all in level, each pot can only be won by the players still in the round who contributed
+     * at least this level. The folded players chips are added to the pots without making them eligible.
+     */
+    class SidePots {
+        public:
+            using pots_t = StaticVector<Pot, MAX_SEATS>;
+
+            SidePots() = default;
+            explicit SidePots(const SeatTable& seats);
+
+            [[nodiscard]] auto begin() const -> pots_t::const_iterator { return _pots.begin(); }
+            [[nodiscard]] auto end() const -> pots_t::const_iterator { return _pots.end(); }
+            [[nodiscard]] auto size() const -> std::size_t { return _pots.size(); }
+            [[nodiscard]] auto operator[](std::size_t index) const -> const Pot& { return _pots[index]; }
+            [[nodiscard]] auto getTotal() const -> int32_t;
+
+            auto distribute(const ranking_t& ranking, SeatTable& seats, int32_t dealerNumber) -> void;
+
+            [[nodiscard]] auto toJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
+
+        private:
+            pots_t _pots;
+    };
+}  // namespace GameHandler
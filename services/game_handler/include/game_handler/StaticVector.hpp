@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace GameHandler {
+    /**
+     * @brief Vector with a fixed capacity stored inline, it never allocates on the heap.
+     *
+     * Used on the round actions hot path where the number of elements is bounded by the number of players.
+     */
+    template<typename T, std::size_t Capacity> class StaticVector {
+        public:
+            using value_type     = T;
+            using iterator       = T*;
+            using const_iterator = const T*;
+
+            StaticVector() = default;
+            StaticVector(std::initializer_list<T> values) {
+                for (const auto& value : values) { push_back(value); }
+            }
+
+            auto operator==(const StaticVector& other) const -> bool {
+                return _size == other._size && std::equal(begin(), end(), other.begin());
+            }
+
+            [[nodiscard]] auto operator[](std::size_t index) -> T& { return _data[index]; }
+            [[nodiscard]] auto operator[](std::size_t index) const -> const T& { return _data[index]; }
+
+            [[nodiscard]] auto begin() -> iterator { return _data.data(); }
+            [[nodiscard]] auto end() -> iterator { return _data.data() + _size; }
+            [[nodiscard]] auto begin() const -> const_iterator { return _data.data(); }
+            [[nodiscard]] auto end() const -> const_iterator { return _data.data() + _size; }
+            [[nodiscard]] auto front() -> T& { return _data[0]; }
+            [[nodiscard]] auto front() const -> const T& { return _data[0]; }
+            [[nodiscard]] auto back() -> T& { return _data[_size - 1]; }
+            [[nodiscard]] auto back() const -> const T& { return _data[_size - 1]; }
+            [[nodiscard]] auto size() const -> std::size_t { return _size; }
+            [[nodiscard]] auto empty() const -> bool { return _size == 0; }
+
+            [[nodiscard]] static constexpr auto capacity() -> std::size_t { return Capacity; }
+
+            auto push_back(const T& value) -> void {
+                if (_size == Capacity) { throw std::length_error("The static vector capacity is exceeded"); }
+
+                _data[_size++] = value;
+            }
+
+            auto pop_back() -> void { --_size; }
+            auto clear() -> void { _size = 0; }
+
+        private:
+            std::array<T, Capacity> _data = {};
+            std::size_t             _size = 0;
+    };
+}  // namespace GameHandler
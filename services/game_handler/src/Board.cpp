@@ -86,14 +86,14 @@ namespace GameHandler {
         const auto& handCards = hand.getCards();
         copy(handCards, cards.begin() + BOARD_CARDS_NUMBER);
 
-        if (_pair || count(rankF, 2) == 1) { rank = PAIR; }
-        if (_twoPair || count(rankF, 2) == 2) { rank = TWO_PAIR; }
+        if (_pair || count(rankF, 2) >= 1) { rank = PAIR; }
+        if (_twoPair || count(rankF, 2) >= 2) { rank = TWO_PAIR; }
         if (_trips || count(rankF, 3) == 1) { rank = TRIPS; }
         if (straight) { rank = STRAIGHT; }
         if (_flush || any_of(suitF, [](const auto& value) { return value >= FLUSH_SIZE; })) { rank = FLUSH; }
         if (_full || (count(rankF, 3) == 2 || (count(rankF, 3) == 1 && count(rankF, 2) >= 1))) { rank = FULL; }
         if (_quads || count(rankF, 4) == 1) { rank = QUADS; }
-        if (_straightFlush || (rank == FLUSH && straight && _isStraightFlush(cards, rankF, suitF))) { rank = STRAIGHT_FLUSH; }
+        if (_straightFlush || (rank == FLUSH && straight && _isStraightFlush(cards, suitF))) { rank = STRAIGHT_FLUSH; }
 
         return rank;
     }
@@ -134,6 +134,31 @@ namespace GameHandler {
         return cardsArray;
     }
 
+    auto Board::writeJson(JsonWriter& writer) const -> void {
+        writer.startArray();
+
+        for_each(_cards, [&writer](const Card& card) {
+            if (!card.isUnknown()) { card.writeJson(writer); }
+        });
+
+        writer.endArray();
+    }
+
+    auto Board::fromJson(JsonReader& reader) -> Board {
+        board_t     cards;
+        std::size_t cardsNumber = 0;
+
+        reader.startArray();
+
+        while (reader.nextElement()) {
+            if (cardsNumber == BOARD_CARDS_NUMBER) { throw invalid_json("A board cannot have more than 5 cards"); }
+
+            cards.at(cardsNumber++) = Card::fromJson(reader);
+        }
+
+        return Board(cards);
+    }
+
     auto Board::toDetailedJson() const -> json {
         auto cardsArray = json::array();
 
@@ -250,90 +275,67 @@ namespace GameHandler {
         _straightFlush     = _straight && _flush;
     }
 
-    auto Board::_isStraightFlush(const all_cards_t& cards, rank_f_t& rankF, suit_f_t& suitF) -> bool {
-        auto suit = static_cast<Card::Suit>(distance(suitF.begin(), find_if(suitF, [](int32_t val) { return val >= STRAIGHT_SIZE; })));
+    auto Board::_isStraightFlush(const all_cards_t& cards, const suit_f_t& suitF) -> bool {
+        auto suit = static_cast<Card::Suit>(distance(suitF.begin(), find_if(suitF, [](int32_t val) { return val >= FLUSH_SIZE; })));
 
-        auto extractCards = [&](int32_t index, std::vector<Card>& extractedCards) {
-            for (const auto& card : cards) {
-                if (card.getRank() == index) { extractedCards.emplace_back(card); }
-            }
-        };
-
-        // Special Ace case
-        rankF[0] = rankF[ACE];
-
-        for (int32_t i = 0; i < static_cast<int32_t>(rankF.size() - STRAIGHT_SIZE + 1); ++i) {
-            auto window = counted(rankF.begin() + i, STRAIGHT_SIZE);
-
-            if (count_if(window, [](const auto& value) { return value >= 1; }) >= STRAIGHT_SIZE) {
-                bool    isStraightFlush = true;
-                int32_t j               = 0;
-
-                while (isStraightFlush && j < STRAIGHT_SIZE) {
-                    std::vector<Card> straightCards;
-
-                    extractCards(i + j++, straightCards);
-
-                    if (all_of(straightCards, [&](const auto& card) { return card.getSuit() != suit; })) { isStraightFlush = false; }
-                }
-
-                if (isStraightFlush) { return true; }
-            }
+        rank_f_t suitedRankF {};
+        // A straight among the flush suit cards only
+        for (const auto& card : cards) {
+            if (card.getSuit() == suit) { suitedRankF.at(card.getRank())++; }
         }
 
-        // Reset special Ace case
-        rankF[0] = 0;
-
-        return false;
+        return _countPossibleStraights(0, suitedRankF) >= 1;
     }
 
     auto Board::_extractComboFromStraightOrFlush(const all_cards_t& cards, HandRank rank, rank_f_t& rankF, suit_f_t& suitF)
         -> combo_t {
-        std::vector<Card> combo;
-        int32_t           index               = STRAIGHT_SIZE;
-        auto              rankFrequenciesSize = static_cast<int32_t>(rankF.size());
-        Card::Suit        suit                = Card::Suit::UNKNOWN;
-
-        // Special Ace case
-        rankF[0] = rankF[ACE];
+        combo_t combo;
+        auto    suit = static_cast<Card::Suit>(distance(suitF.begin(), find_if(suitF, [](int32_t val) { return val >= FLUSH_SIZE; })));
 
-        auto isRankEndIndex = [](const auto& window) {
-            return count_if(window, [](const auto& value) { return value >= 1; }) == STRAIGHT_SIZE;
-        };
+        auto sameSuit = [&](const Card& card) { return rank == STRAIGHT || card.getSuit() == suit; };
 
-        auto flushSuitIndex = [](const suit_f_t& frequencies) {
-            return distance(frequencies.begin(), find_if(frequencies, [](int32_t val) { return val >= STRAIGHT_SIZE; }));
-        };
+        // One card by rank of the highest straight, from its highest card to the lowest one, the ace is the lowest in a wheel
+        auto extractStraight = [&](rank_f_t frequencies) {
+            // Special Ace case
+            frequencies[0] = frequencies[ACE];
 
-        auto inStraightRange = [&](const Card& card, int32_t startRank) {
-            return card.getRank() >= startRank && card.getRank() <= startRank + STRAIGHT_SIZE;
-        };
+            for (int32_t highRank = ACE; highRank >= STRAIGHT_SIZE - 1; --highRank) {
+                auto window = counted(frequencies.begin() + highRank - (STRAIGHT_SIZE - 1), STRAIGHT_SIZE);
 
-        auto window = counted(rankF.end() - index, STRAIGHT_SIZE);
+                if (count_if(window, [](const auto& value) { return value >= 1; }) < STRAIGHT_SIZE) { continue; }
 
-        switch (rank) {
-            case STRAIGHT:
-                while (!isRankEndIndex(window)) { window = counted(rankF.end() - ++index, STRAIGHT_SIZE); }
+                for (int32_t cardRank = highRank; cardRank > highRank - STRAIGHT_SIZE; --cardRank) {
+                    auto cardIt = find_if(cards, [&](const Card& card) {
+                        return card.getRank() == (cardRank == 0 ? ACE : cardRank) && sameSuit(card);
+                    });
 
-                for (const auto& card : cards) {
-                    if (inStraightRange(card, rankFrequenciesSize - index)) { combo.push_back(card); }
+                    combo.push_back(*cardIt);
                 }
-                break;
-            case FLUSH:
-                suit = static_cast<Card::Suit>(flushSuitIndex(suitF));
 
+                return;
+            }
+        };
+
+        switch (rank) {
+            case STRAIGHT: extractStraight(rankF); break;
+            case FLUSH:
                 for (const auto& card : cards) {
                     if (card.getSuit() == suit) { combo.push_back(card); }
                 }
+                // The 5 highest cards of the suit
+                sort(combo, [](const Card& A, const Card& B) { return A.getRank() > B.getRank(); });
+                combo.erase(combo.begin() + FLUSH_SIZE, combo.end());
                 break;
-            case STRAIGHT_FLUSH:
-                while (!isRankEndIndex(window)) { window = counted(rankF.end() - ++index, STRAIGHT_SIZE); }
-                suit = static_cast<Card::Suit>(flushSuitIndex(suitF));
+            case STRAIGHT_FLUSH: {
+                rank_f_t suitedRankF {};
 
                 for (const auto& card : cards) {
-                    if (inStraightRange(card, rankFrequenciesSize - index) && card.getSuit() == suit) { combo.push_back(card); }
+                    if (card.getSuit() == suit) { suitedRankF.at(card.getRank())++; }
                 }
+
+                extractStraight(suitedRankF);
                 break;
+            }
             default: throw std::invalid_argument("The given hand rank is invalid");
         }
 
@@ -360,11 +362,23 @@ namespace GameHandler {
                 extractCombo(TRIPS_SIZE);
                 _trimCombo(TRIPS, combo);
                 break;
-            case FULL:
-                extractCombo(TRIPS_SIZE);
-                extractCombo(PAIR_SIZE);
-                _trimCombo(FULL, combo);
+            case FULL: {
+                // The highest trips then the highest other rank with at least a pair, it can be a second trips
+                int32_t tripsRank = ACE;
+                int32_t pairRank  = ACE;
+
+                while (rankFrequencies[tripsRank] < TRIPS_SIZE) { --tripsRank; }
+                while (pairRank == tripsRank || rankFrequencies[pairRank] < PAIR_SIZE) { --pairRank; }
+
+                for (const auto& card : cards) {
+                    if (card.getRank() == tripsRank) { combo.push_back(card); }
+                }
+
+                for (const auto& card : cards) {
+                    if (card.getRank() == pairRank && combo.size() < FULL_SIZE) { combo.push_back(card); }
+                }
                 break;
+            }
             case QUADS: extractCombo(QUADS_SIZE); break;
             default: throw std::invalid_argument("The given hand rank is invalid");
         }
@@ -400,7 +414,7 @@ namespace GameHandler {
     }
 
     // Find the highest cards that are not in the combo
-    auto Board::_extractHigherCards(all_cards_t& cards, HandRank rank, const combo_t& combo) -> best_hand_t {
+    auto Board::_extractHigherCards(all_cards_t& cards, const combo_t& combo) -> best_hand_t {
         best_hand_t higherCards;
         auto        currentSize      = combo.size();
         int         highestCardIndex = 0;
@@ -409,15 +423,8 @@ namespace GameHandler {
         copy(combo, higherCards.begin());
         // Sort the all the cards by rank in descending order
         sort(cards, [](const Card& A, const Card& B) { return A.getRank() > B.getRank(); });
-        // Sort the higher cards by rank in descending order for needed hand ranks
-        if (rank == TWO_PAIR || rank == STRAIGHT || rank == FLUSH || rank == FULL || rank == STRAIGHT_FLUSH) {
-            sort(higherCards, [](const Card& A, const Card& B) { return A.getRank() > B.getRank(); });
-            // Put trips cards in the first 3 positions
-            if (rank == FULL && count(combo, higherCards.front()) != TRIPS_SIZE) {
-                std::swap(higherCards[0], higherCards[4]);
-                std::swap(higherCards[1], higherCards[3]);
-            }
-        }
+        // The combo is already ordered from its most significant card, e.g. the trips before the pair of a full or the 5 before
+        // the ace of a wheel straight, so only the kickers are added
         // Add additional higher rank cards to the higher cards array
         while (currentSize < COMPARISON_CARDS_NUMBER) {
             auto& highestCard = cards[highestCardIndex++];
@@ -449,8 +456,8 @@ namespace GameHandler {
         if (any_of(suitFrequencies, [](const auto& value) { return value >= FLUSH_SIZE; })) { rank = FLUSH; }
         if (count(rankFrequencies, 3) == 2 || (count(rankFrequencies, 3) == 1 && count(rankFrequencies, 2) >= 1)) { rank = FULL; }
         if (count(rankFrequencies, 4) == 1) { rank = QUADS; }
-        if (rank == FLUSH && straight && _isStraightFlush(cards, rankFrequencies, suitFrequencies)) { rank = STRAIGHT_FLUSH; }
+        if (rank == FLUSH && straight && _isStraightFlush(cards, suitFrequencies)) { rank = STRAIGHT_FLUSH; }
 
-        return {rank, _extractHigherCards(cards, rank, _extractCombo(cards, rank, rankFrequencies, suitFrequencies))};
+        return {rank, _extractHigherCards(cards, _extractCombo(cards, rank, rankFrequencies, suitFrequencies))};
     }
 }  // namespace GameHandler
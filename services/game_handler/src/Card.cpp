@@ -1,5 +1,7 @@
 #include "game_handler/Card.hpp"
 
+#include "game_handler/CardFactory.hpp"
+
 namespace GameHandler {
     using std::ranges::find;
 
@@ -30,4 +32,29 @@ namespace GameHandler {
     auto Card::toJson() const -> json {
         return {{"shortName", fmt::format("{:s}", *this)}, {"rank", fmt::format("{:l}", _rank)}, {"suit", fmt::format("{:l}", _suit)}};
     }
+
+    auto Card::writeJson(JsonWriter& writer) const -> void {
+        writer.startObject();
+        writer.key("shortName").value("{:s}", *this);
+        writer.key("rank").value("{:l}", _rank);
+        writer.key("suit").value("{:l}", _suit);
+        writer.endObject();
+    }
+
+    auto Card::fromJson(JsonReader& reader) -> Card {
+        Card             card;
+        std::string_view key;
+
+        reader.startObject();
+
+        while (reader.nextKey(key)) {
+            if (key == "shortName") {
+                card = Factory::card(std::string(reader.readString()));
+            } else {
+                std::ignore = reader.skipValue();
+            }
+        }
+
+        return card;
+    }
 }  // namespace GameHandler
\ No newline at end of file
@@ -1,76 +1,283 @@
 #include "game_handler/Game.hpp"
 
+#include "game_handler/HandHistory.hpp"
+
+#include <fstream>
+
 namespace GameHandler {
     using std::ranges::any_of;
     using std::ranges::for_each;
 
     auto Game::operator=(Game&& other) noexcept -> Game& {
         if (this != &other) {
-            _rounds       = std::move(other._rounds);
-            _players      = std::move(other._players);
-            _startTime    = other._startTime;
-            _endTime      = other._endTime;
-            _buyIn        = other._buyIn;
-            _multipliers  = other._multipliers;
-            _initialStack = other._initialStack;
-            _complete     = other._complete;
+            _rounds          = std::move(other._rounds);
+            _spilledRounds   = std::move(other._spilledRounds);
+            _roundsFragment  = std::move(other._roundsFragment);
+            _players         = std::move(other._players);
+            _results         = std::move(other._results);
+            _segmentPath     = std::move(other._segmentPath);
+            _handHistoryPath = std::move(other._handHistoryPath);
+            _startTime       = other._startTime;
+            _endTime         = other._endTime;
+            _segmentSize     = other._segmentSize;
+            _buyIn           = other._buyIn;
+            _multipliers     = other._multipliers;
+            _initialStack    = other._initialStack;
+            _complete        = other._complete;
+            _ended           = other._ended;
         }
 
         return *this;
     }
 
-    auto Game::init(std::string_view player1Name, std::string_view player2Name, std::string_view player3Name) -> void {
-        auto nameList = {player1Name, player2Name, player3Name};
+    auto Game::init(const std::vector<std::string>& playersName) -> void {
+        if (playersName.size() < MIN_SEATS || playersName.size() > MAX_SEATS) {
+            throw std::invalid_argument(fmt::format("The players number must be between {} and {}", MIN_SEATS, MAX_SEATS));
+        }
+
+        if (any_of(playersName, [](const auto& name) { return name.empty(); })) {
+            std::string names;
+
+            for (std::size_t i = 0; i < playersName.size(); ++i) {
+                names += fmt::format("{}player_{} `{}`", i == 0 ? "" : ", ", i + 1, playersName[i]);
+            }
 
-        if (any_of(nameList, [](const auto& name) { return name.empty(); })) {
-            throw invalid_player_name(fmt::format(
-                "A player's name is empty, player_1 `{}`, player_2 `{}`, player_3 `{}`", player1Name, player2Name, player3Name));
+            throw invalid_player_name(fmt::format("A player's name is empty, {}", names));
         }
 
-        _players[0] = Player(player1Name, 1);
-        _players[1] = Player(player2Name, 2);
-        _players[2] = Player(player3Name, 3);
+        _players.clear();
+        _players.reserve(playersName.size());
 
-        for (auto& player : _players) { player.setStack(_initialStack); }
+        for (const auto& name : playersName) {
+            auto& player = _players.emplace_back(name, static_cast<int32_t>(_players.size()) + 1);
+
+            player.setStack(_initialStack);
+        }
 
         _startTime = system_clock::now();
     }
 
+    /**
+     * @brief Enable the spill mode, the ended rounds are appended to the segment file as JSON lines and evicted from memory.
+     *
+     * Only a compact summary of the spilled rounds is kept, toJson() streams them back from the segment file.
+     */
+    auto Game::spillRoundsTo(const std::filesystem::path& segmentPath) -> void {
+        _segmentPath = segmentPath;
+        _segmentSize = std::filesystem::exists(segmentPath) ? static_cast<std::streamoff>(std::filesystem::file_size(segmentPath)) : 0;
+
+        _finalizeEndedRounds();
+    }
+
     auto Game::end() -> void {
         _endTime = system_clock::now();
         _ended   = true;
+
+        _finalizeEndedRounds();
+
+        if (!_handHistoryPath.empty()) { HandHistoryWriter::write(*this, _handHistoryPath); }
+    }
+
+    /**
+     * @brief Call the callback on each round in order, the spilled rounds are rebuilt from the segment file.
+     */
+    auto Game::forEachRound(const std::function<void(const Round&)>& callback) const -> void {
+        if (!_spilledRounds.empty()) {
+            auto players = _players;  // The rebuilt rounds update their players stacks
+
+            _forEachSpilledRound([&callback, &players](std::string_view roundFragment) {
+                JsonReader reader(roundFragment);
+
+                callback(Round::fromJson(reader, players));
+            });
+        }
+
+        for_each(_rounds, callback);
     }
 
     auto Game::newRound(const Blinds& blinds, const Hand& hand, int32_t dealerNumber) -> Round& {
+        _finalizeEndedRounds();
         _rounds.emplace_back(blinds, _players, hand, dealerNumber);
 
         return _rounds.back();
     }
 
     auto Game::getPlayer(int32_t playerNum) const -> const Player& {
-        if (playerNum <= 0 || playerNum > 3) { throw std::invalid_argument("The given player number is invalid"); }
+        if (playerNum <= 0 || playerNum > getPlayersNumber()) { throw std::invalid_argument("The given player number is invalid"); }
 
         return _players.at(playerNum - 1);
     }
 
-    auto Game::toJson() const -> json {
-        auto roundsArray      = json::array();
-        auto playersNameArray = json::array();
-
-        for_each(_rounds, [&roundsArray](const Round& round) { roundsArray.emplace_back(round.toJson()); });
-        for_each(_players, [&playersNameArray](const Player& player) { playersNameArray.emplace_back(player.getName()); });
-
-        return {{"rounds", roundsArray},
-                {"players", playersNameArray},
-                {"won", _isGameWon()},
-                {"buy_in", _buyIn},
-                {"multipliers", _multipliers},
-                {"balance", _computeBalance()},
-                {"duration", duration_cast<seconds>(_endTime - _startTime).count()},
-                {"complete", _complete}};
+    /**
+     * @brief Parse the game JSON written by dump(), the ended rounds come from their cached JSON instead of being rebuilt.
+     */
+    auto Game::toJson() const -> json { return json::parse(dump()); }
+
+    /**
+     * @brief Stream the game JSON into the writer, the ended rounds are copied from their cached JSON.
+     *
+     * Only the rounds in progress are serialized, so publishing the game after each round only costs the new round.
+     */
+    auto Game::writeJson(JsonWriter& writer) const -> void {
+        writer.startObject();
+        writer.key("rounds").startArray();
+
+        _forEachSpilledRound([&writer](std::string_view roundFragment) { writer.raw(roundFragment); });
+        for_each(_roundsFragment, [&writer](const std::string& roundFragment) { writer.raw(roundFragment); });
+
+        for (auto round = _rounds.begin() + static_cast<std::ptrdiff_t>(_roundsFragment.size()); round != _rounds.end(); ++round) {
+            round->writeJson(writer);
+        }
+
+        writer.endArray();
+        writer.key("players").startArray();
+        for_each(_players, [&writer](const Player& player) { writer.value(player.getName()); });
+        writer.endArray();
+        writer.key("won").value(_isGameWon());
+        writer.key("buy_in").value(_buyIn);
+        writer.key("multipliers").value(_multipliers);
+        writer.key("balance").value(_computeBalance());
+        writer.key("duration").value(duration_cast<seconds>(_endTime - _startTime).count());
+        writer.key("complete").value(_complete);
+        writer.key("results");
+        _results.writeJson(writer);
+        writer.endObject();
+    }
+
+    auto Game::dump() const -> std::string {
+        JsonWriter writer;
+
+        writeJson(writer);
+
+        return writer.str();
+    }
+
+    /**
+     * @brief Rebuild an ended game from its JSON, the rounds are rebuilt by replaying their actions.
+     *
+     * The rounds can come before the players in the JSON, their raw text is kept to be parsed once the players are known.
+     */
+    auto Game::fromJson(std::string_view json) -> Game {
+        Game                     game;
+        JsonReader               reader(json);
+        std::vector<std::string> playersName;
+        std::string_view         roundsJson;
+        std::string_view         key;
+        int64_t                  duration = 0;
+
+        reader.startObject();
+
+        while (reader.nextKey(key)) {
+            if (key == "players") {
+                reader.startArray();
+                while (reader.nextElement()) { playersName.emplace_back(reader.readString()); }
+            } else if (key == "buy_in") {
+                game._buyIn = reader.readInt();
+            } else if (key == "multipliers") {
+                game._multipliers = reader.readInt();
+            } else if (key == "complete") {
+                game._complete = reader.readBool();
+            } else if (key == "duration") {
+                duration = reader.readInt<int64_t>();
+            } else if (key == "rounds") {
+                roundsJson = reader.skipValue();
+            } else {
+                std::ignore = reader.skipValue();
+            }
+        }
+
+        game.init(playersName);
+
+        if (!roundsJson.empty()) {
+            JsonReader roundsReader(roundsJson);
+
+            roundsReader.startArray();
+
+            while (roundsReader.nextElement()) { game._rounds.push_back(Round::fromJson(roundsReader, game._players)); }
+        }
+        // The results are rebuilt from the rounds rather than read back
+        game._finalizeEndedRounds();
+
+        if (!game._rounds.empty()) { game._initialStack = game._rounds.front().getSeats().at(1).initialStack; }
+
+        game._endTime = game._startTime + seconds(duration);
+        game._ended   = true;
+
+        return game;
+    }
+
+    auto Game::fromJsonFile(const std::filesystem::path& path) -> Game {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file.is_open()) { throw std::runtime_error(fmt::format("Cannot open the game file {}", path.string())); }
+
+        std::string json(std::filesystem::file_size(path), '\0');
+
+        file.read(json.data(), static_cast<std::streamsize>(json.size()));
+
+        return fromJson(json);
+    }
+
+    /**
+     * @brief Serialize the ended rounds once, in order, until the first round still in progress, and spill them in spill mode.
+     *
+     * A round is considered final when a new round starts or when the game ends, it is not serialized again after.
+     */
+    auto Game::_finalizeEndedRounds() -> void {
+        auto       round = _rounds.begin() + static_cast<std::ptrdiff_t>(_roundsFragment.size());
+        JsonWriter writer;
+
+        for (; round != _rounds.end() && !round->isInProgress(); ++round) {
+            _results.add(*round);
+            writer.clear();
+            round->writeJson(writer);
+            _roundsFragment.emplace_back(writer.view());
+        }
+
+        _spillRoundsFragment();
+    }
+
+    /**
+     * @brief Append the cached rounds to the segment file as JSON lines and evict them from memory.
+     */
+    auto Game::_spillRoundsFragment() -> void {
+        if (_segmentPath.empty() || _roundsFragment.empty()) { return; }
+
+        std::ofstream segment(_segmentPath, std::ios::binary | std::ios::app);
+
+        if (!segment.is_open()) { throw std::runtime_error(fmt::format("Cannot open the rounds segment {}", _segmentPath.string())); }
+
+        for (std::size_t i = 0; i < _roundsFragment.size(); ++i) {
+            const auto& roundFragment = _roundsFragment[i];
+
+            segment << roundFragment << '\n';
+
+            _spilledRounds.push_back(
+                {.offset = _segmentSize, .size = roundFragment.size(), .pot = _rounds[i].getPot(), .won = _rounds[i].hasWon()});
+            _segmentSize += static_cast<std::streamoff>(roundFragment.size() + 1);
+        }
+
+        _rounds.erase(_rounds.begin(), _rounds.begin() + static_cast<std::ptrdiff_t>(_roundsFragment.size()));
+        _roundsFragment.clear();
+    }
+
+    auto Game::_forEachSpilledRound(const std::function<void(std::string_view)>& callback) const -> void {
+        if (_spilledRounds.empty()) { return; }
+
+        std::ifstream segment(_segmentPath, std::ios::binary);
+        std::string   roundFragment;
+
+        if (!segment.is_open()) { throw std::runtime_error(fmt::format("Cannot open the rounds segment {}", _segmentPath.string())); }
+
+        for (const auto& summary : _spilledRounds) {
+            roundFragment.resize(summary.size);
+            segment.seekg(summary.offset);
+            segment.read(roundFragment.data(), static_cast<std::streamsize>(summary.size));
+            callback(roundFragment);
+        }
     }
 
     auto Game::_computeBalance() const -> int32_t { return _buyIn * ((_isGameWon() ? _multipliers : 0) - 1); }
 
-    auto Game::_isGameWon() const -> bool { return _players[0].getStack() != 0; }
+    auto Game::_isGameWon() const -> bool { return !_players.empty() && _players[0].getStack() != 0; }
 }  // namespace GameHandler
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "game_handler/GameResults.hpp"
+
+namespace GameHandler {
+    using fmt::format;
+
+    namespace {
+        auto chipsResultToJson(const ChipsResult& result) -> json { return {{"rounds", result.rounds}, {"chips", result.chips}}; }
+
+        auto writeChipsResult(JsonWriter& writer, const ChipsResult& result) -> void {
+            writer.startObject();
+            writer.key("rounds").value(result.rounds);
+            writer.key("chips").value(result.chips);
+            writer.endObject();
+        }
+
+        auto readChipsResult(JsonReader& reader, int32_t* bigBlind = nullptr) -> ChipsResult {
+            ChipsResult      result;
+            std::string_view key;
+
+            reader.startObject();
+
+            while (reader.nextKey(key)) {
+                if (key == "rounds") {
+                    result.rounds = reader.readInt<int64_t>();
+                } else if (key == "chips") {
+                    result.chips = reader.readInt<int64_t>();
+                } else if (key == "big_blind" && bigBlind != nullptr) {
+                    *bigBlind = reader.readInt();
+                } else {
+                    std::ignore = reader.skipValue();
+                }
+            }
+
+            return result;
+        }
+
+        // The index of the position or street named as its formatter does, -1 when unknown
+        template<typename Enum> auto indexByName(std::string_view name, int32_t count) -> int32_t {
+            for (int32_t index = 0; index < count; ++index) {
+                if (format("{}", static_cast<Enum>(index)) == name) { return index; }
+            }
+
+            return -1;
+        }
+
+        // The street the hero folded on, the showdown when it was contested, the last street played otherwise
+        auto heroLastStreet(const Round& round) -> Round::Street {
+            const auto& actions  = round.getActions();
+            auto        inRound  = round.getSeats().at(1).inRound;
+            auto        street   = static_cast<int32_t>(Round::PREFLOP);
+            auto        lastPlay = street;
+
+            if (inRound && round.getInRoundPlayersNum().size() > 1) { return Round::SHOWDOWN; }
+
+            for (; street < Round::SHOWDOWN; ++street) {
+                for (const auto& action : actions.at(street)) {
+                    if (!inRound && action.getPlayerNum() == 1 && action.getAction() == ActionType::FOLD) {
+                        return static_cast<Round::Street>(street);
+                    }
+
+                    lastPlay = street;
+                }
+            }
+
+            return static_cast<Round::Street>(lastPlay);
+        }
+    }  // namespace
+
+    auto GameResults::getTotal() const -> ChipsResult {
+        ChipsResult total;
+
+        total.merge(_showdown);
+        total.merge(_nonShowdown);
+
+        return total;
+    }
+
+    auto GameResults::add(const Round& round) -> void {
+        const auto& recaps = round.getPlayersRoundRecap();
+        auto        hero   = std::ranges::find_if(recaps, [](const PlayerRoundRecap& recap) { return recap.playerNumber == 1; });
+        // The round did not end, or the hero was not dealt in
+        if (hero == recaps.end() || hero->startStack == 0) { return; }
+
+        auto chips    = static_cast<int64_t>(hero->endStack) - hero->startStack;
+        auto street   = heroLastStreet(round);
+        auto showdown = street == Round::SHOWDOWN;
+
+        _blindLevels[round.getBlinds().BB()].add(chips);
+        _positions.at(round.getSeats().at(1).position).add(chips);
+        _streets.at(street).add(chips);
+        (showdown ? _showdown : _nonShowdown).add(chips);
+    }
+
+    auto GameResults::merge(const GameResults& other) -> void {
+        for (const auto& [bigBlind, result] : other._blindLevels) { _blindLevels[bigBlind].merge(result); }
+
+        for (std::size_t position = 0; position < _positions.size(); ++position) {
+            _positions[position].merge(other._positions[position]);
+        }
+
+        for (std::size_t street = 0; street < _streets.size(); ++street) { _streets[street].merge(other._streets[street]); }
+
+        _showdown.merge(other._showdown);
+        _nonShowdown.merge(other._nonShowdown);
+    }
+
+    /**
+     * @brief The blind levels as an array sorted by big blind, the positions played and every street as objects keyed by name.
+     */
+    auto GameResults::toJson() const -> json {
+        auto blindLevels = json::array();
+        auto positions   = json::object();
+        auto streets     = json::object();
+
+        for (const auto& [bigBlind, result] : _blindLevels) {
+            auto level = chipsResultToJson(result);
+
+            level["big_blind"] = bigBlind;
+            blindLevels.push_back(level);
+        }
+
+        for (int32_t position = 0; position < MAX_SEATS; ++position) {
+            if (_positions.at(position).rounds != 0) {
+                positions[format("{}", static_cast<Position>(position))] = chipsResultToJson(_positions.at(position));
+            }
+        }
+
+        for (int32_t street = 0; street < STREET_NUMBER; ++street) {
+            streets[format("{}", static_cast<Round::Street>(street))] = chipsResultToJson(_streets.at(street));
+        }
+
+        return {{"blind_levels", blindLevels},
+                {"positions", positions},
+                {"streets", streets},
+                {"showdown", chipsResultToJson(_showdown)},
+                {"non_showdown", chipsResultToJson(_nonShowdown)}};
+    }
+
+    auto GameResults::writeJson(JsonWriter& writer) const -> void {
+        writer.startObject();
+        writer.key("blind_levels").startArray();
+
+        for (const auto& [bigBlind, result] : _blindLevels) {
+            writer.startObject();
+            writer.key("rounds").value(result.rounds);
+            writer.key("chips").value(result.chips);
+            writer.key("big_blind").value(bigBlind);
+            writer.endObject();
+        }
+
+        writer.endArray();
+        writer.key("positions").startObject();
+
+        for (int32_t position = 0; position < MAX_SEATS; ++position) {
+            if (_positions.at(position).rounds == 0) { continue; }
+
+            writer.key("{}", static_cast<Position>(position));
+            writeChipsResult(writer, _positions.at(position));
+        }
+
+        writer.endObject();
+        writer.key("streets").startObject();
+
+        for (int32_t street = 0; street < STREET_NUMBER; ++street) {
+            writer.key("{}", static_cast<Round::Street>(street));
+            writeChipsResult(writer, _streets.at(street));
+        }
+
+        writer.endObject();
+        writer.key("showdown");
+        writeChipsResult(writer, _showdown);
+        writer.key("non_showdown");
+        writeChipsResult(writer, _nonShowdown);
+        writer.endObject();
+    }
+
+    auto GameResults::fromJson(JsonReader& reader) -> GameResults {
+        GameResults      results;
+        std::string_view key;
+
+        reader.startObject();
+
+        while (reader.nextKey(key)) {
+            if (key == "blind_levels") {
+                reader.startArray();
+
+                while (reader.nextElement()) {
+                    int32_t bigBlind = 0;
+                    auto    result   = readChipsResult(reader, &bigBlind);
+
+                    results._blindLevels[bigBlind].merge(result);
+                }
+            } else if (key == "positions" || key == "streets") {
+                auto isPosition = key == "positions";
+
+                reader.startObject();
+
+                while (reader.nextKey(key)) {
+                    auto index = isPosition ? indexByName<Position>(key, MAX_SEATS) : indexByName<Round::Street>(key, STREET_NUMBER);
+
+                    if (index == -1) { throw invalid_json(format("Unknown game results key `{}`", key)); }
+
+                    (isPosition ? results._positions.at(index) : results._streets.at(index)) = readChipsResult(reader);
+                }
+            } else if (key == "showdown") {
+                results._showdown = readChipsResult(reader);
+            } else if (key == "non_showdown") {
+                results._nonShowdown = readChipsResult(reader);
+            } else {
+                std::ignore = reader.skipValue();
+            }
+        }
+
+        return results;
+    }
+}  // namespace GameHandler
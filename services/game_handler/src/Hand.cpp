@@ -66,6 +66,30 @@ namespace GameHandler {
         return cardsArray;
     }
 
+    auto Hand::writeJson(JsonWriter& writer) const -> void {
+        writer.startArray();
+
+        if (!_firstCard.isUnknown()) { _firstCard.writeJson(writer); }
+        if (!_secondCard.isUnknown()) { _secondCard.writeJson(writer); }
+
+        writer.endArray();
+    }
+
+    auto Hand::fromJson(JsonReader& reader) -> Hand {
+        std::array<Card, HAND_CARDS_NUMBER> cards;
+        std::size_t                         cardsNumber = 0;
+
+        reader.startArray();
+
+        while (reader.nextElement()) {
+            if (cardsNumber == HAND_CARDS_NUMBER) { throw invalid_json("A hand cannot have more than 2 cards"); }
+
+            cards.at(cardsNumber++) = Card::fromJson(reader);
+        }
+
+        return cardsNumber == 0 ? Hand() : Hand(cards[0], cards[1]);
+    }
+
     auto Hand::toDetailedJson() const -> json {
         auto cardsArray = json::array();
 
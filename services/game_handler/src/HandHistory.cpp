@@ -0,0 +1,375 @@
+#include "game_handler/HandHistory.hpp"
+
+#include <fstream>
+
+#ifdef _WIN32
+
+    #include <windows.h>
+
+#else
+
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+namespace GameHandler {
+    using HandHistoryFormat::ACTION_RECORD_SIZE;
+    using HandHistoryFormat::COMPLETE_FLAG;
+    using HandHistoryFormat::RECORDED_STREETS;
+    using HandHistoryFormat::ROUND_SIZE_BYTES;
+    using HandHistoryFormat::UNKNOWN_CARD;
+    using HandHistoryFormat::VARINT_CONTINUE_BIT;
+    using HandHistoryFormat::VARINT_PAYLOAD_BITS;
+    using HandHistoryFormat::VARINT_PAYLOAD_MASK;
+    using HandHistoryFormat::WON_FLAG;
+    using HandHistoryFormat::readU16;
+    using HandHistoryFormat::readVarint;
+
+    namespace {
+        auto appendVarint(std::string& buffer, uint64_t value) -> void {
+            while (value > VARINT_PAYLOAD_MASK) {
+                buffer   += static_cast<char>((value & VARINT_PAYLOAD_MASK) | VARINT_CONTINUE_BIT);
+                value   >>= VARINT_PAYLOAD_BITS;
+            }
+
+            buffer += static_cast<char>(value);
+        }
+
+        auto appendU16(std::string& buffer, uint16_t value) -> void {
+            buffer += static_cast<char>(value & 0xFF);
+            buffer += static_cast<char>(value >> 8);
+        }
+
+        auto appendCard(std::string& buffer, const Card& card) -> void {
+            buffer += static_cast<char>(card.isUnknown() ? UNKNOWN_CARD : (card.getRank() << 2) | card.getSuit());
+        }
+
+        auto encodeRound(std::string& buffer, const Round& round, int32_t playersNumber) -> void {
+            auto sizeOffset = buffer.size();
+
+            buffer.append(ROUND_SIZE_BYTES, '\0');
+            buffer += static_cast<char>(round.getDealerNum());
+            buffer += static_cast<char>(round.hasWon() ? WON_FLAG : 0);
+
+            for (const auto& card : round.getBoard().getCards()) { appendCard(buffer, card); }
+
+            for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+                auto hand = round.getPlayerHand(playerNum);
+
+                for (const auto& card : hand.getCards()) { appendCard(buffer, card); }
+            }
+
+            appendVarint(buffer, static_cast<uint64_t>(round.getBlinds().SB()));
+            appendVarint(buffer, static_cast<uint64_t>(round.getBlinds().BB()));
+            appendVarint(buffer, static_cast<uint64_t>(round.getPot()));
+            // A round still in progress has no recap yet, its current stacks are recorded
+            auto recapOf = [&round](int32_t playerNum) {
+                for (const auto& recap : round.getPlayersRoundRecap()) {
+                    if (recap.playerNumber == playerNum) { return recap; }
+                }
+
+                const auto& seat = round.getSeats().at(playerNum);
+
+                return PlayerRoundRecap(playerNum, seat.initialStack, seat.stack);
+            };
+
+            for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+                appendVarint(buffer, static_cast<uint64_t>(recapOf(playerNum).startStack));
+            }
+
+            for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+                appendVarint(buffer, static_cast<uint64_t>(recapOf(playerNum).endStack));
+            }
+
+            buffer += static_cast<char>(round.getRanking().size());
+
+            for (const auto& rankStep : round.getRanking()) {
+                buffer += static_cast<char>(rankStep.size());
+
+                for (auto playerNum : rankStep) { buffer += static_cast<char>(playerNum); }
+            }
+
+            for (int32_t street = Round::PREFLOP; street < RECORDED_STREETS; ++street) {
+                const auto& actions = round.getActions().at(street);
+
+                appendVarint(buffer, actions.size());
+
+                for (const auto& action : actions) {
+                    buffer += static_cast<char>(action.getAction());
+                    buffer += static_cast<char>(action.getPlayerNum());
+                    appendU16(buffer, static_cast<uint16_t>(std::min<int64_t>(action.getTime().count(), UINT16_MAX)));
+                }
+
+                for (const auto& action : actions) { appendVarint(buffer, static_cast<uint64_t>(action.getAmount())); }
+            }
+
+            auto size = static_cast<uint32_t>(buffer.size() - sizeOffset - ROUND_SIZE_BYTES);
+
+            for (std::size_t i = 0; i < ROUND_SIZE_BYTES; ++i) {
+                buffer[sizeOffset + i] = static_cast<char>((size >> (8 * i)) & 0xFF);
+            }
+        }
+
+        auto readU32(const uint8_t* cursor) -> uint32_t {
+            return static_cast<uint32_t>(cursor[0]) | (static_cast<uint32_t>(cursor[1]) << 8)
+                 | (static_cast<uint32_t>(cursor[2]) << 16) | (static_cast<uint32_t>(cursor[3]) << 24);
+        }
+    }  // namespace
+
+    auto HandHistoryWriter::encode(const Game& game) -> std::string {
+        std::string buffer;
+
+        buffer.append(HAND_HISTORY_MAGIC.data(), HAND_HISTORY_MAGIC.size());
+        appendU16(buffer, HAND_HISTORY_VERSION);
+        buffer += static_cast<char>(game.getPlayersNumber());
+        buffer += static_cast<char>((game.isComplete() ? COMPLETE_FLAG : 0) | (game.isWon() ? WON_FLAG : 0));
+        appendVarint(buffer, static_cast<uint64_t>(game.getBuyIn()));
+        appendVarint(buffer, static_cast<uint64_t>(game.getMultipliers()));
+        appendVarint(buffer, static_cast<uint64_t>(game.getInitialStack()));
+        appendVarint(buffer, static_cast<uint64_t>(game.getDuration().count()));
+        // String table
+        for (int32_t playerNum = 1; playerNum <= game.getPlayersNumber(); ++playerNum) {
+            const auto name = game.getPlayer(playerNum).getName();
+
+            appendVarint(buffer, name.size());
+            buffer += name;
+        }
+
+        appendVarint(buffer, game.getRoundsNumber());
+        game.forEachRound([&buffer, &game](const Round& round) { encodeRound(buffer, round, game.getPlayersNumber()); });
+
+        return buffer;
+    }
+
+    auto HandHistoryWriter::write(const Game& game, const std::filesystem::path& path) -> void {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) { throw std::runtime_error(fmt::format("Cannot open the hand history file {}", path.string())); }
+
+        auto buffer = encode(game);
+
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    RoundView::RoundView(std::span<const uint8_t> record, int32_t playersNumber)
+      : _record(record)
+      , _playersNumber(playersNumber) {
+        const auto* cursor = _record.data() + 2 + BOARD_CARDS_NUMBER + 2 * playersNumber;
+
+        if (cursor > _end()) { throw invalid_hand_history("Truncated round record"); }
+
+        _blinds.smallBlind = static_cast<int32_t>(readVarint(cursor, _end()));
+        _blinds.bigBlind   = static_cast<int32_t>(readVarint(cursor, _end()));
+        _pot               = static_cast<int32_t>(readVarint(cursor, _end()));
+
+        for (int32_t i = 0; i < playersNumber; ++i) { _startStacks.at(i) = static_cast<int32_t>(readVarint(cursor, _end())); }
+        for (int32_t i = 0; i < playersNumber; ++i) { _endStacks.at(i) = static_cast<int32_t>(readVarint(cursor, _end())); }
+        // Skip the ranking
+        if (cursor >= _end()) { throw invalid_hand_history("Truncated round record"); }
+
+        for (auto rankSteps = *cursor++; rankSteps > 0 && cursor < _end(); --rankSteps) { cursor += *cursor + 1; }
+        // Index the streets, the actions are only decoded by forEachAction()
+        for (int32_t street = 0; street < RECORDED_STREETS; ++street) {
+            if (cursor >= _end()) { throw invalid_hand_history("Truncated round record"); }
+
+            auto actionsNumber = readVarint(cursor, _end());
+
+            if (actionsNumber > static_cast<uint64_t>(_end() - cursor) / ACTION_RECORD_SIZE) {
+                throw invalid_hand_history("Truncated round record");
+            }
+
+            _actionsNumbers.at(street) = static_cast<int32_t>(actionsNumber);
+            _streetRecords.at(street)  = cursor;
+            cursor += actionsNumber * ACTION_RECORD_SIZE;
+
+            for (uint64_t i = 0; i < actionsNumber; ++i) { std::ignore = readVarint(cursor, _end()); }
+        }
+    }
+
+    auto RoundView::getBoardCard(int32_t index) const -> Card {
+        if (index < 0 || index >= BOARD_CARDS_NUMBER) { throw std::invalid_argument("The given board card index is invalid"); }
+
+        return HandHistoryFormat::decodeCard(_record[2 + index]);
+    }
+
+    auto RoundView::getPlayerHand(int32_t playerNum) const -> Hand {
+        if (playerNum <= 0 || playerNum > _playersNumber) { throw std::invalid_argument("The given player number is invalid"); }
+
+        auto offset     = static_cast<std::size_t>(2 + BOARD_CARDS_NUMBER + 2 * (playerNum - 1));
+        auto firstCard  = HandHistoryFormat::decodeCard(_record[offset]);
+        auto secondCard = HandHistoryFormat::decodeCard(_record[offset + 1]);
+
+        return firstCard.isUnknown() ? Hand() : Hand(firstCard, secondCard);
+    }
+
+    auto RoundView::getStartStack(int32_t playerNum) const -> int32_t {
+        if (playerNum <= 0 || playerNum > _playersNumber) { throw std::invalid_argument("The given player number is invalid"); }
+
+        return _startStacks.at(playerNum - 1);
+    }
+
+    auto RoundView::getEndStack(int32_t playerNum) const -> int32_t {
+        if (playerNum <= 0 || playerNum > _playersNumber) { throw std::invalid_argument("The given player number is invalid"); }
+
+        return _endStacks.at(playerNum - 1);
+    }
+
+    auto RoundView::getActionsNumber(Round::Street street) const -> int32_t {
+        if (street < Round::PREFLOP || street >= RECORDED_STREETS) { throw std::invalid_argument("The given street is invalid"); }
+
+        return _actionsNumbers.at(street);
+    }
+
+    auto HandHistoryReader::iterator::operator*() const -> RoundView {
+        return {{_cursor + ROUND_SIZE_BYTES, _recordSize()}, _playersNumber};
+    }
+
+    auto HandHistoryReader::iterator::operator++() -> iterator& {
+        _cursor += ROUND_SIZE_BYTES + _recordSize();
+
+        return *this;
+    }
+
+    auto HandHistoryReader::iterator::_recordSize() const -> std::size_t {
+        if (_end - _cursor < static_cast<std::ptrdiff_t>(ROUND_SIZE_BYTES)) { throw invalid_hand_history("Truncated round record"); }
+
+        auto size = static_cast<std::size_t>(readU32(_cursor));
+
+        if (static_cast<std::size_t>(_end - _cursor) - ROUND_SIZE_BYTES < size) {
+            throw invalid_hand_history("Truncated round record");
+        }
+
+        return size;
+    }
+
+    HandHistoryReader::HandHistoryReader(const std::filesystem::path& path) {
+        _map(path);
+
+        try {
+            _parseHeader();
+        } catch (...) {
+            _unmap();
+            throw;
+        }
+    }
+
+    HandHistoryReader::~HandHistoryReader() { _unmap(); }
+
+    auto HandHistoryReader::_parseHeader() -> void {
+        static constexpr std::size_t FIXED_HEADER_SIZE = HAND_HISTORY_MAGIC.size() + 4;
+
+        const auto* end = _data + _size;
+
+        if (_size < FIXED_HEADER_SIZE || !std::equal(HAND_HISTORY_MAGIC.begin(), HAND_HISTORY_MAGIC.end(), _data)) {
+            throw invalid_hand_history("The file is not a hand history");
+        }
+
+        _version = readU16(_data + HAND_HISTORY_MAGIC.size());
+
+        if (_version != HAND_HISTORY_VERSION) {
+            throw invalid_hand_history(fmt::format("Unsupported hand history version {}", _version));
+        }
+
+        auto        playersNumber = static_cast<int32_t>(_data[HAND_HISTORY_MAGIC.size() + 2]);
+        const auto* cursor        = _data + FIXED_HEADER_SIZE;
+
+        if (playersNumber < MIN_SEATS || playersNumber > MAX_SEATS) { throw invalid_hand_history("Invalid players number"); }
+
+        _flags        = _data[HAND_HISTORY_MAGIC.size() + 3];
+        _buyIn        = static_cast<int32_t>(readVarint(cursor, end));
+        _multipliers  = static_cast<int32_t>(readVarint(cursor, end));
+        _initialStack = static_cast<int32_t>(readVarint(cursor, end));
+        _duration     = seconds(readVarint(cursor, end));
+        // String table, the names are views on the mapped file
+        for (int32_t i = 0; i < playersNumber; ++i) {
+            auto nameSize = readVarint(cursor, end);
+
+            if (static_cast<uint64_t>(end - cursor) < nameSize) { throw invalid_hand_history("Truncated players name"); }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            _playersName.push_back({reinterpret_cast<const char*>(cursor), nameSize});
+            cursor += nameSize;
+        }
+
+        _roundsNumber = readVarint(cursor, end);
+        _rounds       = cursor;
+    }
+
+#ifdef _WIN32
+
+    auto HandHistoryReader::_map(const std::filesystem::path& path) -> void {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error(fmt::format("Cannot open the hand history file {}", path.string()));
+        }
+
+        LARGE_INTEGER fileSize;
+
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            throw invalid_hand_history("The file is not a hand history");
+        }
+
+        _mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (_mapping == nullptr) { throw std::runtime_error(fmt::format("Cannot map the hand history file {}", path.string())); }
+
+        _data = static_cast<const uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        _size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        if (_data == nullptr) {
+            CloseHandle(_mapping);
+            throw std::runtime_error(fmt::format("Cannot map the hand history file {}", path.string()));
+        }
+    }
+
+    auto HandHistoryReader::_unmap() -> void {
+        if (_data != nullptr) { UnmapViewOfFile(_data); }
+        if (_mapping != nullptr) { CloseHandle(_mapping); }
+
+        _data    = nullptr;
+        _mapping = nullptr;
+    }
+
+#else
+
+    auto HandHistoryReader::_map(const std::filesystem::path& path) -> void {
+        auto file = open(path.c_str(), O_RDONLY);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+        if (file == -1) { throw std::runtime_error(fmt::format("Cannot open the hand history file {}", path.string())); }
+
+        struct stat fileStat {};
+
+        if (fstat(file, &fileStat) == -1 || fileStat.st_size == 0) {
+            close(file);
+            throw invalid_hand_history("The file is not a hand history");
+        }
+
+        _size    = static_cast<std::size_t>(fileStat.st_size);
+        _mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+
+        if (_mapping == MAP_FAILED) {
+            _mapping = nullptr;
+            throw std::runtime_error(fmt::format("Cannot map the hand history file {}", path.string()));
+        }
+
+        _data = static_cast<const uint8_t*>(_mapping);
+    }
+
+    auto HandHistoryReader::_unmap() -> void {
+        if (_mapping != nullptr) { munmap(_mapping, _size); }
+
+        _data    = nullptr;
+        _mapping = nullptr;
+    }
+
+#endif
+}  // namespace GameHandler
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,50 @@
+#include "game_handler/NamePool.hpp"
+
+#include <mutex>
+#include <stdexcept>
+
+namespace GameHandler {
+    NamePool::NamePool() {
+        _names.emplace_back(DEFAULT_NAME);
+        _ids.emplace(_names.back(), DEFAULT_NAME_ID);
+    }
+
+    auto NamePool::instance() -> NamePool& {
+        static NamePool pool;
+
+        return pool;
+    }
+
+    auto NamePool::intern(std::string_view name) -> name_id_t {
+        {
+            std::shared_lock lock(_mutex);
+
+            if (auto nameId = _ids.find(name); nameId != _ids.end()) { return nameId->second; }
+        }
+
+        std::unique_lock lock(_mutex);
+        // Another thread may have interned the name between the two locks
+        if (auto nameId = _ids.find(name); nameId != _ids.end()) { return nameId->second; }
+
+        auto nameId = static_cast<name_id_t>(_names.size());
+
+        _names.emplace_back(name);
+        _ids.emplace(_names.back(), nameId);
+
+        return nameId;
+    }
+
+    auto NamePool::resolve(name_id_t nameId) const -> std::string_view {
+        std::shared_lock lock(_mutex);
+
+        if (nameId >= _names.size()) { throw std::invalid_argument("Unknown player name id"); }
+
+        return _names[nameId];
+    }
+
+    auto NamePool::size() const -> std::size_t {
+        std::shared_lock lock(_mutex);
+
+        return _names.size();
+    }
+}  // namespace GameHandler
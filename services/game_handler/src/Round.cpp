@@ -19,86 +19,35 @@ namespace GameHandler {
     using enum Round::Street;
 
     namespace {
-        auto playerIsInRound   = [](const PlayerStatus& player) { return player.inRound; };
-        auto playerIsAllIn     = [](const PlayerStatus& player) { return player.isAllIn; };
-        auto playerIsNotBusted = [](const PlayerStatus& player) { return !player.isEliminated(); };
+        auto seatIsInRound = [](const Seat& seat) { return seat.inRound; };
+        auto seatIsAllIn   = [](const Seat& seat) { return seat.isAllIn; };
     }  // namespace
 
-    Round::Round(const Blinds& blinds, std::array<Player, 3>& players, Hand hand, int32_t dealerNumber)
+    Round::Round(const Blinds& blinds, std::span<Player> players, Hand hand, int32_t dealerNumber)
       : _blinds(blinds)
-      , _players(&players)
-      , _lastActionTime(system_clock::now())
-      , _hand(hand)
-      , _dealerPlayerNum(dealerNumber)
       , _currentPlayerNum(dealerNumber)
-      , _playersStatus(std::make_unique<players_status_t>(players_status_t {{PlayerStatus {&players[0], dealerNumber},
-                                                                             PlayerStatus {&players[1], dealerNumber},
-                                                                             PlayerStatus {&players[2], dealerNumber}}})) {
-        auto remainingPlayers = count_if(*_playersStatus, playerIsNotBusted);
-
-        if (remainingPlayers == 3) {
-            _smallBlindPlayerNum = _getNextPlayerNum(dealerNumber);
-        } else {
-            _smallBlindPlayerNum = dealerNumber;
-        }
+      , _dealerPlayerNum(dealerNumber)
+      , _hand(hand)
+      , _lastActionTime(system_clock::now())
+      , _players(players)
+      , _seats(players, dealerNumber) {
+        _smallBlindPlayerNum = _seats.getSmallBlindNum();
+        _bigBlindPlayerNum   = _seats.getBigBlindNum();
 
-        _bigBlindPlayerNum = _getNextPlayerNum(_smallBlindPlayerNum);
+        for (auto& streetActions : _actions) { streetActions.reserve(RESERVED_ACTIONS_PER_STREET); }
 
-        _getPlayerStatus(1).hand = std::move(hand);
+        _seats.hand(1) = std::move(hand);
         _payBlinds();
-    }
-
-    auto Round::operator=(const Round& other) -> Round& {
-        if (this != &other) {
-            _actions             = other._actions;
-            _board               = other._board;
-            _ranking             = other._ranking;
-            _playersRoundRecap   = other._playersRoundRecap;
-            _blinds              = other._blinds;
-            _pot                 = other._pot;
-            _currentStreet       = other._currentStreet;
-            _lastActionTime      = other._lastActionTime;
-            _players             = other._players;
-            _ended               = other._ended;
-            _hand                = other._hand;
-            _dealerPlayerNum     = other._dealerPlayerNum;
-            _smallBlindPlayerNum = other._smallBlindPlayerNum;
-            _bigBlindPlayerNum   = other._bigBlindPlayerNum;
-            _currentPlayerNum    = other._currentPlayerNum;
-            _playerGotBusted     = other._playerGotBusted;
-            _playersStatus       = std::make_unique<players_status_t>(*_playersStatus);
-        }
-
-        return *this;
-    }
-
-    auto Round::operator=(Round&& other) noexcept -> Round& {
-        if (this != &other) {
-            _actions             = std::move(other._actions);
-            _board               = std::move(other._board);
-            _ranking             = std::move(other._ranking);
-            _playersStatus       = std::move(other._playersStatus);
-            _hand                = std::move(other._hand);
-            _playersRoundRecap   = other._playersRoundRecap;
-            _dealerPlayerNum     = other._dealerPlayerNum;
-            _smallBlindPlayerNum = other._smallBlindPlayerNum;
-            _bigBlindPlayerNum   = other._bigBlindPlayerNum;
-            _currentPlayerNum    = other._currentPlayerNum;
-            _blinds              = other._blinds;
-            _pot                 = other._pot;
-            _currentStreet       = other._currentStreet;
-            _lastActionTime      = other._lastActionTime;
-            _players             = other._players;
-            _ended               = other._ended;
-            _playerGotBusted     = other._playerGotBusted;
-        }
+        // The blinds can put the players all in, there is nothing left to play when the last one has already matched them
+        auto activeSeats = _seats | filter([](const Seat& seat) { return seat.inRound && !seat.isAllIn; });
+        auto activeCount = std::ranges::distance(activeSeats);
 
-        return *this;
+        if (activeCount == 0 || (activeCount == 1 && activeSeats.front().totalStreetBet >= _lastBetOrRaise)) { _currentStreet = SHOWDOWN; }
     }
 
     auto Round::call(int32_t playerNum) -> void {
-        auto& player         = _getPlayerStatus(playerNum);
-        auto  computedAmount = std::min(_lastBetOrRaise - player.totalStreetBet, player.getStack());
+        const auto& seat           = _seats.at(playerNum);
+        auto        computedAmount = std::min(_lastBetOrRaise - seat.totalStreetBet, seat.stack);
 
         _setAction(playerNum, CALL, computedAmount);
     }
@@ -106,8 +55,7 @@ namespace GameHandler {
     auto Round::bet(int32_t playerNum, int32_t amount) -> void { _setAction(playerNum, BET, amount); }
 
     auto Round::raiseTo(int32_t playerNum, int32_t amount) -> void {
-        auto& player         = _getPlayerStatus(playerNum);
-        auto  computedAmount = amount - player.totalStreetBet;
+        auto computedAmount = amount - _seats.at(playerNum).totalStreetBet;
 
         _setAction(playerNum, RAISE, computedAmount);
     }
@@ -116,39 +64,121 @@ namespace GameHandler {
     auto Round::fold(int32_t playerNum) -> void { _setAction(playerNum, FOLD); }
 
     auto Round::allIn(int32_t playerNum) -> void {
-        const auto& player = _getPlayerStatus(playerNum);
+        const auto& seat = _seats.at(playerNum);
 
         if (_streetPot == 0) {
-            bet(playerNum, player.initialStack - player.totalBet);
-        } else if (player.getStack() > _lastBetOrRaise) {
-            raiseTo(playerNum, player.initialStack);
+            bet(playerNum, seat.initialStack - seat.totalBet);
+        } else if (seat.totalStreetBet + seat.stack > _lastBetOrRaise) {
+            raiseTo(playerNum, seat.totalStreetBet + seat.stack);  // The chips bet on the previous streets are not part of the raise
         } else {
             call(playerNum);
         }
     }
 
-    auto Round::getInRoundPlayersNum() const -> std::vector<int32_t> {
-        std::vector<int32_t> inRoundPlayersNum;
+    auto Round::getInRoundPlayersNum() const -> players_num_t {
+        players_num_t inRoundPlayersNum;
 
-        for (const auto& player : *_playersStatus) {
-            if (player.inRound) { inRoundPlayersNum.emplace_back(player.getNumber()); }
-        }
+        for (const auto& seat : _seats | filter(seatIsInRound)) { inRoundPlayersNum.push_back(seat.number); }
 
         return inRoundPlayersNum;
     }
 
     auto Round::isNextActionTheLastStreetOne(int32_t playerNum) const -> bool {
         // All other players in the round are all in
-        return !any_of(*_playersStatus, [playerNum](const auto& player) {
-            return player.inRound && player.getNumber() != playerNum && !player.isAllIn;
-        });
+        return !any_of(_seats, [playerNum](const Seat& seat) { return seat.inRound && seat.number != playerNum && !seat.isAllIn; });
     }
 
-    auto Round::getCurrentPlayerStack(int32_t playerNum) const -> int32_t { return _getPlayerStatus(playerNum).getStack(); }
+    auto Round::getCurrentPlayerStack(int32_t playerNum) const -> int32_t { return _seats.at(playerNum).stack; }
     auto Round::waitingShowdown() const -> bool { return !_ended && _currentStreet == Street::SHOWDOWN; }
     auto Round::showdown() -> void { _endRound(); }
 
-    auto Round::toJson() const -> json {
+    /**
+     * @brief Save the current round state, it only copies the fixed size state so it can be done before every action.
+     *
+     * @return The version to give to rollbackTo() to restore this state.
+     */
+    auto Round::snapshot() -> version_t {
+        Snapshot snapshot {.seats             = _seats,
+                           .ranking           = _ranking,
+                           .pots              = _pots,
+                           .playersRoundRecap = _playersRoundRecap,
+                           .pot               = _pot,
+                           .streetPot         = _streetPot,
+                           .lastBetOrRaise    = _lastBetOrRaise,
+                           .currentPlayerNum  = _currentPlayerNum,
+                           .currentStreet     = _currentStreet,
+                           .currentAction     = _currentAction,
+                           .lastAction        = _lastAction,
+                           .ended             = _ended,
+                           .playerGotBusted   = _playerGotBusted};
+
+        for (int32_t street = PREFLOP; street < STREET_NUMBER; ++street) { snapshot.actionsNumber.at(street) = _actions.at(street).size(); }
+
+        _snapshots.push_back(std::move(snapshot));
+
+        return static_cast<version_t>(_snapshots.size()) - 1;
+    }
+
+    /**
+     * @brief Restore the round state saved at the given version, the later snapshots are discarded.
+     *
+     * @return The actions recorded after the given version, in order, so they can be replayed after a correction.
+     */
+    auto Round::rollbackTo(version_t version) -> std::vector<RoundAction> {
+        if (version < 0 || version >= static_cast<version_t>(_snapshots.size())) {
+            throw std::invalid_argument("The given round version is invalid");
+        }
+
+        const auto&              snapshot = _snapshots[version];
+        std::vector<RoundAction> undoneActions;
+
+        for (int32_t street = PREFLOP; street < STREET_NUMBER; ++street) {
+            auto& streetActions = _actions.at(street);
+            auto  firstUndone   = streetActions.begin() + static_cast<std::ptrdiff_t>(snapshot.actionsNumber.at(street));
+
+            undoneActions.insert(undoneActions.end(), firstUndone, streetActions.end());
+            streetActions.erase(firstUndone, streetActions.end());
+        }
+
+        _seats             = snapshot.seats;
+        _ranking           = snapshot.ranking;
+        _pots              = snapshot.pots;
+        _playersRoundRecap = snapshot.playersRoundRecap;
+        _pot               = snapshot.pot;
+        _streetPot         = snapshot.streetPot;
+        _lastBetOrRaise    = snapshot.lastBetOrRaise;
+        _currentPlayerNum  = snapshot.currentPlayerNum;
+        _currentStreet     = snapshot.currentStreet;
+        _currentAction     = snapshot.currentAction;
+        _lastAction        = snapshot.lastAction;
+        _ended             = snapshot.ended;
+        _playerGotBusted   = snapshot.playerGotBusted;
+
+        _snapshots.erase(_snapshots.begin() + version + 1, _snapshots.end());
+
+        for (const auto& seat : _seats) { _syncPlayer(seat); }
+
+        return undoneActions;
+    }
+
+    /**
+     * @brief Apply an already recorded action as is, keeping its amount and elapsed time.
+     */
+    auto Round::replay(const RoundAction& action) -> void {
+        switch (action.getAction()) {
+            case CHECK:
+            case CALL:
+            case BET:
+            case RAISE:
+            case FOLD: _applyAction(action); break;
+            default: throw std::invalid_argument(format("The action {} cannot be replayed", action.getAction()));
+        }
+    }
+
+    auto Round::toJson() const -> json { return _toJson(&RoundAction::toJson); }
+    auto Round::toDetailedJson() const -> json { return _toJson(&RoundAction::toDetailedJson); }
+
+    auto Round::_toJson(action_to_json_t actionToJson) const -> json {
         if (_ranking.empty()) { throw std::runtime_error("The round's ranking has not been set"); }
 
         auto preFlopActions = json::array();
@@ -157,19 +187,20 @@ namespace GameHandler {
         auto riverActions   = json::array();
         auto hands          = json::object();
 
-        for_each(_actions[PREFLOP], [&](const RoundAction& action) { preFlopActions.emplace_back(action.toJson()); });
-        for_each(_actions[FLOP], [&](const RoundAction& action) { flopActions.emplace_back(action.toJson()); });
-        for_each(_actions[TURN], [&](const RoundAction& action) { turnActions.emplace_back(action.toJson()); });
-        for_each(_actions[RIVER], [&](const RoundAction& action) { riverActions.emplace_back(action.toJson()); });
+        for_each(_actions[PREFLOP], [&](const RoundAction& action) { preFlopActions.emplace_back((action.*actionToJson)()); });
+        for_each(_actions[FLOP], [&](const RoundAction& action) { flopActions.emplace_back((action.*actionToJson)()); });
+        for_each(_actions[TURN], [&](const RoundAction& action) { turnActions.emplace_back((action.*actionToJson)()); });
+        for_each(_actions[RIVER], [&](const RoundAction& action) { riverActions.emplace_back((action.*actionToJson)()); });
 
-        for (const auto& player : *_playersStatus) { hands.emplace(format("player_{}", player.getNumber()), player.hand.toJson()); }
+        for (const auto& seat : _seats) { hands.emplace(format("player_{}", seat.number), _seats.hand(seat.number).toJson()); }
 
         return {{"actions", {{"pre_flop", preFlopActions}, {"flop", flopActions}, {"turn", turnActions}, {"river", riverActions}}},
                 {"board", _board.toJson()},
                 {"hands", hands},
                 {"blinds", {{"small", _blinds.SB()}, {"big", _blinds.BB()}}},
                 {"pot", _pot},
-                {"won", _hasWon()},
+                {"pots", _pots.toJson()},
+                {"won", hasWon()},
                 {"positions",
                  {{"dealer", format("player_{}", _dealerPlayerNum)},
                   {"small_blind", format("player_{}", _smallBlindPlayerNum)},
@@ -178,18 +209,77 @@ namespace GameHandler {
                 {"ranking", toJson(_ranking)}};
     }
 
+    /**
+     * @brief Stream the same JSON as toJson() into the writer, without building the intermediate JSON objects.
+     */
+    auto Round::writeJson(JsonWriter& writer) const -> void {
+        if (_ranking.empty()) { throw std::runtime_error("The round's ranking has not been set"); }
+
+        auto writeActions = [&](std::string_view key, Street street) {
+            writer.key(key).startArray();
+            for_each(_actions[street], [&writer](const RoundAction& action) { action.writeJson(writer); });
+            writer.endArray();
+        };
+
+        writer.startObject();
+        writer.key("actions").startObject();
+        writeActions("pre_flop", PREFLOP);
+        writeActions("flop", FLOP);
+        writeActions("turn", TURN);
+        writeActions("river", RIVER);
+        writer.endObject();
+        writer.key("board");
+        _board.writeJson(writer);
+        writer.key("hands").startObject();
+
+        for (const auto& seat : _seats) {
+            writer.key("player_{}", seat.number);
+            _seats.hand(seat.number).writeJson(writer);
+        }
+
+        writer.endObject();
+        writer.key("blinds").startObject().key("small").value(_blinds.SB()).key("big").value(_blinds.BB()).endObject();
+        writer.key("pot").value(_pot);
+        writer.key("pots");
+        _pots.writeJson(writer);
+        writer.key("won").value(hasWon());
+        writer.key("positions").startObject();
+        writer.key("dealer").value("player_{}", _dealerPlayerNum);
+        writer.key("small_blind").value("player_{}", _smallBlindPlayerNum);
+        writer.key("big_blind").value("player_{}", _bigBlindPlayerNum);
+        writer.endObject();
+        writer.key("stacks").startArray();
+
+        for (const auto& recap : _playersRoundRecap) {
+            writer.startObject();
+            writer.key("player").value("player_{}", recap.playerNumber);
+            writer.key("stack").value(recap.endStack);
+            writer.key("balance").value(recap.endStack - recap.startStack);
+            writer.endObject();
+        }
+
+        writer.endArray();
+        writer.key("ranking").startArray();
+        for (const auto& rankStep : rankStepsFromFirst(_ranking)) {
+            writer.startArray();
+
+            for (const auto& playerNum : rankStep) { writer.value("player_{}", playerNum); }
+
+            writer.endArray();
+        }
+
+        writer.endArray();
+        writer.endObject();
+    }
+
     auto Round::toJson(const ranking_t& ranking) -> json {
         auto rankingJson = json::array();
-        auto rankingCopy = ranking;
-
-        while (!rankingCopy.empty()) {
+        for (const auto& rankStep : rankStepsFromFirst(ranking)) {
             auto rankStepJson = json::array();
-            auto rankStep     = rankingCopy.top();
 
             for (const auto& playerNum : rankStep) { rankStepJson.emplace_back(fmt::format("player_{}", playerNum)); }
 
             rankingJson.emplace_back(rankStepJson);
-            rankingCopy.pop();
         }
 
         return rankingJson;
@@ -207,27 +297,133 @@ namespace GameHandler {
         return playersStack;
     }
 
-    auto Round::_getPlayerStatus(int32_t playerNum) -> PlayerStatus& {
-        if (playerNum <= 0 || playerNum > 3) { throw std::invalid_argument("The given player number is invalid"); }
+    /**
+     * @brief Rebuild a round from its JSON by replaying its actions from the round starting stacks.
+     *
+     * The players stacks are reset to the starting stacks recorded in the round recap, so a round can be rebuilt on its own.
+     */
+    auto Round::fromJson(JsonReader& reader, std::span<Player> players) -> Round {
+        round_actions_t             actions;
+        std::array<Hand, MAX_SEATS> hands;
+        Board                       board;
+        Blinds                      blinds;
+        int32_t                     dealerNumber = 0;
+        std::string_view            key;
+
+        auto readObject = [&reader, &key](auto&& readValue) {
+            reader.startObject();
+            while (reader.nextKey(key)) { readValue(); }
+        };
+
+        auto seatNumFromName = [&players](std::string_view name) {
+            auto playerNum = playerNumFromName(name);
+
+            if (playerNum <= 0 || playerNum > static_cast<int32_t>(players.size())) {
+                throw invalid_json("The given player number is invalid");
+            }
+
+            return playerNum;
+        };
+
+        reader.startObject();
+
+        while (reader.nextKey(key)) {
+            if (key == "actions") {
+                readObject([&]() {
+                    auto& streetActions = actions.at(_streetFromName(key));
+
+                    reader.startArray();
+                    while (reader.nextElement()) { streetActions.push_back(RoundAction::fromJson(reader)); }
+                });
+            } else if (key == "board") {
+                board = Board::fromJson(reader);
+            } else if (key == "hands") {
+                readObject([&]() { hands.at(seatNumFromName(key) - 1) = Hand::fromJson(reader); });
+            } else if (key == "blinds") {
+                readObject([&]() {
+                    if (key == "small") {
+                        blinds.smallBlind = reader.readInt();
+                    } else if (key == "big") {
+                        blinds.bigBlind = reader.readInt();
+                    } else {
+                        std::ignore = reader.skipValue();
+                    }
+                });
+            } else if (key == "positions") {
+                readObject([&]() {
+                    if (key == "dealer") {
+                        dealerNumber = seatNumFromName(reader.readString());
+                    } else {
+                        std::ignore = reader.skipValue();
+                    }
+                });
+            } else if (key == "stacks") {
+                reader.startArray();
+
+                while (reader.nextElement()) {
+                    PlayerRoundRecap recap;
+                    int32_t          balance = 0;
+
+                    readObject([&]() {
+                        if (key == "player") {
+                            recap.playerNumber = seatNumFromName(reader.readString());
+                        } else if (key == "stack") {
+                            recap.endStack = reader.readInt();
+                        } else if (key == "balance") {
+                            balance = reader.readInt();
+                        } else {
+                            std::ignore = reader.skipValue();
+                        }
+                    });
+
+                    if (recap.playerNumber == 0) { throw invalid_json("The given player number is invalid"); }
+
+                    auto& player = players[recap.playerNumber - 1];
+
+                    player.setStack(recap.endStack - balance);
+                    player.setEliminated(player.getStack() == 0);
+                }
+            } else {
+                std::ignore = reader.skipValue();
+            }
+        }
+
+        if (dealerNumber == 0) { throw invalid_json("The round's dealer is missing"); }
 
-        return _playersStatus->at(playerNum - 1);
+        Round round(blinds, players, hands[0], dealerNumber);
+
+        for (int32_t playerNum = 2; playerNum <= static_cast<int32_t>(players.size()); ++playerNum) {
+            round.setPlayerHand(hands.at(playerNum - 1), playerNum);
+        }
+
+        round._board = board;
+
+        for (const auto& streetActions : actions) {
+            for_each(streetActions, [&round](const RoundAction& action) { round.replay(action); });
+        }
+
+        // Only the ended rounds are serialized, a round ended by a showdown has no action after the last street one
+        if (round.isInProgress()) { round.showdown(); }
+
+        return round;
     }
 
-    auto Round::_getPlayerStatus(int32_t playerNum) const -> PlayerStatus {
-        if (playerNum <= 0 || playerNum > 3) { throw std::invalid_argument("The given player number is invalid"); }
+    auto Round::_streetFromName(std::string_view name) -> Street {
+        if (name == "pre_flop") { return PREFLOP; }
+        if (name == "flop") { return FLOP; }
+        if (name == "turn") { return TURN; }
+        if (name == "river") { return RIVER; }
 
-        return _playersStatus->at(playerNum - 1);
+        throw invalid_json(format("Unknown street `{}`", name));
     }
 
     auto Round::_getNextPlayerNum(int32_t currentPlayerNum) const -> int32_t {
-        if (currentPlayerNum <= 0 || currentPlayerNum > 3) { throw std::invalid_argument("The given player number is invalid"); }
-
-        int32_t nextPlayerNum = (currentPlayerNum % 3) + 1;
+        auto nextPlayerNum = _seats.nextSeatNum(_seats.at(currentPlayerNum).number);
 
         while (nextPlayerNum != currentPlayerNum) {
-            if (_getPlayerStatus(nextPlayerNum).inRound) { return nextPlayerNum; }
+            if (_seats.at(nextPlayerNum).inRound) { return nextPlayerNum; }
 
-            nextPlayerNum = (nextPlayerNum % 3) + 1;
+            nextPlayerNum = _seats.nextSeatNum(nextPlayerNum);
         }
 
         throw std::runtime_error("No next player found");
@@ -243,34 +439,62 @@ namespace GameHandler {
     }
 
     auto Round::_isStreetOver() const -> bool {
-        auto hasChecked = [](const PlayerStatus& player) { return !player.inRound || player.isAllIn || player.lastAction == CHECK; };
-        auto hasPlayed  = [](const PlayerStatus& player) { return !player.inRound || player.isAllIn || player.lastAction != NONE; };
-        // All in players are considered in the round, hasPlayed and hasChecked
-        auto roundPlayersCount    = count_if(*_playersStatus, playerIsInRound);
-        auto allPlayersPlayed     = all_of(*_playersStatus, hasPlayed);
-        auto allPlayersHasChecked = all_of(*_playersStatus, hasChecked);
-
-        bool currentPlayerCalled          = _currentAction.getAction() == CALL;
-        bool currentPlayerFold            = _currentAction.getAction() == FOLD;
-        bool currentPlayerCalledOrChecked = currentPlayerCalled || _currentAction.getAction() == CHECK;
-        bool currentPlayerDidNotRaise     = _lastAction.getAction() != RAISE && _lastAction.getAction() != BET;
-        bool lastPlayerCalledOrFold       = _lastAction.getAction() == CALL || _lastAction.getAction() == FOLD;
-        bool lastPlayerDidNotRaise        = _lastAction.getAction() != RAISE && _lastAction.getAction() != BET;
-
-        // clang-format off
-        return  roundPlayersCount == 1 
-            || (roundPlayersCount == 2 && allPlayersPlayed && currentPlayerCalledOrChecked)
-            || (roundPlayersCount == 2 && allPlayersPlayed && currentPlayerFold && lastPlayerCalledOrFold)
-            || (roundPlayersCount == 3 && allPlayersPlayed && currentPlayerDidNotRaise && lastPlayerDidNotRaise)
-            || allPlayersHasChecked;
-        // clang-format on
+        int32_t maxStreetBet = 0;
+
+        for (const auto& seat : _seats | filter(seatIsInRound)) { maxStreetBet = std::max(maxStreetBet, seat.totalStreetBet); }
+        // All in players are considered as done for the street, the others must have played and matched the highest bet
+        auto hasMatchedTheStreet = [maxStreetBet](const Seat& seat) {
+            return !seat.inRound || seat.isAllIn || (seat.lastAction != NONE && seat.totalStreetBet == maxStreetBet);
+        };
+
+        return count_if(_seats, seatIsInRound) <= 1 || all_of(_seats, hasMatchedTheStreet);
     }
 
     auto Round::_setAction(int32_t playerNum, ActionType actionType, int32_t amount) -> void {
-        auto& player = _getPlayerStatus(playerNum);
+        _applyAction(RoundAction(actionType, playerNum, _getAndResetLastActionTime(), amount));
+
+        if (_actionListener) { _actionListener(*this, _currentAction); }
+    }
+
+    /**
+     * @brief The metrics of an action from the running pots and the seats before the action is applied.
+     *
+     * Only the seats are walked to find the biggest opponent stack, so the cost does not depend on the round actions number.
+     */
+    auto Round::_computeMetrics(const Seat& seat, int32_t amount) const -> ActionMetrics {
+        ActionMetrics metrics;
+        int32_t       opponentsStack = 0;
+
+        for (const auto& other : _seats) {
+            if (other.inRound && other.number != seat.number) { opponentsStack = std::max(opponentsStack, other.stack); }
+        }
+
+        metrics.potBefore      = _pot;
+        metrics.toCall         = std::clamp(_lastBetOrRaise - seat.totalStreetBet, 0, seat.stack);
+        metrics.effectiveStack = std::min(seat.stack, opponentsStack);
+
+        if (metrics.toCall > 0) { metrics.potOdds = static_cast<double>(metrics.toCall) / (_pot + metrics.toCall); }
+
+        if (_pot > 0) {
+            metrics.spr            = static_cast<double>(metrics.effectiveStack) / _pot;
+            metrics.betPotFraction = static_cast<double>(amount) / _pot;
+        }
+
+        if (_blinds.BB() > 0) { metrics.betBigBlinds = static_cast<double>(amount) / _blinds.BB(); }
+
+        return metrics;
+    }
+
+    auto Round::_applyAction(const RoundAction& action) -> void {
+        auto& seat           = _seats.at(action.getPlayerNum());
+        auto  actionType     = action.getAction();
+        auto  amount         = action.getAmount();
+        auto& recordedAction = _actions.at(_currentStreet).emplace_back(action);
+
+        recordedAction.setMetrics(_computeMetrics(seat, amount));
 
         _lastAction    = _currentAction;
-        _currentAction = _actions.at(_currentStreet).emplace_back(actionType, player, _getAndResetLastActionTime(), amount);
+        _currentAction = recordedAction;
 
         if (amount != 0) {
             _pot       += amount;
@@ -278,23 +502,25 @@ namespace GameHandler {
         }
 
         switch (actionType) {
-            case CALL: player.hasCalled(amount); break;
+            case CALL: seat.hasCalled(amount); break;
             case BET:
-                player.hasBet(amount);
+                seat.hasBet(amount);
                 _lastBetOrRaise = amount;
                 break;
             case RAISE:
-                player.hasRaised(amount);
-                _lastBetOrRaise = player.totalStreetBet;
+                seat.hasRaised(amount);
+                _lastBetOrRaise = seat.totalStreetBet;
                 break;
-            case CHECK: player.hasChecked(); break;
+            case CHECK: seat.hasChecked(); break;
             case FOLD:
-                player.hasFolded();
-                _ranking.emplace(std::vector<int32_t> {player.getNumber()});
+                seat.hasFolded();
+                _ranking.push_back({action.getPlayerNum()});
                 break;
             default: break;
         }
 
+        _syncPlayer(seat);
+
         if ((actionType == FOLD || actionType == CHECK || actionType == CALL) && _isStreetOver()) {
             _endStreet();
             return;
@@ -304,14 +530,12 @@ namespace GameHandler {
     }
 
     auto Round::_determineRoundOver() -> void {
-        if (count_if(*_playersStatus, playerIsInRound) == 1) { _endRound(); }
+        if (count_if(_seats, seatIsInRound) == 1) { _endRound(); }
     }
 
     auto Round::_endStreet() -> void {
-        _updatePlayersMaxWinnable();
-
-        auto playersInRound = count_if(*_playersStatus, playerIsInRound);
-        auto playersAllIn   = count_if(*_playersStatus, playerIsAllIn);
+        auto playersInRound = count_if(_seats, seatIsInRound);
+        auto playersAllIn   = count_if(_seats, seatIsAllIn);
 
         if (playersInRound >= 2 && playersInRound - playersAllIn <= 1) { _currentStreet = SHOWDOWN; }
 
@@ -328,110 +552,84 @@ namespace GameHandler {
         if (!_ended) {
             _lastAction       = RoundAction();
             _streetPot        = 0;
-            _frozenPot        = _pot;
             _currentPlayerNum = _getNextPlayerNum(_dealerPlayerNum);
 
-            for (auto& player : *_playersStatus | filter(playerIsInRound)) { player.streetReset(); }
+            for (auto& seat : _seats | filter(seatIsInRound)) { seat.streetReset(); }
         }
     }
 
     auto Round::_endRound() -> void {
         _processRanking();
-        _updateStacks();
+        _distributePots();
 
-        for (auto& player : *_playersStatus) {
+        for (auto& seat : _seats) {
             // Bust players with no stack left
-            if (!player.isEliminated() && player.getStack() == 0) {
-                player.bust();
+            if (!seat.eliminated && seat.stack == 0) {
+                seat.bust();
                 _playerGotBusted = true;
             }
             // Store the stacks variation for each player
-            _playersRoundRecap[player.getNumber() - 1] = {player.getNumber(), player.initialStack, player.getStack()};
+            _playersRoundRecap.push_back({seat.number, seat.initialStack, seat.stack});
+            _syncPlayer(seat);
         }
 
         _ended = true;
     }
 
-    auto Round::_hasWon() const -> bool {
-        auto rankFirst = _ranking.top();
+    auto Round::hasWon() const -> bool {
+        const auto& rankFirst = _ranking.back();
 
         return find_if(rankFirst, [&](int32_t playerNum) { return playerNum == 1; }) != rankFirst.end();
     }
 
     auto Round::_processRanking() -> void {
-        std::vector<PlayerStatus> players;
-        players.reserve(_playersStatus->size());
-        // Add in round players to the players vector
-        for (const auto& playerStatus : *_playersStatus | filter(playerIsInRound)) { players.push_back(playerStatus); }
-        // Sort players by hand strength desc
-        sort(players, [&](const PlayerStatus& p1, const PlayerStatus& p2) { return _board.compareHands(p2.hand, p1.hand) > 0; });
-        // Add the first player to the _ranking stack
-        _ranking.emplace(std::vector<int32_t> {players.front().getNumber()});
-        // Iterate through the rest of players in round from last to first and add them to the _ranking stack
-        for (int32_t i = 1; i < players.size(); ++i) {
-            if (_board.compareHands(players[i].hand, _getPlayerStatus(_ranking.top().front()).hand) == 0) {
-                _ranking.top().emplace_back(players[i].getNumber());
+        auto playersNum = getInRoundPlayersNum();
+        // Sort players by hand strength asc
+        sort(playersNum, [&](int32_t p1Num, int32_t p2Num) {
+            return _board.compareHands(_seats.hand(p2Num), _seats.hand(p1Num)) > 0;
+        });
+        // Add the last player to the _ranking
+        _ranking.push_back({playersNum.front()});
+        // Iterate through the rest of players in round from last to first and add them on top of the _ranking
+        for (std::size_t i = 1; i < playersNum.size(); ++i) {
+            if (_board.compareHands(_seats.hand(playersNum[i]), _seats.hand(_ranking.back().front())) == 0) {
+                _ranking.back().push_back(playersNum[i]);
             } else {
-                _ranking.emplace(std::vector<int32_t> {players[i].getNumber()});
+                _ranking.push_back({playersNum[i]});
             }
         }
     }
 
     auto Round::_payBlinds() -> void {
-        auto& SBPlayer = _getPlayerStatus(_smallBlindPlayerNum);
-        auto& BBPlayer = _getPlayerStatus(_bigBlindPlayerNum);  // Can be the dealer if there are only 2 players
+        auto& SBSeat = _seats.at(_smallBlindPlayerNum);
+        auto& BBSeat = _seats.at(_bigBlindPlayerNum);  // Can be the dealer if there are only 2 players
 
-        SBPlayer.paySmallBlind(_blinds.SB());
-        BBPlayer.payBigBlind(_blinds.BB());
+        SBSeat.paySmallBlind(_blinds.SB());
+        BBSeat.payBigBlind(_blinds.BB());
 
-        _lastBetOrRaise  = std::max(SBPlayer.totalBet, BBPlayer.totalBet);
-        _streetPot      += SBPlayer.totalBet + BBPlayer.totalBet;
+        _lastBetOrRaise  = std::max(SBSeat.totalBet, BBSeat.totalBet);
+        _streetPot      += SBSeat.totalBet + BBSeat.totalBet;
         _pot             = _streetPot;
-    }
 
-    auto Round::_updateStacks() -> void {
-        // Use a copy of _ranking and _pot because it will be modified
-        auto ranking = _ranking;
-        auto pot     = _pot;
-        // Add pot to winner(s) stack
-        while (!ranking.empty()) {
-            auto playersNum = ranking.top();
-            // Sort players by original stacks asc and pay players by this order
-            sort(playersNum, [&](int32_t p1Num, int32_t p2Num) {
-                return _getPlayerStatus(p1Num).getStack() < _getPlayerStatus(p2Num).getStack();
-            });
-            // Number of remaining players to share the pot
-            auto remainingPlayers = static_cast<int32_t>(playersNum.size());
-
-            for (int32_t playerNum : playersNum) {
-                auto& player    = _getPlayerStatus(playerNum);
-                auto  winAmount = std::min(player.maxWinnable, pot / remainingPlayers--);
-
-                player.winChips(winAmount);
-
-                pot -= winAmount;
-            }
+        _syncPlayer(SBSeat);
+        _syncPlayer(BBSeat);
+    }
 
-            ranking.pop();
-        }
+    /**
+     * @brief Build the main and side pots from the seats contributions and pay them to the best ranked eligible players
+     */
+    auto Round::_distributePots() -> void {
+        _pots = SidePots(_seats);
+        _pots.distribute(_ranking, _seats, _dealerPlayerNum);
     }
 
     /**
-     * @brief Update the max winnable amount for each player at the end of a street
+     * @brief Write the seat stack and status back to its player, the players are ordered by number in the span.
      */
-    auto Round::_updatePlayersMaxWinnable() -> void {
-        for (auto& playerStatus : *_playersStatus) {
-            if (!playerStatus.isAllIn) {
-                playerStatus.maxWinnable = _frozenPot + _streetPot;
-            } else if (playerStatus.totalStreetBet != 0) {
-                int32_t streetWinnable = 0;
-
-                for (const auto& player : *_playersStatus) {
-                    streetWinnable += std::min(player.totalStreetBet, playerStatus.totalStreetBet);
-                }
+    auto Round::_syncPlayer(const Seat& seat) -> void {
+        auto& player = _players[seat.number - 1];
 
-                playerStatus.maxWinnable = _frozenPot + streetWinnable;
-            }
-        }
+        player.setStack(seat.stack);
+        player.setEliminated(seat.eliminated);
     }
 }  // namespace GameHandler
\ No newline at end of file
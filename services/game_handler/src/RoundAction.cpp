@@ -3,26 +3,25 @@
 namespace GameHandler {
     using enum RoundAction::ActionType;
 
-    RoundAction::RoundAction(RoundAction::ActionType action, Player player, seconds time, int32_t amount)
+    auto ActionMetrics::toJson() const -> json {
+        return {{"pot_before", potBefore},
+                {"to_call", toCall},
+                {"effective_stack", effectiveStack},
+                {"pot_odds", potOdds},
+                {"spr", spr},
+                {"bet_pot_fraction", betPotFraction},
+                {"bet_big_blinds", betBigBlinds}};
+    }
+
+    RoundAction::RoundAction(RoundAction::ActionType action, int32_t playerNum, seconds time, int32_t amount)
       : _action(action)
-      , _player(std::move(player))
+      , _playerNum(playerNum)
       , _time(time)
       , _amount(amount) {}
 
-    auto RoundAction::operator=(RoundAction&& other) noexcept -> RoundAction& {
-        if (this != &other) {
-            _action = other._action;
-            _player = std::move(other._player);
-            _time   = other._time;
-            _amount = other._amount;
-        }
-
-        return *this;
-    }
-
     auto RoundAction::toJson() const -> json {
         json object = {{"action", fmt::format("{}", _action)},
-                       {"player", fmt::format("player_{}", _player.getNumber())},
+                       {"player", fmt::format("player_{}", _playerNum)},
                        {"elapsed_time", _time.count()}};
 
         if (_requiresAmount(_action)) { object["amount"] = _amount; }
@@ -30,6 +29,56 @@ namespace GameHandler {
         return object;
     }
 
+    auto RoundAction::toDetailedJson() const -> json {
+        auto object = toJson();
+
+        object["metrics"] = _metrics.toJson();
+
+        return object;
+    }
+
+    auto RoundAction::writeJson(JsonWriter& writer) const -> void {
+        writer.startObject();
+        writer.key("action").value("{}", _action);
+        writer.key("player").value("player_{}", _playerNum);
+        writer.key("elapsed_time").value(_time.count());
+
+        if (_requiresAmount(_action)) { writer.key("amount").value(_amount); }
+
+        writer.endObject();
+    }
+
+    auto RoundAction::fromJson(JsonReader& reader) -> RoundAction {
+        RoundAction      action;
+        std::string_view key;
+
+        reader.startObject();
+
+        while (reader.nextKey(key)) {
+            if (key == "action") {
+                action._action = _actionFromName(reader.readString());
+            } else if (key == "player") {
+                action._playerNum = playerNumFromName(reader.readString());
+            } else if (key == "elapsed_time") {
+                action._time = seconds(reader.readInt<int64_t>());
+            } else if (key == "amount") {
+                action._amount = reader.readInt();
+            } else {
+                std::ignore = reader.skipValue();
+            }
+        }
+
+        return action;
+    }
+
+    auto RoundAction::_actionFromName(std::string_view name) -> ActionType {
+        for (auto action : {CHECK, CALL, BET, RAISE, FOLD, ALL_IN, PAY_SMALL_BLIND, PAY_BIG_BLIND, NONE}) {
+            if (fmt::format("{}", action) == name) { return action; }
+        }
+
+        throw invalid_json(fmt::format("Unknown round action `{}`", name));
+    }
+
     auto RoundAction::_requiresAmount(ActionType action) const -> bool {
         return action == CALL || action == BET || action == RAISE || action == ALL_IN || action == PAY_BIG_BLIND
             || action == PAY_SMALL_BLIND;
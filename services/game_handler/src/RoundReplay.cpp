@@ -0,0 +1,42 @@
+#include "game_handler/RoundReplay.hpp"
+
+namespace GameHandler {
+    auto RoundReplayer::replay(const RoundLog& log) -> Round& {
+        auto playersNumber = static_cast<int32_t>(log.stacks.size());
+        // The players names are only built when the table gets bigger
+        _players.resize(std::min<std::size_t>(_players.size(), log.stacks.size()));
+
+        while (static_cast<int32_t>(_players.size()) < playersNumber) {
+            _players.emplace_back(fmt::format("player_{}", _players.size() + 1), static_cast<int32_t>(_players.size()) + 1);
+        }
+
+        for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+            auto& player = _players[playerNum - 1];
+
+            player.setStack(log.stacks[playerNum - 1]);
+            player.setEliminated(log.stacks[playerNum - 1] == 0);
+        }
+
+        auto& round = _round.emplace(log.blinds, _players, log.hands[0], log.dealerNum);
+
+        for (int32_t playerNum = 2; playerNum <= playersNumber; ++playerNum) { round.setPlayerHand(log.hands.at(playerNum - 1), playerNum); }
+
+        round.getBoard().setCards(log.board);
+
+        for (const auto& action : log.actions) { apply(round, action); }
+
+        return round;
+    }
+
+    auto RoundReplayer::apply(Round& round, const LoggedAction& action) -> void {
+        switch (action.type) {
+            case LoggedAction::Type::CALL: round.call(action.playerNum); break;
+            case LoggedAction::Type::BET: round.bet(action.playerNum, action.amount); break;
+            case LoggedAction::Type::RAISE_TO: round.raiseTo(action.playerNum, action.amount); break;
+            case LoggedAction::Type::CHECK: round.check(action.playerNum); break;
+            case LoggedAction::Type::FOLD: round.fold(action.playerNum); break;
+            case LoggedAction::Type::ALL_IN: round.allIn(action.playerNum); break;
+            case LoggedAction::Type::SHOWDOWN: round.showdown(); break;
+        }
+    }
+}  // namespace GameHandler
@@ -0,0 +1,50 @@
+#include "game_handler/SeatTable.hpp"
+
+#include <ranges>
+
+namespace GameHandler {
+    using std::ranges::count_if;
+
+    SeatTable::SeatTable(std::span<const Player> players, int32_t dealerNumber)
+      : _size(static_cast<int32_t>(players.size())) {
+        if (_size < MIN_SEATS || _size > MAX_SEATS) {
+            throw std::invalid_argument(fmt::format("The players number must be between {} and {}", MIN_SEATS, MAX_SEATS));
+        }
+
+        for (const auto& player : players) {
+            auto& seat = at(player.getNumber());
+
+            seat.number       = player.getNumber();
+            seat.stack        = player.getStack();
+            seat.initialStack = player.getStack();
+            seat.eliminated   = player.isEliminated();
+            seat.inRound      = !player.isEliminated();
+        }
+        // The positions are only given to the players still in the game, starting from the dealer
+        auto playersNumber = static_cast<int32_t>(count_if(*this, [](const Seat& seat) { return !seat.eliminated; }));
+        auto seatNum       = at(dealerNumber).number;
+
+        for (int32_t offset = 0, i = 0; i < _size; ++i, seatNum = nextSeatNum(seatNum)) {
+            if (!at(seatNum).eliminated) { at(seatNum).position = _getPosition(offset++, playersNumber); }
+        }
+
+        auto isDealt = [this](int32_t seatNum) { return !at(seatNum).eliminated; };
+
+        std::tie(_smallBlindNum, _bigBlindNum) = blindsSeatNum(dealerNumber, _size, isDealt);
+    }
+
+    auto SeatTable::_getPosition(int32_t offsetFromDealer, int32_t playersNumber) -> Position {
+        // Heads-up, there is no small blind position
+        if (playersNumber == 2) { return offsetFromDealer == 0 ? DEALER : BIG_BLIND; }
+        if (offsetFromDealer <= BIG_BLIND) { return static_cast<Position>(offsetFromDealer); }
+
+        switch (playersNumber - offsetFromDealer) {
+            case 1: return CUTOFF;
+            case 2: return HIJACK;
+            case 3: return LOJACK;
+            case 4: return MIDDLE;
+            case 5: return UNDER_THE_GUN_1;
+            default: return UNDER_THE_GUN;
+        }
+    }
+}  // namespace GameHandler
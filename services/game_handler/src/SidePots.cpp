@@ -0,0 +1,131 @@
+#include "game_handler/SidePots.hpp"
+
+#include <ranges>
+
+namespace GameHandler {
+    using std::ranges::any_of;
+    using std::ranges::find;
+    using std::ranges::sort;
+
+    /**
+     * @brief Build the pots with a single sort of the contributions then a linear sweep over the contribution levels.
+     */
+    SidePots::SidePots(const SeatTable& seats) {
+        StaticVector<const Seat*, MAX_SEATS> contributors;
+
+        for (const auto& seat : seats) {
+            if (seat.totalBet > 0) { contributors.push_back(&seat); }
+        }
+
+        sort(contributors, [](const Seat* s1, const Seat* s2) { return s1->totalBet < s2->totalBet; });
+
+        auto    contributorsNumber = static_cast<int32_t>(contributors.size());
+        int32_t previousLevel      = 0;
+        int32_t amount             = 0;
+
+        for (int32_t i = 0; i < contributorsNumber; ++i) {
+            auto level = contributors[i]->totalBet;
+
+            if (level == previousLevel) { continue; }
+            // All the contributors from this one to the last put at least this level
+            amount        += (level - previousLevel) * (contributorsNumber - i);
+            previousLevel  = level;
+            // A pot is closed on each level reached by a player still in the round, the folded players levels are merged upward
+            bool levelInRound = false;
+
+            for (int32_t j = i; j < contributorsNumber && contributors[j]->totalBet == level; ++j) {
+                levelInRound = levelInRound || contributors[j]->inRound;
+            }
+
+            if (!levelInRound) { continue; }
+
+            Pot pot {.amount = amount};
+
+            for (int32_t j = i; j < contributorsNumber; ++j) {
+                if (contributors[j]->inRound) { pot.eligiblePlayersNum.push_back(contributors[j]->number); }
+            }
+
+            sort(pot.eligiblePlayersNum);
+            _pots.push_back(pot);
+            amount = 0;
+        }
+        // Chips folded above the highest level still in the round
+        if (amount != 0 && !_pots.empty()) { _pots.back().amount += amount; }
+    }
+
+    auto SidePots::getTotal() const -> int32_t {
+        int32_t total = 0;
+
+        for (const auto& pot : _pots) { total += pot.amount; }
+
+        return total;
+    }
+
+    /**
+     * @brief Split each pot between its best ranked eligible players.
+     *
+     * The odd chips of a split pot are given one by one to the winners, starting from the first one left of the dealer.
+     */
+    auto SidePots::distribute(const ranking_t& ranking, SeatTable& seats, int32_t dealerNumber) -> void {
+        auto leftOfDealerOrder = [&](int32_t playerNum) { return (playerNum - dealerNumber - 1 + seats.size()) % seats.size(); };
+
+        for (auto& pot : _pots) {
+            pot.winnersNum.clear();
+            for (const auto& rankStep : rankStepsFromFirst(ranking)) {
+                for (auto playerNum : rankStep) {
+                    if (find(pot.eligiblePlayersNum, playerNum) != pot.eligiblePlayersNum.end()) { pot.winnersNum.push_back(playerNum); }
+                }
+
+                if (!pot.winnersNum.empty()) { break; }
+            }
+
+            if (pot.winnersNum.empty()) { throw std::runtime_error("No winner found for a pot"); }
+
+            sort(pot.winnersNum, [&](int32_t p1Num, int32_t p2Num) { return leftOfDealerOrder(p1Num) < leftOfDealerOrder(p2Num); });
+
+            auto winnersNumber = static_cast<int32_t>(pot.winnersNum.size());
+            auto share         = pot.amount / winnersNumber;
+            auto oddChips      = pot.amount % winnersNumber;
+
+            for (auto playerNum : pot.winnersNum) { seats.at(playerNum).winChips(share + (oddChips-- > 0 ? 1 : 0)); }
+        }
+    }
+
+    auto SidePots::toJson() const -> json {
+        auto potsJson = json::array();
+
+        for (const auto& pot : _pots) {
+            auto players = json::array();
+            auto winners = json::array();
+
+            for (auto playerNum : pot.eligiblePlayersNum) { players.emplace_back(fmt::format("player_{}", playerNum)); }
+            for (auto playerNum : pot.winnersNum) { winners.emplace_back(fmt::format("player_{}", playerNum)); }
+
+            potsJson.emplace_back(json::object({{"amount", pot.amount}, {"players", players}, {"winners", winners}}));
+        }
+
+        return potsJson;
+    }
+
+    auto SidePots::writeJson(JsonWriter& writer) const -> void {
+        writer.startArray();
+
+        for (const auto& pot : _pots) {
+            writer.startObject();
+            writer.key("amount").value(pot.amount);
+            writer.key("players").startArray();
+
+            for (auto playerNum : pot.eligiblePlayersNum) { writer.value("player_{}", playerNum); }
+
+            writer.endArray();
+            writer.key("winners").startArray();
+
+            for (auto playerNum : pot.winnersNum) { writer.value("player_{}", playerNum); }
+
+            writer.endArray();
+            writer.endObject();
+        }
+
+        writer.endArray();
+    }
+}  // namespace GameHandler
@@ -4,6 +4,8 @@
 #include <game_handler/CardFactory.hpp>
 
 using GameHandler::Board;
+using GameHandler::json;
+using GameHandler::JsonWriter;
 using GameHandler::Factory::card;
 
 using enum GameHandler::HandRank;
@@ -400,6 +402,42 @@ TEST(BoardTest, HandsComparisonShouldBeCorrect) {
     EXPECT_EQ(board.compareHands({card("KS"), card("7S")}, {card("8D"), card("8C")}), -1);
 }
 
+TEST(BoardTest, threePairsShouldBeRankedAsTwoPair) {
+    Board board({card("2S"), card("2H"), card("9C"), card("TD"), card("JC")});
+
+    EXPECT_EQ(board.getHandRank({card("9D"), card("TH")}), TWO_PAIR);
+}
+
+TEST(BoardTest, straightsShouldBeComparedOnTheirHighestCard) {
+    Board board_1({card("2S"), card("3H"), card("4D"), card("5C"), card("KS")});
+    Board board_2({card("AC"), card("9H"), card("8S"), card("TS"), card("7S")});
+    Board board_3({card("9S"), card("TH"), card("QD"), card("QH"), card("JS")});
+
+    EXPECT_EQ(board_1.compareHands({card("AC"), card("9D")}, {card("6H"), card("9S")}), -1);  // Wheel vs 6 high straight
+    EXPECT_EQ(board_2.compareHands({card("7C"), card("6H")}, {card("KC"), card("6D")}), 0);   // Same straight, one paired rank
+    EXPECT_EQ(board_3.compareHands({card("8S"), card("6C")}, {card("9D"), card("KH")}), -1);  // Queen high vs king high straight
+}
+
+TEST(BoardTest, flushesShouldBeComparedOnTheirFiveHighestCards) {
+    Board board({card("3S"), card("5S"), card("TS"), card("QD"), card("6S")});
+
+    EXPECT_EQ(board.compareHands({card("8S"), card("AS")}, {card("9D"), card("QS")}), 1);
+}
+
+TEST(BoardTest, fullsShouldBeComparedOnTheirTripsThenTheirBestPair) {
+    Board board({card("2S"), card("2D"), card("KC"), card("KD"), card("QH")});
+
+    EXPECT_EQ(board.compareHands({card("2H"), card("QC")}, {card("2C"), card("4H")}), 0);  // 222KK for both
+}
+
+TEST(BoardTest, straightFlushesShouldBeFoundInTheFlushSuit) {
+    Board board_1({card("5H"), card("6H"), card("7H"), card("8H"), card("TC")});
+    Board board_2({card("AH"), card("2H"), card("3H"), card("4H"), card("KC")});
+
+    EXPECT_EQ(board_1.compareHands({card("9H"), card("2C")}, {card("4H"), card("9D")}), 1);  // 9 high vs 8 high straight flush
+    EXPECT_EQ(board_2.getHandRank({card("5H"), card("9D")}), STRAIGHT_FLUSH);                // Wheel straight flush
+}
+
 /**
  ╔═════════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
  ║                                              JSON representation check                                              ║
@@ -419,6 +457,12 @@ TEST(BoardTest, jsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_EQ(Board({card("AH"), card("QH"), card("JH"), card("TH"), card("KH")}).toJson(), expectedJson);
+
+    JsonWriter writer;
+
+    Board({card("AH"), card("QH"), card("JH"), card("TH"), card("KH")}).writeJson(writer);
+
+    EXPECT_EQ(json::parse(writer.view()), expectedJson);
 }
 
 TEST(BoardTest, jsonDetailedRepresentationShouldBeCorrect) {
@@ -3,6 +3,8 @@
 #include <game_handler/Card.hpp>
 
 using GameHandler::Card;
+using GameHandler::json;
+using GameHandler::JsonWriter;
 
 using enum Card::Rank;
 using enum Card::Suit;
@@ -145,4 +147,10 @@ TEST(CardTest, JsonRepresentationShouldBeCorrent) {
     )"_json;
 
     EXPECT_EQ(Card(TEN, SPADE).toJson(), expectedJson);
+
+    JsonWriter writer;
+
+    Card(TEN, SPADE).writeJson(writer);
+
+    EXPECT_EQ(json::parse(writer.view()), expectedJson);
 }
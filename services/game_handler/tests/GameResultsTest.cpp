@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <game_handler/Game.hpp>
+#include <utilities/GtestGames.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::ChipsResult;
+using GameHandler::Game;
+using GameHandler::GameResults;
+using GameHandler::invalid_json;
+using GameHandler::JsonReader;
+using GameHandler::JsonWriter;
+using GameHandler::Position;
+using GameHandler::Round;
+using Utilities::Gtest::playFoldThenAllInShowdown;
+
+class GameResultsTest : public ::testing::Test {};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(GameResultsTest, resultsShouldBreakDownTheEndedRounds) {
+    Game game;
+
+    playFoldThenAllInShowdown(game);
+    // The last round is only added once final, when the game ends
+    EXPECT_EQ(game.getResults().getTotal(), ChipsResult({.rounds = 1, .chips = 0}));
+
+    game.end();
+
+    const auto& results = game.getResults();
+
+    EXPECT_EQ(results.getTotal(), ChipsResult({.rounds = 2, .chips = 1500}));
+    EXPECT_EQ(results.getByBlindLevel().at(100), ChipsResult({.rounds = 1, .chips = 0}));
+    EXPECT_EQ(results.getByBlindLevel().at(200), ChipsResult({.rounds = 1, .chips = 1500}));
+    EXPECT_EQ(results.getByPosition().at(Position::DEALER), ChipsResult({.rounds = 1, .chips = 0}));
+    EXPECT_EQ(results.getByPosition().at(Position::BIG_BLIND), ChipsResult({.rounds = 1, .chips = 1500}));
+    EXPECT_EQ(results.getByPosition().at(Position::SMALL_BLIND), ChipsResult());
+    EXPECT_EQ(results.getByStreet().at(Round::PREFLOP), ChipsResult({.rounds = 1, .chips = 0}));
+    EXPECT_EQ(results.getByStreet().at(Round::FLOP), ChipsResult());
+    EXPECT_EQ(results.getByStreet().at(Round::SHOWDOWN), ChipsResult({.rounds = 1, .chips = 1500}));
+    EXPECT_EQ(results.getShowdown(), ChipsResult({.rounds = 1, .chips = 1500}));
+    EXPECT_EQ(results.getNonShowdown(), ChipsResult({.rounds = 1, .chips = 0}));
+}
+
+TEST_F(GameResultsTest, resultsOfSeveralGamesShouldMerge) {
+    Game first;
+    Game second;
+
+    playFoldThenAllInShowdown(first);
+    playFoldThenAllInShowdown(second);
+    first.end();
+    second.end();
+
+    auto results = first.getResults();
+
+    results.merge(second.getResults());
+
+    EXPECT_EQ(results.getTotal(), ChipsResult({.rounds = 4, .chips = 3000}));
+    EXPECT_EQ(results.getByBlindLevel().at(200), ChipsResult({.rounds = 2, .chips = 3000}));
+    EXPECT_EQ(results.getByPosition().at(Position::DEALER), ChipsResult({.rounds = 2, .chips = 0}));
+    EXPECT_EQ(results.getShowdown(), ChipsResult({.rounds = 2, .chips = 3000}));
+}
+
+TEST_F(GameResultsTest, resultsShouldBeRebuiltFromTheirJson) {
+    Game       game;
+    JsonWriter writer;
+
+    playFoldThenAllInShowdown(game);
+    game.end();
+    game.getResults().writeJson(writer);
+
+    JsonReader dumpReader(writer.view());
+    auto       toJsonDump = game.getResults().toJson().dump(4);
+    JsonReader toJsonReader(toJsonDump);
+
+    EXPECT_EQ(GameResults::fromJson(dumpReader), game.getResults());
+    EXPECT_EQ(GameResults::fromJson(toJsonReader), game.getResults());
+    EXPECT_EQ(Game::fromJson(game.dump()).getResults(), game.getResults());
+
+    JsonReader invalidReader(R"({"positions": {"button": {"rounds": 1, "chips": 10}}})");
+
+    EXPECT_THROW_WITH_MESSAGE(
+        static_cast<void>(GameResults::fromJson(invalidReader)), invalid_json, "Unknown game results key `button`");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
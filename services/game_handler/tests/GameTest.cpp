@@ -8,6 +8,7 @@ using GameHandler::Blinds;
 using GameHandler::Board;
 using GameHandler::Game;
 using GameHandler::Hand;
+using GameHandler::json;
 using GameHandler::Player;
 using GameHandler::seconds;
 using GameHandler::Factory::card;
@@ -21,7 +22,7 @@ TEST(GameTest, jsonRepresentationShouldBeCorrect) {
     game.setBuyIn(10);
     game.setMultipliers(3);
     game.setInitialStack(1000);
-    game.init("player 1", "player 2", "player 3");
+    game.init({"player 1", "player 2", "player 3"});
 
     // Run a scenario
 
@@ -57,7 +58,7 @@ TEST(GameTest, jsonRepresentationShouldBeCorrect) {
         round2.raiseTo(1, 1600);
         round2.call(3);
         // Flop
-        round2.getBoard().setFlop({card("AS"), card("KS"), card("KH")});
+        round2.getBoard().setFlop({card("AD"), card("KS"), card("KH")});
         // Turn
         round2.getBoard().setTurn(card("8C"));
         // River
@@ -106,6 +107,9 @@ TEST(GameTest, jsonRepresentationShouldBeCorrect) {
                         "player_3": []
                     },
                     "pot": 1600,
+                    "pots": [
+                        { "amount": 1600, "players": ["player_1"], "winners": ["player_1"] }
+                    ],
                     "blinds": { "small": 50, "big": 100 },
                     "won": true,
                     "positions": {
@@ -133,7 +137,7 @@ TEST(GameTest, jsonRepresentationShouldBeCorrect) {
                         "river": []
                     },
                     "board": [
-                        { "shortName": "AS", "rank": "Ace", "suit": "Spade" },
+                        { "shortName": "AD", "rank": "Ace", "suit": "Diamond" },
                         { "shortName": "KS", "rank": "King", "suit": "Spade" },
                         { "shortName": "KH", "rank": "King", "suit": "Heart" },
                         { "shortName": "8C", "rank": "Eight", "suit": "Club" },
@@ -154,6 +158,11 @@ TEST(GameTest, jsonRepresentationShouldBeCorrect) {
                         ]
                     },
                     "pot": 3000,
+                    "pots": [
+                        { "amount": 1500, "players": ["player_1", "player_2", "player_3"], "winners": ["player_1"] },
+                        { "amount": 800, "players": ["player_1", "player_3"], "winners": ["player_1"] },
+                        { "amount": 700, "players": ["player_1"], "winners": ["player_1"] }
+                    ],
                     "blinds": { "small": 100, "big": 200 },
                     "won": true,
                     "positions": {
@@ -175,10 +184,182 @@ TEST(GameTest, jsonRepresentationShouldBeCorrect) {
             "won": true,
             "balance": 20,
             "duration": 0,            
-            "complete": true            
+            "complete": true,
+            "results": {
+                "blind_levels": [
+                    { "big_blind": 100, "rounds": 1, "chips": 600 },
+                    { "big_blind": 200, "rounds": 1, "chips": 1400 }
+                ],
+                "positions": {
+                    "dealer": { "rounds": 1, "chips": 600 },
+                    "big_blind": { "rounds": 1, "chips": 1400 }
+                },
+                "streets": {
+                    "pre-flop": { "rounds": 0, "chips": 0 },
+                    "flop": { "rounds": 1, "chips": 600 },
+                    "turn": { "rounds": 0, "chips": 0 },
+                    "river": { "rounds": 0, "chips": 0 },
+                    "showdown": { "rounds": 1, "chips": 1400 }
+                },
+                "showdown": { "rounds": 1, "chips": 1400 },
+                "non_showdown": { "rounds": 1, "chips": 600 }
+            }
         }
     )"_json;
 
     EXPECT_JSON_EQ(game.toJson(), expectedJson);
 }
+
+TEST(GameTest, spilledRoundsShouldBeStreamedBackInJson) {
+    auto segmentPath = std::filesystem::temp_directory_path() / "game_handler_spilled_rounds.jsonl";
+    auto playRounds  = [](Game& game) {
+        game.setInitialStack(1000);
+        game.init({"player 1", "player 2", "player 3"});
+
+        for (int32_t dealer = 1; dealer <= 3; ++dealer) {
+            auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, dealer);
+            // Everybody folds to the big blind
+            while (round.isInProgress()) { round.fold(round.getCurrentPlayerNum()); }
+        }
+    };
+
+    std::filesystem::remove(segmentPath);
+
+    Game residentGame;
+    Game spilledGame;
+
+    spilledGame.spillRoundsTo(segmentPath);
+    playRounds(residentGame);
+    playRounds(spilledGame);
+
+    EXPECT_EQ(spilledGame.getResidentRoundsNumber(), 1);
+    EXPECT_EQ(spilledGame.getSpilledRounds().size(), 2);
+
+    residentGame.end();
+    spilledGame.end();
+
+    EXPECT_EQ(spilledGame.getResidentRoundsNumber(), 0);
+    EXPECT_EQ(spilledGame.getRoundsNumber(), 3);
+    EXPECT_EQ(spilledGame.getSpilledRounds().back().pot, 150);
+    EXPECT_JSON_EQ(spilledGame.toJson(), residentGame.toJson());
+
+    std::filesystem::remove(segmentPath);
+}
+
+TEST(GameTest, dumpShouldConcatenateTheCachedRounds) {
+    auto segmentPath = std::filesystem::temp_directory_path() / "game_handler_dumped_rounds.jsonl";
+    auto playRound   = [](Game& game, int32_t dealer) {
+        auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, dealer);
+        // Everybody folds to the big blind
+        while (round.isInProgress()) { round.fold(round.getCurrentPlayerNum()); }
+    };
+
+    std::filesystem::remove(segmentPath);
+
+    Game residentGame;
+    Game spilledGame;
+
+    for (auto* game : {&residentGame, &spilledGame}) {
+        game->setInitialStack(1000);
+        game->init({"player 1", "player 2", "player 3"});
+    }
+
+    spilledGame.spillRoundsTo(segmentPath);
+
+    for (int32_t dealer = 1; dealer <= 3; ++dealer) {
+        playRound(residentGame, dealer);
+        playRound(spilledGame, dealer);
+
+        EXPECT_JSON_EQ(json::parse(residentGame.dump()), residentGame.toJson());
+        EXPECT_JSON_EQ(json::parse(spilledGame.dump()), spilledGame.toJson());
+    }
+
+    residentGame.end();
+    spilledGame.end();
+
+    EXPECT_JSON_EQ(json::parse(spilledGame.dump()), spilledGame.toJson());
+
+    std::filesystem::remove(segmentPath);
+}
+TEST(GameTest, gameShouldBeRebuiltFromItsJson) {
+    Game game;
+
+    game.setBuyIn(10);
+    game.setMultipliers(3);
+    game.setInitialStack(1000);
+    game.init({"player 1", "player \"2\"", "player 3"});
+
+    // Round 1, won on the turn
+    {
+        auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+        round.raiseTo(1, 300);
+        round.call(2);
+        round.fold(3);
+        round.getBoard().setFlop({card("2C"), card("5D"), card("9H")});
+        round.bet(2, 200);
+        round.call(1);
+        round.getBoard().setTurn(card("JD"));
+        round.check(2);
+        round.bet(1, 400);
+        round.fold(2);
+    }
+
+    // Round 2, all in with side pots
+    {
+        auto& round = game.newRound({100, 200}, {card("AH"), card("AS")}, 2);
+
+        round.raiseTo(2, 500);
+        round.call(3);
+        round.allIn(1);
+        round.call(3);
+        round.getBoard().setCards({card("AD"), card("KS"), card("KH"), card("8C"), card("7C")});
+        round.setPlayerHand({card("TS"), card("TH")}, 2);
+        round.setPlayerHand({card("9S"), card("9H")}, 3);
+        round.showdown();
+    }
+
+    game.end();
+
+    auto fromDump   = Game::fromJson(game.dump());
+    auto fromToJson = Game::fromJson(game.toJson().dump(4));
+
+    EXPECT_EQ(fromDump.getRoundsNumber(), 2);
+    EXPECT_EQ(fromDump.getInitialStack(), 1000);
+    EXPECT_EQ(fromDump.getPlayer(2).getName(), "player \"2\"");
+    EXPECT_EQ(fromDump.getPlayer(1).getStack(), 3000);
+
+    for (int32_t playerNum = 1; playerNum <= 3; ++playerNum) {
+        EXPECT_EQ(fromDump.getPlayer(playerNum).getStack(), game.getPlayer(playerNum).getStack());
+        EXPECT_EQ(fromDump.getPlayer(playerNum).isEliminated(), game.getPlayer(playerNum).isEliminated());
+    }
+
+    EXPECT_JSON_EQ(fromDump.toJson(), game.toJson());
+    EXPECT_JSON_EQ(fromToJson.toJson(), game.toJson());
+}
+
+TEST(GameTest, gameWithoutPlayersShouldNotBeWon) {
+    Game game;
+
+    auto gameJson = game.toJson();
+
+    EXPECT_FALSE(gameJson["won"].get<bool>());
+    EXPECT_TRUE(gameJson["players"].empty());
+    EXPECT_TRUE(gameJson["rounds"].empty());
+}
+
+TEST(GameTest, invalidGameJsonShouldThrowException) {
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = Game::fromJson(R"({"players": ["player 1", "player 2"], "buy_in": 1O})"),
+                              GameHandler::invalid_json,
+                              "Invalid JSON at offset 49: `,` expected");
+
+    auto outOfTableHand = R"({"players": ["player 1", "player 2"], "rounds": [{"hands": {"player_12": [
+        { "shortName": "AH", "rank": "Ace", "suit": "Heart" },
+        { "shortName": "KH", "rank": "King", "suit": "Heart" }
+    ]}}]})";
+
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = Game::fromJson(outOfTableHand),
+                              GameHandler::invalid_json,
+                              "The given player number is invalid");
+}
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
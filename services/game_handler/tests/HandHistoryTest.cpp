@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <game_handler/HandHistory.hpp>
+#include <utilities/GtestGames.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Game;
+using GameHandler::HandHistoryReader;
+using GameHandler::HandHistoryWriter;
+using GameHandler::invalid_hand_history;
+using GameHandler::Round;
+using GameHandler::RoundAction;
+using GameHandler::RoundView;
+using GameHandler::seconds;
+
+using enum RoundAction::ActionType;
+
+class HandHistoryTest : public ::testing::Test {
+    public:
+        // Two rounds, one won pre-flop and one all in to showdown
+        static auto playGame(Game& game) -> void {
+            game.setBuyIn(10);
+            game.setMultipliers(3);
+            Utilities::Gtest::playFoldThenAllInShowdown(game, {"player 1", "player 2", "joueur_3"});
+            game.end();
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(HandHistoryTest, gameEndShouldWriteAReadableHandHistory) {
+    auto path = std::filesystem::temp_directory_path() / "game_handler_hand_history.pthh";
+    Game game;
+
+    game.setHandHistoryPath(path);
+    playGame(game);
+
+    HandHistoryReader reader(path);
+
+    EXPECT_EQ(reader.getVersion(), GameHandler::HAND_HISTORY_VERSION);
+    EXPECT_EQ(reader.getPlayersNumber(), 3);
+    EXPECT_EQ(reader.getPlayerName(3), "joueur_3");
+    EXPECT_EQ(reader.getBuyIn(), 10);
+    EXPECT_EQ(reader.getMultipliers(), 3);
+    EXPECT_EQ(reader.getInitialStack(), 1000);
+    EXPECT_EQ(reader.isWon(), game.isWon());
+    EXPECT_TRUE(reader.isComplete());
+    EXPECT_EQ(reader.getRoundsNumber(), 2);
+
+    std::vector<Round> rounds;
+
+    game.forEachRound([&rounds](const Round& round) { rounds.push_back(round); });
+
+    std::size_t roundIndex = 0;
+
+    for (const RoundView& roundView : reader) {
+        const auto& round = rounds.at(roundIndex++);
+
+        EXPECT_EQ(roundView.getDealerNum(), round.getDealerNum());
+        EXPECT_EQ(roundView.hasWon(), round.hasWon());
+        EXPECT_EQ(roundView.getPot(), round.getPot());
+        EXPECT_EQ(roundView.getBlinds().BB(), round.getBlinds().BB());
+
+        for (int32_t i = 0; i < GameHandler::BOARD_CARDS_NUMBER; ++i) {
+            EXPECT_EQ(roundView.getBoardCard(i), round.getBoard().getCards().at(i));
+        }
+
+        for (const auto& recap : round.getPlayersRoundRecap()) {
+            EXPECT_EQ(roundView.getPlayerHand(recap.playerNumber), round.getPlayerHand(recap.playerNumber));
+            EXPECT_EQ(roundView.getStartStack(recap.playerNumber), recap.startStack);
+            EXPECT_EQ(roundView.getEndStack(recap.playerNumber), recap.endStack);
+        }
+
+        for (auto street : {Round::PREFLOP, Round::FLOP, Round::TURN, Round::RIVER}) {
+            std::vector<RoundAction> actions;
+
+            roundView.forEachAction(street, [&actions](const RoundAction& action) { actions.push_back(action); });
+
+            ASSERT_EQ(actions.size(), round.getActions().at(street).size());
+
+            for (std::size_t i = 0; i < actions.size(); ++i) {
+                EXPECT_EQ(actions[i].getAction(), round.getActions().at(street)[i].getAction());
+                EXPECT_EQ(actions[i].getPlayerNum(), round.getActions().at(street)[i].getPlayerNum());
+                EXPECT_EQ(actions[i].getAmount(), round.getActions().at(street)[i].getAmount());
+            }
+        }
+    }
+
+    EXPECT_EQ(roundIndex, 2);
+    // The hero all in is called by the raiser, the small blind folds
+    auto allInRound = *++reader.begin();
+
+    EXPECT_EQ(allInRound.getPot(), 2500);
+    EXPECT_EQ(allInRound.getEndStack(1), 2500);
+    EXPECT_EQ(allInRound.getEndStack(2), 100);
+    EXPECT_EQ(allInRound.getEndStack(3), 400);
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(HandHistoryTest, handHistoryShouldBeMuchSmallerThanJson) {
+    Game game;
+
+    playGame(game);
+
+    EXPECT_LT(HandHistoryWriter::encode(game).size() * 10, game.dump().size());
+}
+
+TEST_F(HandHistoryTest, truncatedRoundRecordShouldThrowException) {
+    // Heads-up round with empty cards, blinds, pot, stacks and ranking, then a pre-flop announcing 127 actions but holding none
+    std::vector<uint8_t> record(2 + 5 + 2 * 2 + 7 + 1, 0);
+
+    record.push_back(0x7F);
+
+    EXPECT_THROW_WITH_MESSAGE(RoundView(record, 2), invalid_hand_history, "Truncated round record");
+}
+
+TEST_F(HandHistoryTest, invalidFileShouldThrowException) {
+    auto path = std::filesystem::temp_directory_path() / "game_handler_invalid_hand_history.pthh";
+
+    std::ofstream(path, std::ios::binary) << "PTHH\x02";
+
+    EXPECT_THROW_WITH_MESSAGE(HandHistoryReader reader(path), invalid_hand_history, "The file is not a hand history");
+
+    std::ofstream(path, std::ios::binary) << std::string("PTHH\x02\x00\x03\x01", 8);
+
+    EXPECT_THROW_WITH_MESSAGE(HandHistoryReader reader(path), invalid_hand_history, "Unsupported hand history version 2");
+
+    std::filesystem::remove(path);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
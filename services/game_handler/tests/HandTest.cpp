@@ -7,6 +7,8 @@
 using GameHandler::Card;
 using GameHandler::Hand;
 using GameHandler::invalid_hand;
+using GameHandler::json;
+using GameHandler::JsonWriter;
 using GameHandler::Factory::card;
 using GameHandler::Factory::invalid_card;
 
@@ -110,6 +112,12 @@ TEST(HandTest, jsonRepresentationShouldBeCorrect) {
 
     EXPECT_EQ(Hand(card("AS"), card("KS")).toJson(), expectedJson);
     EXPECT_EQ(Hand().toJson(), "[]"_json);
+
+    JsonWriter writer;
+
+    Hand(card("AS"), card("KS")).writeJson(writer);
+
+    EXPECT_EQ(json::parse(writer.view()), expectedJson);
 }
 
 TEST(HandTest, jsonDetailedRepresentationShouldBeCorrect) {
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <game_handler/JsonReader.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::invalid_json;
+using GameHandler::JsonReader;
+
+class JsonReaderTest : public ::testing::Test {};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(JsonReaderTest, valuesShouldBeReadInOrder) {
+    JsonReader       reader(R"( { "pot": 150, "won": true, "stacks": [ -20, 3000000000 ], "name": "player_1" } )");
+    std::string_view key;
+
+    reader.startObject();
+
+    ASSERT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(key, "pot");
+    EXPECT_EQ(reader.readInt(), 150);
+    ASSERT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(key, "won");
+    EXPECT_TRUE(reader.readBool());
+    ASSERT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(key, "stacks");
+    reader.startArray();
+    ASSERT_TRUE(reader.nextElement());
+    EXPECT_EQ(reader.readInt(), -20);
+    ASSERT_TRUE(reader.nextElement());
+    EXPECT_EQ(reader.readInt<int64_t>(), 3000000000);
+    EXPECT_FALSE(reader.nextElement());
+    ASSERT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(reader.readString(), "player_1");
+    EXPECT_FALSE(reader.nextKey(key));
+}
+
+TEST(JsonReaderTest, escapedStringsShouldBeDecoded) {
+    JsonReader reader(R"(["quote \" backslash \\ newline \n", "é🂡"])");
+
+    reader.startArray();
+
+    ASSERT_TRUE(reader.nextElement());
+    EXPECT_EQ(reader.readString(), "quote \" backslash \\ newline \n");
+    ASSERT_TRUE(reader.nextElement());
+    EXPECT_EQ(reader.readString(), "\xC3\xA9\xF0\x9F\x82\xA1");
+}
+
+TEST(JsonReaderTest, skippedValuesShouldBeReturnedRaw) {
+    JsonReader       reader(R"({"rounds": [{"board": []}, {"pot": "]}"}], "players": null, "won": false})");
+    std::string_view key;
+
+    reader.startObject();
+
+    ASSERT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(reader.skipValue(), R"([{"board": []}, {"pot": "]}"}])");
+    ASSERT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(reader.skipValue(), "null");
+    ASSERT_TRUE(reader.nextKey(key));
+    EXPECT_FALSE(reader.readBool());
+    EXPECT_FALSE(reader.nextKey(key));
+}
+
+TEST(JsonReaderTest, invalidJsonShouldThrowException) {
+    JsonReader unterminated(R"("player_1)");
+    JsonReader notAnInteger(R"("150")");
+
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = unterminated.readString(), invalid_json, "Invalid JSON at offset 9: unterminated string");
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = notAnInteger.readInt(), invalid_json, "Invalid JSON at offset 0: integer expected");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <game_handler/JsonWriter.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::JsonWriter;
+using nlohmann::json;
+
+class JsonWriterTest : public ::testing::Test {};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(JsonWriterTest, nestedValuesShouldBeSeparatedByCommas) {
+    JsonWriter writer;
+
+    writer.startObject();
+    writer.key("numbers").startArray().value(1).value(-2).value(int64_t {3000000000}).endArray();
+    writer.key("empty").startArray().endArray();
+    writer.key("player_{}", 2).startObject().key("won").value(true).key("name").value("player_{}", 2).endObject();
+    writer.key("raw").raw(R"({"pot":150})");
+    writer.endObject();
+
+    EXPECT_EQ(writer.view(), R"({"numbers":[1,-2,3000000000],"empty":[],"player_2":{"won":true,"name":"player_2"},"raw":{"pot":150}})");
+}
+
+TEST(JsonWriterTest, stringsShouldBeEscaped) {
+    JsonWriter writer;
+
+    writer.startArray().value("quote \" backslash \\ tab \t newline \n control \x01").value(std::string_view("é")).endArray();
+
+    EXPECT_EQ(json::parse(writer.view()), json::array({"quote \" backslash \\ tab \t newline \n control \x01", "é"}));
+}
+
+TEST(JsonWriterTest, flushShouldEmptyTheBuffer) {
+    JsonWriter        writer;
+    std::stringstream stream;
+
+    writer.startArray().value(1).endArray();
+    writer.flush(stream);
+
+    EXPECT_EQ(writer.size(), 0);
+
+    writer.clear();
+    writer.startArray().value(2).endArray();
+    writer.flush(stream);
+
+    EXPECT_EQ(stream.str(), "[1][2]");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <game_handler/NamePool.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::name_id_t;
+using GameHandler::NamePool;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(NamePoolTest, sameNameShouldHaveTheSameId) {
+    auto& pool = NamePool::instance();
+
+    auto firstId  = pool.intern("name pool player");
+    auto secondId = pool.intern(std::string("name pool ") + "player");
+
+    EXPECT_EQ(firstId, secondId);
+    EXPECT_NE(pool.intern("name pool other player"), firstId);
+    EXPECT_EQ(pool.resolve(firstId), "name pool player");
+}
+
+TEST(NamePoolTest, defaultNameShouldHaveTheDefaultId) {
+    EXPECT_EQ(NamePool::instance().intern(GameHandler::DEFAULT_NAME), GameHandler::DEFAULT_NAME_ID);
+    EXPECT_EQ(NamePool::instance().resolve(GameHandler::DEFAULT_NAME_ID), GameHandler::DEFAULT_NAME);
+}
+
+TEST(NamePoolTest, resolvedNameShouldStayValidWhenThePoolGrows) {
+    auto& pool = NamePool::instance();
+    auto  name = pool.resolve(pool.intern("name pool first player"));
+
+    for (int32_t i = 0; i < 10'000; ++i) { std::ignore = pool.intern(fmt::format("name pool player {}", i)); }
+
+    EXPECT_EQ(name, "name pool first player");
+}
+
+TEST(NamePoolTest, concurrentInternsShouldGiveOneIdPerName) {
+    static constexpr int32_t THREADS_NUMBER = 4;
+    static constexpr int32_t NAMES_NUMBER   = 1'000;
+
+    std::array<std::vector<name_id_t>, THREADS_NUMBER> ids;
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (auto& threadIds : ids) {
+            threads.emplace_back([&threadIds]() {
+                for (int32_t i = 0; i < NAMES_NUMBER; ++i) {
+                    threadIds.push_back(NamePool::instance().intern(fmt::format("name pool shared player {}", i)));
+                }
+            });
+        }
+    }
+
+    for (const auto& threadIds : ids) { EXPECT_EQ(threadIds, ids.front()); }
+
+    EXPECT_EQ(NamePool::instance().resolve(ids.front()[42]), "name pool shared player 42");
+}
+
+TEST(NamePoolTest, unknownIdShouldThrowException) {
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = NamePool::instance().resolve(std::numeric_limits<name_id_t>::max()),
+                              std::invalid_argument,
+                              "Unknown player name id");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -1,3 +1,24 @@
-//
-// Created by rom1 on 27/01/23.
-//
+#include <gtest/gtest.h>
+
+#include <game_handler/Player.hpp>
+
+using GameHandler::Player;
+
+TEST(PlayerTest, playersShouldBeComparedByName) {
+    Player player("player test", 1);
+    Player sameName("player test", 2);
+    Player otherName("player test 2", 1);
+
+    EXPECT_EQ(player, sameName);
+    EXPECT_NE(player, otherName);
+    EXPECT_EQ(player.getNameId(), sameName.getNameId());
+    EXPECT_EQ(player.getName(), "player test");
+}
+
+TEST(PlayerTest, copiedPlayerShouldShareTheName) {
+    Player player("player test", 1);
+    Player copy = player;
+
+    EXPECT_TRUE(std::is_trivially_copyable_v<Player>);
+    EXPECT_EQ(copy.getName().data(), player.getName().data());
+}
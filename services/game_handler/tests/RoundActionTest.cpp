@@ -3,7 +3,8 @@
 #include <game_handler/Player.hpp>
 #include <game_handler/RoundAction.hpp>
 
-using GameHandler::Player;
+using GameHandler::json;
+using GameHandler::JsonWriter;
 using GameHandler::RoundAction;
 using GameHandler::seconds;
 
@@ -22,7 +23,13 @@ TEST(RoundActionTest, jsonRepresentationForBetShouldBeCorrect) {
         }
     )"_json;
 
-    EXPECT_EQ(RoundAction(BET, Player("player 1", 1), seconds(11), 1500).toJson(), expectedJson);
+    EXPECT_EQ(RoundAction(BET, 1, seconds(11), 1500).toJson(), expectedJson);
+
+    JsonWriter writer;
+
+    RoundAction(BET, 1, seconds(11), 1500).writeJson(writer);
+
+    EXPECT_EQ(json::parse(writer.view()), expectedJson);
 }
 
 TEST(RoundActionTest, jsonRepresentationForCallShouldBeCorrect) {
@@ -36,7 +43,7 @@ TEST(RoundActionTest, jsonRepresentationForCallShouldBeCorrect) {
         }
     )"_json;
 
-    EXPECT_EQ(RoundAction(CALL, Player("player 3", 3), seconds(8), 230).toJson(), expectedJson);
+    EXPECT_EQ(RoundAction(CALL, 3, seconds(8), 230).toJson(), expectedJson);
 }
 
 TEST(RoundActionTest, jsonRepresentationForCheckShouldBeCorrect) {
@@ -49,7 +56,7 @@ TEST(RoundActionTest, jsonRepresentationForCheckShouldBeCorrect) {
         }
     )"_json;
 
-    EXPECT_EQ(RoundAction(CHECK, Player("player 1", 1), seconds(5)).toJson(), expectedJson);
+    EXPECT_EQ(RoundAction(CHECK, 1, seconds(5)).toJson(), expectedJson);
 }
 
 TEST(RoundActionTest, jsonRepresentationForFoldShouldBeCorrect) {
@@ -62,7 +69,7 @@ TEST(RoundActionTest, jsonRepresentationForFoldShouldBeCorrect) {
         }
     )"_json;
 
-    EXPECT_EQ(RoundAction(FOLD, Player("player 2", 2), seconds(3)).toJson(), expectedJson);
+    EXPECT_EQ(RoundAction(FOLD, 2, seconds(3)).toJson(), expectedJson);
 }
 
 TEST(RoundActionTest, jsonRepresentationForPayBigBlindShouldBeCorrect) {
@@ -76,7 +83,7 @@ TEST(RoundActionTest, jsonRepresentationForPayBigBlindShouldBeCorrect) {
         }
     )"_json;
 
-    EXPECT_EQ(RoundAction(PAY_BIG_BLIND, Player("player 1", 1), seconds(2), 100).toJson(), expectedJson);
+    EXPECT_EQ(RoundAction(PAY_BIG_BLIND, 1, seconds(2), 100).toJson(), expectedJson);
 }
 
 TEST(RoundActionTest, jsonRepresentationForPaySmallBlindShouldBeCorrect) {
@@ -90,7 +97,7 @@ TEST(RoundActionTest, jsonRepresentationForPaySmallBlindShouldBeCorrect) {
         }
     )"_json;
 
-    EXPECT_EQ(RoundAction(PAY_SMALL_BLIND, Player("player 2", 2), seconds(1), 50).toJson(), expectedJson);
+    EXPECT_EQ(RoundAction(PAY_SMALL_BLIND, 2, seconds(1), 50).toJson(), expectedJson);
 }
 
 TEST(RoundActionTest, jsonRepresentationForRaiseShouldBeCorrect) {
@@ -104,5 +111,33 @@ TEST(RoundActionTest, jsonRepresentationForRaiseShouldBeCorrect) {
         }
     )"_json;
 
-    EXPECT_EQ(RoundAction(RAISE, Player("player 1", 1), seconds(4), 1000).toJson(), expectedJson);
+    EXPECT_EQ(RoundAction(RAISE, 1, seconds(4), 1000).toJson(), expectedJson);
+}
+
+TEST(RoundActionTest, detailedJsonRepresentationShouldHaveTheMetrics) {
+    RoundAction action(RAISE, 1, seconds(4), 300);
+
+    action.setMetrics({150, 100, 950, 0.4, 6.5, 2.0, 3.0});
+
+    // language=json
+    auto expectedJson = R"(
+        {
+            "action": "Raise",
+            "player": "player_1",
+            "elapsed_time": 4,
+            "amount": 300,
+            "metrics": {
+                "pot_before": 150,
+                "to_call": 100,
+                "effective_stack": 950,
+                "pot_odds": 0.4,
+                "spr": 6.5,
+                "bet_pot_fraction": 2.0,
+                "bet_big_blinds": 3.0
+            }
+        }
+    )"_json;
+
+    EXPECT_EQ(action.toDetailedJson(), expectedJson);
+    EXPECT_EQ(action.toJson().contains("metrics"), false);
 }
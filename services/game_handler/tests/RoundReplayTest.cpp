@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+#include <game_handler/CardFactory.hpp>
+#include <game_handler/RoundReplay.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Blinds;
+using GameHandler::Card;
+using GameHandler::LoggedAction;
+using GameHandler::Player;
+using GameHandler::Round;
+using GameHandler::RoundLog;
+using GameHandler::RoundReplayer;
+using GameHandler::Factory::card;
+
+using Type = LoggedAction::Type;
+
+/**
+ * @brief Random tables played with random legal actions, each action is logged so a failing round can be replayed.
+ */
+class RoundFuzzer {
+    public:
+        static constexpr int32_t MAX_ACTIONS = 200;  // A round with more actions is stuck
+
+        explicit RoundFuzzer(uint32_t seed)
+          : _random(seed) {
+            for (const auto& [name, prototype] : GameHandler::Factory::CARD_PROTOTYPES) {
+                if (!prototype.isUnknown()) { _deck.push_back(prototype); }
+            }
+            // The prototypes map order is not specified
+            std::ranges::sort(_deck, [](const Card& lhs, const Card& rhs) {
+                return std::pair(lhs.getRank(), lhs.getSuit()) < std::pair(rhs.getRank(), rhs.getSuit());
+            });
+        }
+
+        // A random table, with short stacks and eliminated players, and random cards
+        auto randomLog() -> RoundLog {
+            RoundLog log;
+            auto     playersNumber = _between(GameHandler::MIN_SEATS, GameHandler::MAX_SEATS);
+            auto     bigBlind      = _between(1, 50) * 20;
+
+            log.blinds = Blinds(bigBlind / 2, bigBlind);
+
+            do {
+                log.stacks.clear();
+
+                for (int32_t i = 0; i < playersNumber; ++i) {
+                    auto kind = _between(0, 9);
+
+                    log.stacks.push_back(kind == 0 ? 0 : kind == 1 ? _between(1, bigBlind) : _between(bigBlind, 100 * bigBlind));
+                }
+            } while (std::ranges::count_if(log.stacks, [](int32_t stack) { return stack > 0; }) < 2);
+
+            do { log.dealerNum = _between(1, playersNumber); } while (log.stacks[log.dealerNum - 1] == 0);
+
+            std::ranges::shuffle(_deck, _random);
+
+            for (std::size_t i = 0; i < log.board.size(); ++i) { log.board.at(i) = _deck[i]; }
+
+            for (std::size_t i = 0; i < static_cast<std::size_t>(playersNumber); ++i) {
+                log.hands.at(i) = {_deck[log.board.size() + 2 * i], _deck[log.board.size() + 2 * i + 1]};
+            }
+
+            return log;
+        }
+
+        // Play random legal actions until the round ends, the actions are appended to the log
+        auto play(Round& round, RoundLog& log) -> void {
+            for (int32_t actionsNumber = 0; round.isInProgress(); ++actionsNumber) {
+                if (actionsNumber == MAX_ACTIONS) { throw std::runtime_error("The round is stuck"); }
+
+                auto action = round.waitingShowdown() ? LoggedAction {.type = Type::SHOWDOWN} : _randomAction(round, log.blinds.BB());
+
+                log.actions.push_back(action);
+                RoundReplayer::apply(round, action);
+            }
+        }
+
+    private:
+        std::mt19937      _random;
+        std::vector<Card> _deck;
+
+        auto _between(int32_t min, int32_t max) -> int32_t { return std::uniform_int_distribution<int32_t>(min, max)(_random); }
+
+        auto _randomAction(const Round& round, int32_t bigBlind) -> LoggedAction {
+            const auto& seats     = round.getSeats();
+            auto        playerNum = round.getCurrentPlayerNum();
+            // The round can point to an all in player, who has nothing left to play
+            for (int32_t i = 0; !seats.at(playerNum).inRound || seats.at(playerNum).isAllIn; ++i) {
+                if (i == seats.size()) { throw std::runtime_error("No player can play"); }
+
+                playerNum = seats.nextSeatNum(playerNum);
+            }
+
+            int32_t maxStreetBet = 0;
+
+            for (const auto& seat : seats) {
+                if (seat.inRound) { maxStreetBet = std::max(maxStreetBet, seat.totalStreetBet); }
+            }
+
+            const auto& seat     = seats.at(playerNum);
+            auto        toCall   = maxStreetBet - seat.totalStreetBet;
+            auto        maxTotal = seat.totalStreetBet + seat.stack;
+            // Nobody could answer a raise when all the other players are all in
+            auto canRaise = seat.stack > toCall && !round.isNextActionTheLastStreetOne(playerNum);
+            auto choice   = _between(0, 99);
+            auto action   = LoggedAction {.playerNum = static_cast<uint8_t>(playerNum)};
+
+            if (canRaise && choice >= 90) {
+                action.type = Type::ALL_IN;
+            } else if (toCall == 0 && (!canRaise || choice < 50)) {
+                action.type = Type::CHECK;
+            } else if (toCall > 0 && choice < 25) {
+                action.type = Type::FOLD;
+            } else if (toCall > 0 && (!canRaise || choice < 70)) {
+                action.type = Type::CALL;
+            } else if (maxStreetBet == 0) {
+                action.type   = Type::BET;
+                action.amount = _between(std::min(bigBlind, seat.stack), seat.stack);
+            } else {
+                action.type   = Type::RAISE_TO;
+                action.amount = _between(std::min(maxStreetBet + bigBlind, maxTotal), maxTotal);
+            }
+
+            return action;
+        }
+};
+
+class RoundReplayTest : public ::testing::Test {
+    public:
+        // Chips conservation, pots and ranking consistency of an ended round
+        static auto expectInvariants(const Round& round) -> void {
+            ASSERT_FALSE(round.isInProgress());
+
+            int32_t startChips = 0;
+            int32_t endChips   = 0;
+            int32_t totalBets  = 0;
+
+            for (const auto& recap : round.getPlayersRoundRecap()) {
+                EXPECT_GE(recap.endStack, 0);
+                startChips += recap.startStack;
+                endChips   += recap.endStack;
+            }
+
+            for (const auto& seat : round.getSeats()) { totalBets += seat.totalBet; }
+
+            EXPECT_EQ(startChips, endChips);
+            EXPECT_EQ(round.getPots().getTotal(), totalBets);
+            EXPECT_EQ(round.getPot(), totalBets);
+
+            // Each player who started the round is ranked once, the best ranked players are the ones still in the round
+            std::array<int32_t, GameHandler::MAX_SEATS + 1> rankStep {};
+
+            for (std::size_t step = 0; step < round.getRanking().size(); ++step) {
+                for (auto playerNum : round.getRanking()[step]) {
+                    EXPECT_EQ(rankStep.at(playerNum), 0) << "player " << playerNum << " is ranked twice";
+                    rankStep.at(playerNum) = static_cast<int32_t>(step) + 1;
+                }
+            }
+
+            for (const auto& recap : round.getPlayersRoundRecap()) {
+                EXPECT_EQ(rankStep.at(recap.playerNumber) > 0, recap.startStack > 0) << "player " << recap.playerNumber;
+            }
+
+            for (auto playerNum : round.getRanking().back()) { EXPECT_TRUE(round.getSeats().at(playerNum).inRound); }
+
+            // A pot goes to its best ranked eligible players
+            for (const auto& pot : round.getPots()) {
+                ASSERT_FALSE(pot.winnersNum.empty());
+
+                int32_t bestStep = 0;
+
+                for (auto playerNum : pot.eligiblePlayersNum) { bestStep = std::max(bestStep, rankStep.at(playerNum)); }
+
+                for (auto playerNum : pot.winnersNum) {
+                    EXPECT_NE(std::ranges::find(pot.eligiblePlayersNum, playerNum), pot.eligiblePlayersNum.end());
+                    EXPECT_EQ(rankStep.at(playerNum), bestStep);
+                }
+            }
+        }
+
+        static auto fuzzedRoundsNumber() -> int32_t {
+            const auto* roundsNumber = std::getenv("ROUND_FUZZ_ROUNDS");
+
+            return roundsNumber == nullptr ? 20'000 : std::atoi(roundsNumber);
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(RoundReplayTest, replayedRoundShouldBePlayedAsLogged) {
+    RoundLog      log;
+    RoundReplayer replayer;
+
+    log.blinds    = Blinds(50, 100);
+    log.dealerNum = 1;
+    log.stacks    = {1000, 1000, 500};
+    log.hands[0]  = {card("AH"), card("AS")};
+    log.hands[1]  = {card("TS"), card("TH")};
+    log.hands[2]  = {card("9S"), card("9H")};
+    log.board     = {card("AC"), card("KS"), card("KH"), card("8C"), card("7C")};
+    log.actions   = {{.type = Type::RAISE_TO, .playerNum = 1, .amount = 300},
+                     {.type = Type::CALL, .playerNum = 2},
+                     {.type = Type::ALL_IN, .playerNum = 3},
+                     {.type = Type::CALL, .playerNum = 1},
+                     {.type = Type::FOLD, .playerNum = 2},
+                     {.type = Type::SHOWDOWN}};
+
+    const auto& round = replayer.replay(log);
+
+    expectInvariants(round);
+    EXPECT_EQ(round.getPot(), 1300);
+    EXPECT_EQ(round.getSeats().at(1).stack, 1800);
+    EXPECT_EQ(round.getSeats().at(2).stack, 700);
+    EXPECT_EQ(round.getSeats().at(3).stack, 0);
+    EXPECT_TRUE(round.hasWon());
+}
+
+TEST_F(RoundReplayTest, randomLegalRoundsShouldKeepTheInvariants) {
+    RoundFuzzer           fuzzer(20240601);
+    RoundReplayer         fuzzReplayer;
+    RoundReplayer         replayer;
+    std::vector<RoundLog> logs(fuzzedRoundsNumber());
+    std::vector<int32_t>  heroStacks(logs.size());
+    std::vector<int32_t>  replayedHeroStacks(logs.size());
+
+    auto fuzzStart = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < logs.size(); ++i) {
+        logs[i]     = fuzzer.randomLog();
+        auto& round = fuzzReplayer.replay(logs[i]);
+
+        ASSERT_NO_THROW(fuzzer.play(round, logs[i])) << "Round " << i;
+        ASSERT_NO_FATAL_FAILURE(expectInvariants(round)) << "Round " << i;
+
+        heroStacks[i] = round.getSeats().at(1).stack;
+    }
+
+    auto replayStart = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < logs.size(); ++i) { replayedHeroStacks[i] = replayer.replay(logs[i]).getSeats().at(1).stack; }
+
+    auto replayEnd = std::chrono::steady_clock::now();
+
+    // The replayed rounds must end as the fuzzed ones
+    EXPECT_EQ(replayedHeroStacks, heroStacks);
+
+    auto roundsPerSecond = [&logs](auto duration) {
+        return static_cast<int64_t>(static_cast<double>(logs.size()) / std::chrono::duration<double>(duration).count());
+    };
+
+    RecordProperty("fuzzed_rounds_per_second", std::to_string(roundsPerSecond(replayStart - fuzzStart)));
+    RecordProperty("replayed_rounds_per_second", std::to_string(roundsPerSecond(replayEnd - replayStart)));
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -2,17 +2,30 @@
 
 #include <game_handler/CardFactory.hpp>
 #include <game_handler/Round.hpp>
+#include <utilities/AllocationCounter.hpp>
 #include <utilities/GtestMacros.hpp>
 
 using GameHandler::Blinds;
 using GameHandler::Board;
 using GameHandler::Hand;
+using GameHandler::json;
+using GameHandler::JsonWriter;
 using GameHandler::Player;
 using GameHandler::Round;
 using GameHandler::seconds;
 using GameHandler::Factory::card;
 
-class RoundTest : public ::testing::Test {};
+class RoundTest : public ::testing::Test {
+    public:
+        // JSON streamed by the writer, it must be the same as toJson()
+        static auto writtenJson(const Round& round) -> json {
+            JsonWriter writer;
+
+            round.writeJson(writer);
+
+            return json::parse(writer.view());
+        }
+};
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
 // @todo Run the test in background to not slow down the CI
@@ -103,6 +116,7 @@ TEST(RoundTest, DISABLED_jsonRepresentationWithTimingsShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case1JsonRepresentationShouldBeCorrect) {
@@ -165,6 +179,9 @@ TEST(RoundTest, case1JsonRepresentationShouldBeCorrect) {
                 "player_3": []
             },
             "pot": 1300,            
+            "pots": [
+                { "amount": 1300, "players": ["player_1"], "winners": ["player_1"] }
+            ],
             "blinds": { "small": 50, "big": 100 },
             "won": true,
             "positions": {
@@ -182,6 +199,7 @@ TEST(RoundTest, case1JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case2JsonRepresentationShouldBeCorrect) {
@@ -268,6 +286,9 @@ TEST(RoundTest, case2JsonRepresentationShouldBeCorrect) {
                 "player_3": []
             },
             "pot": 1700,            
+            "pots": [
+                { "amount": 1700, "players": ["player_1", "player_2"], "winners": ["player_2", "player_1"] }
+            ],
             "blinds": { "small": 50, "big": 100 },
             "won": true,
             "positions": {
@@ -285,6 +306,7 @@ TEST(RoundTest, case2JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case3JsonRepresentationShouldBeCorrect) {
@@ -368,6 +390,10 @@ TEST(RoundTest, case3JsonRepresentationShouldBeCorrect) {
                 ]
             },
             "pot": 2700,            
+            "pots": [
+                { "amount": 1500, "players": ["player_1", "player_3"], "winners": ["player_1"] },
+                { "amount": 1200, "players": ["player_3"], "winners": ["player_3"] }
+            ],
             "blinds": { "small": 50, "big": 100 },
             "won": true,
             "positions": {
@@ -385,6 +411,7 @@ TEST(RoundTest, case3JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case4JsonRepresentationShouldBeCorrect) {
@@ -430,6 +457,9 @@ TEST(RoundTest, case4JsonRepresentationShouldBeCorrect) {
                 "player_3": []
             },
             "pot": 320,            
+            "pots": [
+                { "amount": 320, "players": ["player_3"], "winners": ["player_3"] }
+            ],
             "blinds": { "small": 10, "big": 20 },
             "won": false,
             "positions": {
@@ -447,6 +477,7 @@ TEST(RoundTest, case4JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case5JsonRepresentationShouldBeCorrect) {
@@ -496,6 +527,9 @@ TEST(RoundTest, case5JsonRepresentationShouldBeCorrect) {
                 "player_3": []
             },
             "pot": 340,            
+            "pots": [
+                { "amount": 340, "players": ["player_2"], "winners": ["player_2"] }
+            ],
             "blinds": { "small": 10, "big": 20 },
             "won": false,
             "positions": {
@@ -513,6 +547,7 @@ TEST(RoundTest, case5JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case6JsonRepresentationShouldBeCorrect) {
@@ -599,6 +634,9 @@ TEST(RoundTest, case6JsonRepresentationShouldBeCorrect) {
                 ]
             },
             "pot": 150,            
+            "pots": [
+                { "amount": 150, "players": ["player_1", "player_3"], "winners": ["player_1"] }
+            ],
             "blinds": { "small": 10, "big": 20 },
             "won": true,
             "positions": {
@@ -616,6 +654,7 @@ TEST(RoundTest, case6JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case7JsonRepresentationShouldBeCorrect) {
@@ -689,6 +728,10 @@ TEST(RoundTest, case7JsonRepresentationShouldBeCorrect) {
                 ]
             },
             "pot": 580,
+            "pots": [
+                { "amount": 480, "players": ["player_2", "player_3"], "winners": ["player_3"] },
+                { "amount": 100, "players": ["player_2"], "winners": ["player_2"] }
+            ],
             "blinds": { "small": 10, "big": 20 },
             "won": false,
             "positions": {
@@ -706,6 +749,7 @@ TEST(RoundTest, case7JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case8JsonRepresentationShouldBeCorrect) {
@@ -779,6 +823,9 @@ TEST(RoundTest, case8JsonRepresentationShouldBeCorrect) {
                 ]
             },
             "pot": 400,
+            "pots": [
+                { "amount": 400, "players": ["player_2", "player_3"], "winners": ["player_2", "player_3"] }
+            ],
             "blinds": { "small": 15, "big": 30 },
             "won": false,
             "positions": {
@@ -796,6 +843,7 @@ TEST(RoundTest, case8JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case9JsonRepresentationShouldBeCorrect) {
@@ -869,6 +917,10 @@ TEST(RoundTest, case9JsonRepresentationShouldBeCorrect) {
                 ]
             },
             "pot": 580,
+            "pots": [
+                { "amount": 480, "players": ["player_2", "player_3"], "winners": ["player_3"] },
+                { "amount": 100, "players": ["player_2"], "winners": ["player_2"] }
+            ],
             "blinds": { "small": 10, "big": 20 },
             "won": false,
             "positions": {
@@ -886,6 +938,7 @@ TEST(RoundTest, case9JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, case10JsonRepresentationShouldBeCorrect) {
@@ -971,6 +1024,10 @@ TEST(RoundTest, case10JsonRepresentationShouldBeCorrect) {
                 ]
             },
             "pot": 900,
+            "pots": [
+                { "amount": 510, "players": ["player_1", "player_3"], "winners": ["player_3"] },
+                { "amount": 390, "players": ["player_3"], "winners": ["player_3"] }
+            ],
             "blinds": { "small": 15, "big": 30 },
             "won": false,
             "positions": {
@@ -988,6 +1045,7 @@ TEST(RoundTest, case10JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, GeneratedByAI_case1JsonRepresentationShouldBeCorrect) {
@@ -1088,6 +1146,9 @@ TEST(RoundTest, GeneratedByAI_case1JsonRepresentationShouldBeCorrect) {
                 ]
             },
             "pot": 1450,
+            "pots": [
+                { "amount": 1450, "players": ["player_1", "player_3"], "winners": ["player_1"] }
+            ],
             "blinds": { "small": 50, "big": 100 },
             "won": true,
             "positions": {
@@ -1105,6 +1166,7 @@ TEST(RoundTest, GeneratedByAI_case1JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, GeneratedByAI_case6JsonRepresentationShouldBeCorrect) {
@@ -1176,6 +1238,9 @@ TEST(RoundTest, GeneratedByAI_case6JsonRepresentationShouldBeCorrect) {
                 "player_3": []
             },
             "pot": 1050,
+            "pots": [
+                { "amount": 1050, "players": ["player_2"], "winners": ["player_2"] }
+            ],
             "blinds": { "small": 50, "big": 100 },
             "won": false,
             "positions": {
@@ -1193,6 +1258,7 @@ TEST(RoundTest, GeneratedByAI_case6JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 TEST(RoundTest, GeneratedByAI_case11JsonRepresentationShouldBeCorrect) {
@@ -1262,6 +1328,9 @@ TEST(RoundTest, GeneratedByAI_case11JsonRepresentationShouldBeCorrect) {
                 "player_3": []
             },
             "pot": 850,
+            "pots": [
+                { "amount": 850, "players": ["player_2"], "winners": ["player_2"] }
+            ],
             "blinds": { "small": 50, "big": 100 },
             "won": false,
             "positions": {
@@ -1279,8 +1348,340 @@ TEST(RoundTest, GeneratedByAI_case11JsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_JSON_EQ(round.toJson(), expectedJson);
+    EXPECT_JSON_EQ(RoundTest::writtenJson(round), expectedJson);
 }
 
 //  @todo add all-in scenario and showdown case
 
+TEST(RoundTest, actionsShouldNotAllocate) {
+    Player player1("player with a name longer than the small string optimization", 1);
+    Player player2("player 2", 2);
+    Player player3("player 3", 3);
+
+    player1.setStack(1000);
+    player2.setStack(1000);
+    player3.setStack(1000);
+
+    std::array<Player, 3> players = {player1, player2, player3};
+
+    Round round({50, 100}, players, {card("AH"), card("KH")}, 1);
+
+    // Pre-flop
+    EXPECT_NO_ALLOCATION(round.raiseTo(1, 200));
+    EXPECT_NO_ALLOCATION(round.call(2));
+    EXPECT_NO_ALLOCATION(round.call(3));
+    // Flop
+    round.getBoard().setFlop({card("AS"), card("AC"), card("3C")});
+    EXPECT_NO_ALLOCATION(round.check(2));
+    EXPECT_NO_ALLOCATION(round.bet(3, 200));
+    EXPECT_NO_ALLOCATION(round.allIn(1));
+    EXPECT_NO_ALLOCATION(round.fold(2));
+    EXPECT_NO_ALLOCATION(std::ignore = round.getInRoundPlayersNum());
+    // Ends the round
+    EXPECT_NO_ALLOCATION(round.fold(3));
+
+    EXPECT_FALSE(round.isInProgress());
+    EXPECT_EQ(round.getCurrentPlayerStack(1), 1600);
+}
+
+TEST(RoundTest, rollbackShouldRestoreTheRoundStateAndReplayTheNextActions) {
+    Player player1("player 1", 1);
+    Player player2("player 2", 2);
+    Player player3("player 3", 3);
+
+    player1.setStack(1000);
+    player2.setStack(1000);
+    player3.setStack(1000);
+
+    std::array<Player, 3> expectedPlayers = {player1, player2, player3};
+    std::array<Player, 3> players         = {player1, player2, player3};
+
+    Round expectedRound({50, 100}, expectedPlayers, {card("AH"), card("KH")}, 1);
+    Round round({50, 100}, players, {card("AH"), card("KH")}, 1);
+
+    // Pre-flop
+    expectedRound.check(1);
+    expectedRound.raiseTo(2, 200);
+    expectedRound.fold(3);
+    expectedRound.call(1);
+    // Flop
+    expectedRound.getBoard().setFlop({card("AS"), card("AC"), card("3C")});
+    expectedRound.check(1);
+    expectedRound.raiseTo(2, 200);
+    expectedRound.raiseTo(1, 600);
+    expectedRound.fold(2);
+
+    // Pre-flop with a misread raise
+    round.check(1);
+    auto version = round.snapshot();
+    round.raiseTo(2, 300);
+    round.fold(3);
+    // Correct the raise and replay the next action
+    auto undoneActions = round.rollbackTo(version);
+
+    ASSERT_EQ(undoneActions.size(), 2);
+    EXPECT_EQ(round.getPot(), 150);
+    EXPECT_EQ(round.getCurrentPlayerNum(), 2);
+
+    round.raiseTo(2, 200);
+    round.replay(undoneActions[1]);
+    round.call(1);
+    // Flop
+    round.getBoard().setFlop({card("AS"), card("AC"), card("3C")});
+    round.check(1);
+    round.raiseTo(2, 200);
+    round.raiseTo(1, 600);
+    round.fold(2);
+
+    EXPECT_JSON_EQ(round.toJson(), expectedRound.toJson());
+    EXPECT_EQ(players[0].getStack(), expectedPlayers[0].getStack());
+    EXPECT_EQ(players[1].getStack(), expectedPlayers[1].getStack());
+    EXPECT_EQ(players[2].getStack(), expectedPlayers[2].getStack());
+}
+
+TEST(RoundTest, rollbackAfterTheRoundEndShouldRestoreThePlayersStacks) {
+    Player player1("player 1", 1);
+    Player player2("player 2", 2);
+    Player player3("player 3", 3);
+
+    player1.setStack(1000);
+    player2.setStack(1000);
+    player3.setStack(1000);
+
+    std::array<Player, 3> players = {player1, player2, player3};
+
+    Round round({50, 100}, players, {card("AH"), card("KH")}, 1);
+
+    // Pre-flop
+    round.raiseTo(1, 1000);
+    round.call(2);
+
+    auto version = round.snapshot();
+
+    round.fold(3);
+    round.getBoard().setFlop({card("AS"), card("AC"), card("3C")});
+    round.getBoard().setTurn(card("8D"));
+    round.getBoard().setRiver(card("9S"));
+    round.setPlayerHand({card("2C"), card("7D")}, 2);
+    round.showdown();
+
+    EXPECT_FALSE(round.isInProgress());
+    EXPECT_TRUE(players[1].isEliminated());
+
+    round.rollbackTo(version);
+
+    EXPECT_TRUE(round.isInProgress());
+    EXPECT_EQ(round.getPot(), 2100);
+    EXPECT_EQ(players[0].getStack(), 0);
+    EXPECT_EQ(players[1].getStack(), 0);
+    EXPECT_EQ(players[2].getStack(), 900);
+    EXPECT_FALSE(players[0].isEliminated());
+    EXPECT_FALSE(players[1].isEliminated());
+}
+
+TEST(RoundTest, rollbackToAnInvalidVersionShouldThrowException) {
+    Player player1("player 1", 1);
+    Player player2("player 2", 2);
+    Player player3("player 3", 3);
+
+    player1.setStack(1000);
+    player2.setStack(1000);
+    player3.setStack(1000);
+
+    std::array<Player, 3> players = {player1, player2, player3};
+
+    Round round({50, 100}, players, {card("AH"), card("KH")}, 1);
+
+    EXPECT_THROW_WITH_MESSAGE(round.rollbackTo(0), std::invalid_argument, "The given round version is invalid");
+
+    auto version = round.snapshot();
+
+    EXPECT_THROW_WITH_MESSAGE(round.rollbackTo(version + 1), std::invalid_argument, "The given round version is invalid");
+
+    round.discardSnapshots();
+
+    EXPECT_THROW_WITH_MESSAGE(round.rollbackTo(version), std::invalid_argument, "The given round version is invalid");
+}
+
+TEST(RoundTest, copiedRoundShouldHaveTheSameState) {
+    Player player1("player 1", 1);
+    Player player2("player 2", 2);
+    Player player3("player 3", 3);
+
+    player1.setStack(1000);
+    player2.setStack(1000);
+    player3.setStack(1000);
+
+    std::array<Player, 3> players = {player1, player2, player3};
+
+    Round round({50, 100}, players, {card("AH"), card("KH")}, 1);
+
+    // Pre-flop
+    round.check(1);
+    round.raiseTo(2, 200);
+    round.fold(3);
+
+    Round copiedRound(round);
+
+    EXPECT_EQ(copiedRound.getPot(), round.getPot());
+    EXPECT_EQ(copiedRound.getCurrentPlayerNum(), round.getCurrentPlayerNum());
+
+    copiedRound.call(1);
+    copiedRound.getBoard().setFlop({card("AS"), card("AC"), card("3C")});
+    copiedRound.check(1);
+    copiedRound.fold(2);
+
+    EXPECT_EQ(copiedRound.getPot(), 500);
+    EXPECT_TRUE(round.isInProgress());
+    EXPECT_FALSE(copiedRound.isInProgress());
+}
+
+TEST(RoundTest, sixMaxRoundShouldFollowTheSeatsOrder) {
+    std::vector<Player> players;
+
+    for (int32_t playerNum = 1; playerNum <= 6; ++playerNum) {
+        players.emplace_back(fmt::format("player {}", playerNum), playerNum).setStack(1000);
+    }
+
+    Round round(Blinds {50, 100}, players, {card("AH"), card("KH")}, 1);
+
+    // Pre-flop, the under the gun player (4) is the first to act
+    round.fold(4);
+    round.call(5);
+    round.fold(6);
+    round.fold(1);
+    round.call(2);
+    EXPECT_EQ(round.getCurrentStreet(), Round::Street::PREFLOP);
+    round.check(3);
+    // Flop
+    EXPECT_EQ(round.getCurrentStreet(), Round::Street::FLOP);
+    EXPECT_EQ(round.getCurrentPlayerNum(), 2);
+    round.check(2);
+    round.bet(3, 200);
+    round.call(5);
+    round.fold(2);
+    // Turn
+    EXPECT_EQ(round.getCurrentStreet(), Round::Street::TURN);
+    EXPECT_EQ(round.getCurrentPlayerNum(), 3);
+    round.check(3);
+    round.bet(5, 500);
+    round.fold(3);
+
+    EXPECT_FALSE(round.isInProgress());
+    EXPECT_EQ(round.getPot(), 1200);
+    EXPECT_EQ(players[4].getStack(), 1400);
+    EXPECT_EQ(players[2].getStack(), 700);
+    EXPECT_EQ(players[1].getStack(), 900);
+}
+
+TEST(RoundTest, multipleAllInLevelsShouldBePaidWithSidePots) {
+    std::vector<Player> players;
+
+    for (auto [playerNum, stack] : {std::pair {1, 100}, {2, 300}, {3, 500}, {4, 1000}}) {
+        players.emplace_back(fmt::format("player {}", playerNum), playerNum).setStack(stack);
+    }
+
+    Round round(Blinds {10, 20}, players, {card("AH"), card("AD")}, 1);
+
+    round.allIn(4);
+    round.allIn(1);
+    round.allIn(2);
+    round.allIn(3);
+
+    EXPECT_TRUE(round.waitingShowdown());
+
+    round.getBoard().setFlop({card("2C"), card("7D"), card("9H")});
+    round.getBoard().setTurn(card("JS"));
+    round.getBoard().setRiver(card("3C"));
+    round.setPlayerHand({card("KH"), card("KD")}, 2);
+    round.setPlayerHand({card("QH"), card("QD")}, 3);
+    round.setPlayerHand({card("4D"), card("5H")}, 4);
+    round.showdown();
+
+    ASSERT_EQ(round.getPots().size(), 4);
+    EXPECT_EQ(round.getPots().getTotal(), round.getPot());
+    EXPECT_EQ(players[0].getStack(), 400);
+    EXPECT_EQ(players[1].getStack(), 600);
+    EXPECT_EQ(players[2].getStack(), 400);
+    EXPECT_EQ(players[3].getStack(), 500);
+}
+
+TEST(RoundTest, blindsPuttingEveryPlayerAllInShouldWaitTheShowdown) {
+    std::vector<Player> players;
+
+    players.emplace_back("player 1", 1).setStack(10);
+    players.emplace_back("player 2", 2).setStack(15);
+
+    Round round(Blinds {10, 20}, players, {card("AH"), card("AD")}, 1);
+
+    EXPECT_TRUE(round.waitingShowdown());
+    EXPECT_EQ(round.getPot(), 25);
+}
+
+TEST(RoundTest, allInAfterAnEarlierStreetBetShouldOnlyBetTheRemainingStack) {
+    std::vector<Player> players;
+
+    players.emplace_back("player 1", 1).setStack(1000);
+    players.emplace_back("player 2", 2).setStack(1000);
+
+    Round round(Blinds {10, 20}, players, {card("AH"), card("AD")}, 1);
+
+    // Pre-flop
+    round.call(round.getCurrentPlayerNum());
+    round.check(round.getCurrentPlayerNum());
+    // Flop
+    round.getBoard().setFlop({card("2C"), card("7D"), card("9H")});
+    round.bet(round.getCurrentPlayerNum(), 100);
+    round.call(round.getCurrentPlayerNum());
+    // Turn
+    round.getBoard().setTurn(card("JS"));
+
+    auto allInPlayerNum = round.getCurrentPlayerNum();
+
+    round.allIn(allInPlayerNum);
+
+    EXPECT_EQ(players[allInPlayerNum - 1].getStack(), 0);
+    EXPECT_EQ(round.getPot(), 1120);
+
+    round.call(round.getCurrentPlayerNum());
+
+    EXPECT_TRUE(round.waitingShowdown());
+    EXPECT_EQ(round.getPot(), 2000);
+}
+
+TEST(RoundTest, actionsShouldCarryTheirMetrics) {
+    std::vector<Player> players;
+
+    for (int32_t playerNum = 1; playerNum <= 3; ++playerNum) {
+        players.emplace_back(fmt::format("player {}", playerNum), playerNum).setStack(1000);
+    }
+
+    Round round(Blinds {50, 100}, players, {card("AH"), card("AD")}, 1);
+
+    round.raiseTo(1, 300);
+    round.call(2);
+    round.fold(3);
+
+    const auto& raise = round.getActions()[Round::PREFLOP][0].getMetrics();
+    const auto& call  = round.getActions()[Round::PREFLOP][1].getMetrics();
+    const auto& fold  = round.getActions()[Round::PREFLOP][2].getMetrics();
+
+    EXPECT_EQ(raise.potBefore, 150);
+    EXPECT_EQ(raise.toCall, 100);
+    EXPECT_EQ(raise.effectiveStack, 950);
+    EXPECT_DOUBLE_EQ(raise.potOdds, 0.4);
+    EXPECT_DOUBLE_EQ(raise.spr, 950.0 / 150);
+    EXPECT_DOUBLE_EQ(raise.betPotFraction, 2.0);
+    EXPECT_DOUBLE_EQ(raise.betBigBlinds, 3.0);
+    EXPECT_EQ(call.potBefore, 450);
+    EXPECT_EQ(call.toCall, 250);
+    EXPECT_EQ(call.effectiveStack, 900);
+    EXPECT_DOUBLE_EQ(call.potOdds, 250.0 / 700);
+    EXPECT_DOUBLE_EQ(call.betBigBlinds, 2.5);
+    EXPECT_EQ(fold.potBefore, 700);
+    EXPECT_EQ(fold.toCall, 200);
+    EXPECT_DOUBLE_EQ(fold.betPotFraction, 0.0);
+    EXPECT_EQ(round.getLastAction().getMetrics(), fold);
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
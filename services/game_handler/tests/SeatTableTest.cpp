@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <game_handler/SeatTable.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Player;
+using GameHandler::SeatTable;
+
+using enum GameHandler::Position;
+
+class SeatTableTest : public ::testing::Test {
+    public:
+        static auto makePlayers(int32_t playersNumber) -> std::vector<Player> {
+            std::vector<Player> players;
+
+            for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+                players.emplace_back(fmt::format("player_{}", playerNum), playerNum).setStack(1000);
+            }
+
+            return players;
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(SeatTableTest, sixMaxPositionsShouldBeGivenFromTheDealer) {
+    auto      players = makePlayers(6);
+    SeatTable seats(players, 5);
+
+    EXPECT_EQ(seats.size(), 6);
+    EXPECT_EQ(seats.at(5).position, DEALER);
+    EXPECT_EQ(seats.at(6).position, SMALL_BLIND);
+    EXPECT_EQ(seats.at(1).position, BIG_BLIND);
+    EXPECT_EQ(seats.at(2).position, LOJACK);
+    EXPECT_EQ(seats.at(3).position, HIJACK);
+    EXPECT_EQ(seats.at(4).position, CUTOFF);
+}
+
+TEST_F(SeatTableTest, nineSeatsPositionsShouldBeGivenFromTheDealer) {
+    auto      players = makePlayers(9);
+    SeatTable seats(players, 1);
+
+    EXPECT_EQ(seats.at(1).position, DEALER);
+    EXPECT_EQ(seats.at(2).position, SMALL_BLIND);
+    EXPECT_EQ(seats.at(3).position, BIG_BLIND);
+    EXPECT_EQ(seats.at(4).position, UNDER_THE_GUN);
+    EXPECT_EQ(seats.at(5).position, UNDER_THE_GUN_1);
+    EXPECT_EQ(seats.at(6).position, MIDDLE);
+    EXPECT_EQ(seats.at(7).position, LOJACK);
+    EXPECT_EQ(seats.at(8).position, HIJACK);
+    EXPECT_EQ(seats.at(9).position, CUTOFF);
+}
+
+TEST_F(SeatTableTest, eliminatedPlayersShouldBeSkippedForPositions) {
+    auto players = makePlayers(3);
+
+    players[1].bust();
+
+    SeatTable seats(players, 3);
+
+    EXPECT_TRUE(seats.at(2).eliminated);
+    EXPECT_FALSE(seats.at(2).inRound);
+    EXPECT_EQ(seats.at(3).position, DEALER);
+    EXPECT_EQ(seats.at(1).position, BIG_BLIND);
+}
+
+TEST_F(SeatTableTest, seatsShouldCopyThePlayersData) {
+    auto      players = makePlayers(4);
+    SeatTable seats(players, 1);
+
+    for (const auto& seat : seats) {
+        EXPECT_EQ(seat.stack, 1000);
+        EXPECT_EQ(seat.initialStack, 1000);
+        EXPECT_TRUE(seat.inRound);
+    }
+
+    EXPECT_EQ(seats.nextSeatNum(4), 1);
+}
+
+TEST_F(SeatTableTest, invalidPlayersNumberShouldThrowException) {
+    auto onePlayer  = makePlayers(1);
+    auto tenPlayers = makePlayers(10);
+
+    EXPECT_THROW_WITH_MESSAGE(SeatTable(onePlayer, 1), std::invalid_argument, "The players number must be between 2 and 9");
+    EXPECT_THROW_WITH_MESSAGE(SeatTable(tenPlayers, 1), std::invalid_argument, "The players number must be between 2 and 9");
+}
+
+TEST_F(SeatTableTest, invalidSeatNumberShouldThrowException) {
+    auto      players = makePlayers(6);
+    SeatTable seats(players, 1);
+
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = seats.at(7), std::invalid_argument, "The given player number is invalid");
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = seats.hand(0), std::invalid_argument, "The given player number is invalid");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
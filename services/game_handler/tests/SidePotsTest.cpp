@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <game_handler/SidePots.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Player;
+using GameHandler::ranking_t;
+using GameHandler::SeatTable;
+using GameHandler::SidePots;
+
+class SidePotsTest : public ::testing::Test {
+    public:
+        // Seats with a 1000 stack, folded players have a negative contribution
+        static auto makeSeats(std::vector<Player>& players, const std::vector<int32_t>& contributions) -> SeatTable {
+            for (int32_t playerNum = 1; playerNum <= static_cast<int32_t>(contributions.size()); ++playerNum) {
+                players.emplace_back(fmt::format("player_{}", playerNum), playerNum).setStack(1000);
+            }
+
+            SeatTable seats(players, 1);
+
+            for (int32_t playerNum = 1; playerNum <= static_cast<int32_t>(contributions.size()); ++playerNum) {
+                seats.at(playerNum).totalBet = std::abs(contributions[playerNum - 1]);
+                seats.at(playerNum).inRound  = contributions[playerNum - 1] > 0;
+            }
+
+            return seats;
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(SidePotsTest, eachAllInLevelShouldCreateAPot) {
+    std::vector<Player> players;
+
+    auto     seats = makeSeats(players, {100, 300, 300, -50});
+    SidePots pots(seats);
+
+    ASSERT_EQ(pots.size(), 2);
+    EXPECT_EQ(pots[0].amount, 350);
+    EXPECT_EQ(pots[0].eligiblePlayersNum, GameHandler::players_num_t({1, 2, 3}));
+    EXPECT_EQ(pots[1].amount, 400);
+    EXPECT_EQ(pots[1].eligiblePlayersNum, GameHandler::players_num_t({2, 3}));
+    EXPECT_EQ(pots.getTotal(), 750);
+}
+
+TEST_F(SidePotsTest, foldedChipsAboveTheLastLevelShouldGoToTheLastPot) {
+    std::vector<Player> players;
+
+    auto     seats = makeSeats(players, {200, -500, 200});
+    SidePots pots(seats);
+
+    ASSERT_EQ(pots.size(), 1);
+    EXPECT_EQ(pots[0].amount, 900);
+    EXPECT_EQ(pots[0].eligiblePlayersNum, GameHandler::players_num_t({1, 3}));
+}
+
+TEST_F(SidePotsTest, potsShouldBeWonByTheBestEligiblePlayers) {
+    std::vector<Player> players;
+
+    auto     seats   = makeSeats(players, {100, 300, 300, -50});
+    auto     ranking = ranking_t({{4}, {2, 3}, {1}});
+    SidePots pots(seats);
+
+    pots.distribute(ranking, seats, 1);
+
+    EXPECT_EQ(seats.at(1).stack, 1350);
+    EXPECT_EQ(seats.at(2).stack, 1200);
+    EXPECT_EQ(seats.at(3).stack, 1200);
+    EXPECT_EQ(seats.at(4).stack, 1000);
+}
+
+TEST_F(SidePotsTest, oddChipsShouldGoToTheFirstWinnersLeftOfTheDealer) {
+    std::vector<Player> players;
+
+    auto     seats   = makeSeats(players, {100, 100, 100, -25});
+    auto     ranking = ranking_t({{4}, {1, 2, 3}});
+    SidePots pots(seats);
+
+    pots.distribute(ranking, seats, 2);
+
+    EXPECT_EQ(pots[0].winnersNum, GameHandler::players_num_t({3, 1, 2}));
+    EXPECT_EQ(seats.at(3).stack, 1109);
+    EXPECT_EQ(seats.at(1).stack, 1108);
+    EXPECT_EQ(seats.at(2).stack, 1108);
+}
+
+TEST_F(SidePotsTest, jsonRepresentationShouldBeCorrect) {
+    std::vector<Player> players;
+
+    auto     seats   = makeSeats(players, {100, 300, 300});
+    auto     ranking = ranking_t({{3}, {2}, {1}});
+    SidePots pots(seats);
+
+    pots.distribute(ranking, seats, 1);
+
+    // language=json
+    auto expectedJson = R"(
+        [
+            { "amount": 300, "players": ["player_1", "player_2", "player_3"], "winners": ["player_1"] },
+            { "amount": 400, "players": ["player_2", "player_3"], "winners": ["player_2"] }
+        ]
+    )"_json;
+
+    EXPECT_JSON_EQ(pots.toJson(), expectedJson);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <analytics/HudAggregator.hpp>
+#include <analytics/OpponentDatabase.hpp>
+#include <analytics/PushFoldAdvisor.hpp>
+#include <analytics/RangeTracker.hpp>
 #include <game_handler/Game.hpp>
 #include <ocr/OcrFactory.hpp>
 #include <scraper/Model.hpp>
 #include <utilities/Image.hpp>
 
 namespace GameSession {
+    using Analytics::HudAggregator;
+    using Analytics::OpponentDatabase;
+    using Analytics::PushFoldAdvisor;
+    using Analytics::RangeTracker;
     using GameHandler::Game;
     using GameHandler::Player;
     using GameHandler::Round;
@@ -104,70 +112,47 @@ namespace GameSession {
      */
     template<typename ScrapperFnByPlayer> struct CheckedImgN {
         public:
-            explicit CheckedImgN(ScrapperFnByPlayer getterFn, double similarityThreshold = SIMILARITY_THRESHOLD)
-              : _getterFn(std::move(getterFn))
-              , _similarityThreshold(similarityThreshold) {}
+            explicit CheckedImgN(ScrapperFnByPlayer getterFn, int32_t seatsNumber, double similarityThreshold = SIMILARITY_THRESHOLD)
+              : _players(seatsNumber, CheckedImg<ScrapperFnByPlayer> {std::move(getterFn), similarityThreshold}) {}
 
-            [[nodiscard]] auto getImg(int32_t playerNum) const -> const cv::Mat& {
-                switch (playerNum) {
-                    case 1: return _player1.getImg();
-                    case 2: return _player2.getImg();
-                    case 3: return _player3.getImg();
-                    default: throw std::invalid_argument("Invalid player number");
-                }
-            }
+            [[nodiscard]] auto getImg(int32_t playerNum) const -> const cv::Mat& { return _getPlayer(playerNum).getImg(); }
 
             [[nodiscard]] auto getComparisonImg(int32_t playerNum) const -> const cv::Mat& {
-                switch (playerNum) {
-                    case 1: return _player1.getComparisonImg();
-                    case 2: return _player2.getComparisonImg();
-                    case 3: return _player3.getComparisonImg();
-                    default: throw std::invalid_argument("Invalid player number");
-                }
+                return _getPlayer(playerNum).getComparisonImg();
             }
 
             auto setCurrentImg(const cv::Mat& currentFrame, int32_t playerNum) -> void {
-                switch (playerNum) {
-                    case 1: _player1.setCurrentImg(currentFrame, 1); break;
-                    case 2: _player2.setCurrentImg(currentFrame, 2); break;
-                    case 3: _player3.setCurrentImg(currentFrame, 3); break;
-                    default: throw std::invalid_argument("Invalid player number");
-                }
+                _getPlayer(playerNum).setCurrentImg(currentFrame, playerNum);
             }
 
             auto setComparisonImg(const cv::Mat& currentFrame, int32_t playerNum) -> void {
-                switch (playerNum) {
-                    case 1: _player1.setComparisonImg(currentFrame, 1); break;
-                    case 2: _player2.setComparisonImg(currentFrame, 2); break;
-                    case 3: _player3.setComparisonImg(currentFrame, 3); break;
-                    default: throw std::invalid_argument("Invalid player number");
-                }
+                _getPlayer(playerNum).setComparisonImg(currentFrame, playerNum);
             }
 
             [[nodiscard]] auto hasChanged(const cv::Mat& currentFrame, int32_t playerNum) const -> bool {
-                switch (playerNum) {
-                    case 1: return _player1.hasChanged(currentFrame, 1);
-                    case 2: return _player2.hasChanged(currentFrame, 2);
-                    case 3: return _player3.hasChanged(currentFrame, 3);
-                    default: throw std::invalid_argument("Invalid player number");
-                }
+                return _getPlayer(playerNum).hasChanged(currentFrame, playerNum);
             }
 
-            [[nodiscard]] auto isChecked(int32_t playerNum) const -> bool {
-                switch (playerNum) {
-                    case 1: return _player1.isChecked();
-                    case 2: return _player2.isChecked();
-                    case 3: return _player3.isChecked();
-                    default: throw std::invalid_argument("Invalid player number");
+            [[nodiscard]] auto isChecked(int32_t playerNum) const -> bool { return _getPlayer(playerNum).isChecked(); }
+
+        private:
+            std::vector<CheckedImg<ScrapperFnByPlayer>> _players;  // Indexed by the player number - 1
+
+            [[nodiscard]] auto _getPlayer(int32_t playerNum) const -> const CheckedImg<ScrapperFnByPlayer>& {
+                if (playerNum <= 0 || playerNum > static_cast<int32_t>(_players.size())) {
+                    throw std::invalid_argument("Invalid player number");
                 }
+
+                return _players[playerNum - 1];
             }
 
-        private:
-            ScrapperFnByPlayer             _getterFn;
-            double                         _similarityThreshold;
-            CheckedImg<ScrapperFnByPlayer> _player1 {_getterFn, _similarityThreshold};
-            CheckedImg<ScrapperFnByPlayer> _player2 {_getterFn, _similarityThreshold};
-            CheckedImg<ScrapperFnByPlayer> _player3 {_getterFn, _similarityThreshold};
+            auto _getPlayer(int32_t playerNum) -> CheckedImg<ScrapperFnByPlayer>& {
+                if (playerNum <= 0 || playerNum > static_cast<int32_t>(_players.size())) {
+                    throw std::invalid_argument("Invalid player number");
+                }
+
+                return _players[playerNum - 1];
+            }
     };
 
     class Session {
@@ -182,6 +167,23 @@ namespace GameSession {
             auto operator=(Session&& other) noexcept -> Session&;
 
             auto getGame() -> Game& { return _game; }
+            // The players stats, updated at the end of each round, it can be backfilled from the past games before running
+            auto getHud() -> HudAggregator& { return _hud; }
+            // The villains stats are read from the database when the game starts and the game stats are added when it ends, the
+            // database is only read when another session writes it
+            auto openOpponentDatabase(const std::filesystem::path& path) -> void {
+                try {
+                    _opponents = std::make_unique<OpponentDatabase>(path);
+                } catch (const Analytics::opponent_database_locked&) {
+                    _opponents = std::make_unique<OpponentDatabase>(path, OpponentDatabase::Mode::READ_ONLY);
+                }
+            }
+            // The villains range of the current round, narrowed on each of their actions
+            auto getRanges() -> RangeTracker& { return *_ranges; }
+            // The hero push or fold advice is logged on its pre-flop turns, with ICM from the Chen strengths until the table is set
+            auto getAdvisor() -> PushFoldAdvisor& { return *_advisor; }
+            // Load the equity table in the background, or compute and save it when the file is missing or invalid
+            auto loadEquityTable(const std::filesystem::path& path) -> void;
 
             auto run() -> void;
 
@@ -189,35 +191,44 @@ namespace GameSession {
             virtual auto _getScreenshot() -> sharedConstMat_t;
 
         private:
-            milliseconds                  _tickRate = TICK_RATE;
-            time_point                    _lastTick;
-            std::string                   _roomName;
-            uint64_t                      _windowId   = 0;
-            windowSize_t                  _windowSize = {0, 0};
-            Scraper::Model                _scraper    = Scraper::Model(_roomName, _windowSize);
-            std::unique_ptr<OcrInterface> _ocr;
-            Game                          _game;
-            GameStages                    _gameStage = GameStages::STARTING;
-            sharedConstMat_t              _currentScreenshot;
-            int32_t                       _currentButtonNum  = 0;
-            int32_t                       _currentPlayerNum  = 0;
-            ActionType                    _currentAction     = ActionType::NONE;
-            bool                          _showdownTriggered = false;
-            cv::Mat                       _lastWaitingActionImg;
+            milliseconds                      _tickRate = TICK_RATE;
+            time_point                        _lastTick;
+            std::string                       _roomName;
+            uint64_t                          _windowId   = 0;
+            windowSize_t                      _windowSize = {0, 0};
+            Scraper::Model                    _scraper    = Scraper::Model(_roomName, _windowSize);
+            std::unique_ptr<OcrInterface>     _ocr;
+            Game                              _game;
+            HudAggregator                     _hud;
+            std::unique_ptr<OpponentDatabase> _opponents;
+            std::unique_ptr<RangeTracker>     _ranges = std::make_unique<RangeTracker>();  // Stable address for the round listener
+            std::unique_ptr<PushFoldAdvisor>  _advisor = std::make_unique<PushFoldAdvisor>();  // Stable address for the table loader
+            std::jthread                      _equityTableLoader;                              // Joined before the advisor is freed
+            GameStages                        _gameStage = GameStages::STARTING;
+            sharedConstMat_t                  _currentScreenshot;
+            int32_t                           _currentButtonNum  = 0;
+            int32_t                           _currentPlayerNum  = 0;
+            ActionType                        _currentAction     = ActionType::NONE;
+            bool                              _showdownTriggered = false;
+            cv::Mat                           _lastWaitingActionImg;
             // All read images that we need to check if they are the same as the last frame because text appears slowly on the screen
             CheckedImg<F1>  _board1CardImg {[&](const cv::Mat& img) { return _scraper.getBoardCard1Img(img); }};
             CheckedImg<F1>  _board2CardImg {[&](const cv::Mat& img) { return _scraper.getBoardCard2Img(img); }};
             CheckedImg<F1>  _board3CardImg {[&](const cv::Mat& img) { return _scraper.getBoardCard3Img(img); }};
             CheckedImg<F1>  _board4CardImg {[&](const cv::Mat& img) { return _scraper.getBoardCard4Img(img); }};
             CheckedImg<F1>  _board5CardImg {[&](const cv::Mat& img) { return _scraper.getBoardCard5Img(img); }};
-            CheckedImgN<F2> _playerBetImg {[&](const cv::Mat& img, int32_t num) { return _scraper.getPlayerBetImg(img, num); }};
+            CheckedImgN<F2> _playerBetImg {[&](const cv::Mat& img, int32_t num) { return _scraper.getPlayerBetImg(img, num); },
+                                           _scraper.getSeatsNumber()};
             CheckedImgN<F2> _playerActionImg {[&](const cv::Mat& img, int32_t num) { return _scraper.getPlayerActionImg(img, num); },
+                                              _scraper.getSeatsNumber(),
                                               ACTION_SIMILARITY_THRESHOLD};
 
+            auto _adviseHero() -> void;
             auto _determineGameOver() -> void;
             auto _processPlayerAction(const cv::Mat& screenshot, const cv::Mat& actionImg, int32_t playerNum) -> void;
             auto _readPlayerAction(const cv::Mat& screenshot, const cv::Mat& actionImg, int32_t playerNum) -> ActionType;
             auto _readPlayerActionFallback(const cv::Mat& screenshot, int32_t playerNum) -> ActionType;
+            auto _repairMisreadBet(const cv::Mat& screenshot, int32_t playerNum, Round::version_t version) -> void;
             auto _getButtonPosition(const cv::Mat& screenshot) -> int32_t;
             auto _getFlop(const cv::Mat& screenshot) -> void;
             auto _getTurn(const cv::Mat& screenshot) -> void;
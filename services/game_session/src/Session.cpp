@@ -6,6 +6,8 @@
 #include <utilities/Time.hpp>
 
 namespace GameSession {
+    using Analytics::EquityTable;
+    using Analytics::PushFoldAdvice;
     using GameHandler::Hand;
     using GameHandler::invalid_player_name;
     using OCR::CannotReadBoardCardImageException;
@@ -34,6 +36,12 @@ namespace GameSession {
     auto Session::operator=(Session&& other) noexcept -> Session& {
         if (this != &other) {
             _game              = std::move(other._game);
+            _hud               = std::move(other._hud);
+            _opponents         = std::move(other._opponents);
+            _ranges            = std::move(other._ranges);
+            // The running loader is joined before the advisor it fills is freed
+            _equityTableLoader = std::move(other._equityTableLoader);
+            _advisor           = std::move(other._advisor);
             _scraper           = std::move(other._scraper);
             _ocr               = std::move(other._ocr);
             _currentScreenshot = std::move(other._currentScreenshot);
@@ -49,6 +57,26 @@ namespace GameSession {
         return *this;
     }
 
+    auto Session::loadEquityTable(const std::filesystem::path& path) -> void {
+        _equityTableLoader = std::jthread([advisor = _advisor.get(), path]() {
+            try {
+                advisor->setEquityTable(std::make_shared<const EquityTable>(EquityTable::load(path)));
+
+                return;
+            } catch (const std::runtime_error& e) {
+                LOG_INFO(Logger::getLogger(), "Equity table not loaded ({}), computing it", e.what());
+            }
+
+            auto table = std::make_shared<const EquityTable>(EquityTable::compute());
+
+            try {
+                table->save(path);
+            } catch (const std::runtime_error& e) { LOG_ERROR(Logger::getLogger(), "{}", e.what()); }
+
+            advisor->setEquityTable(std::move(table));
+        });
+    }
+
     auto Session::run() -> void {
         while (_gameStage != ENDED) {
             _lastTick          = now();
@@ -83,6 +111,14 @@ namespace GameSession {
     // Used for testing by mocking this method
     auto Session::_getScreenshot() -> sharedConstMat_t { return _scraper.getScreenshot(_windowId); }
 
+    auto Session::_adviseHero() -> void {
+        if (_currentPlayerNum != 1) { return; }
+
+        auto advice = _advisor->advise(_game.getCurrentRound(), _game, _ranges.get());
+
+        if (advice.action != PushFoldAdvice::Action::NONE) { LOG_INFO(Logger::getLogger(), "Hero advice: {}", advice); }
+    }
+
     auto Session::_determineGameOver() -> void {
         const auto& players = _game.getPlayers();
 
@@ -91,6 +127,14 @@ namespace GameSession {
         if (_game.getPlayer(1).isEliminated() || std::count_if(players.begin(), players.end(), winnerFinder) == 1) {
             _game.end();
             _gameStage = ENDED;
+
+            if (_opponents && _opponents->getMode() == OpponentDatabase::Mode::READ_WRITE) {
+                HudAggregator gameHud;
+
+                gameHud.addGame(_game);
+                _opponents->add(gameHud);
+                _opponents->flush();
+            }
         }
     }
 
@@ -106,6 +150,8 @@ namespace GameSession {
             if (!_playerBetImg.isChecked(playerNum)) { return; }
         }
 
+        auto version = round.snapshot();
+
         switch (_currentAction) {
             case FOLD: round.fold(playerNum); break;
             case CHECK: round.check(playerNum); break;
@@ -118,13 +164,21 @@ namespace GameSession {
             case NONE: throw CannotReadGameActionImageException(actionImg, "NONE");
         }
 
+        if (_currentAction == BET || _currentAction == RAISE) { _repairMisreadBet(screenshot, playerNum, version); }
+
+        round.discardSnapshots();
+
         LOG_INFO(Logger::getLogger(), "{}", round.getLastAction());
 
         _currentPlayerNum     = round.getCurrentPlayerNum();
         _lastWaitingActionImg = _scraper.getPlayerActionImg(screenshot, _currentPlayerNum);
         _currentAction        = NONE;
 
-        if (!round.isInProgress()) { _endRound(); }
+        if (!round.isInProgress()) {
+            _endRound();
+        } else {
+            _adviseHero();
+        }
     }
 
     auto Session::_readPlayerAction(const cv::Mat& screenshot, const cv::Mat& actionImg, int32_t playerNum) -> ActionType {
@@ -173,8 +227,40 @@ namespace GameSession {
         return action;
     }
 
+    /**
+     * @brief Compare the displayed player stack with the tracked one after a bet or a raise.
+     *
+     * A mismatch means the bet amount was misread, so the round is rolled back before the action and the action is replayed with
+     * the amount deduced from the displayed stack.
+     */
+    auto Session::_repairMisreadBet(const cv::Mat& screenshot, int32_t playerNum, Round::version_t version) -> void {
+        auto& round = _game.getCurrentRound();
+
+        try {
+            auto displayedStack = _ocr->readPlayerStack(_scraper.getPlayerStackImg(screenshot, playerNum));
+
+            if (displayedStack == round.getCurrentPlayerStack(playerNum)) { return; }
+
+            auto misreadAction = round.getLastAction();
+
+            round.rollbackTo(version);
+
+            auto amount = round.getCurrentPlayerStack(playerNum) - displayedStack;
+
+            if (amount <= 0) {
+                round.replay(misreadAction);  // The displayed stack is not consistent, keep the read bet
+
+                return;
+            }
+
+            round.replay(RoundAction(misreadAction.getAction(), playerNum, misreadAction.getTime(), amount));
+
+            LOG_INFO(Logger::getLogger(), "Player {} bet was misread ({}), corrected to {}", playerNum, misreadAction.getAmount(), amount);
+        } catch (const ExceptionWithImage& e) { LOG_DEBUG(Logger::getLogger(), "Cannot check player {} bet: {}", playerNum, e.what()); }
+    }
+
     auto Session::_getButtonPosition(const cv::Mat& screenshot) -> int32_t {
-        for (int32_t i = 1; i <= 3; i++) {
+        for (int32_t i = 1; i <= _scraper.getSeatsNumber(); i++) {
             if (!isSimilar(_scraper.getPlayerButtonImg(screenshot, i), _ocr->getButtonImg())) { continue; }
 
             return i;
@@ -257,9 +343,22 @@ namespace GameSession {
             // Get player stacks
             _game.setInitialStack(_ocr->readAverageStack(_scraper.getAverageStackImg(screenshot)));
             // Get player names and initialize the game
-            _game.init(_ocr->readPlayerName(_scraper.getPlayer1NameImg(screenshot)),
-                       _ocr->readPlayerName(_scraper.getPlayer2NameImg(screenshot)),
-                       _ocr->readPlayerName(_scraper.getPlayer3NameImg(screenshot)));
+            std::vector<std::string> playersName;
+
+            for (int32_t playerNum = 1; playerNum <= _scraper.getSeatsNumber(); ++playerNum) {
+                playersName.emplace_back(_ocr->readPlayerName(_scraper.getPlayerNameImg(screenshot, playerNum)));
+            }
+
+            _game.init(playersName);
+            // Show the villains stats as soon as their names are known
+            for (int32_t playerNum = 2; playerNum <= _game.getPlayersNumber(); ++playerNum) {
+                auto playerName = _game.getPlayer(playerNum).getName();
+                auto stats      = _hud.getStats(playerName);
+
+                if (_opponents) { stats += _opponents->find(playerName).value_or(Analytics::PlayerStats()); }
+
+                LOG_INFO(Logger::getLogger(), "{}: {}", playerName, stats);
+            }
             // End the initialization, wait for the first round to start
             LOG_INFO(Logger::getLogger(), "{}", _game);
 
@@ -357,8 +456,9 @@ namespace GameSession {
             // Start round
             LOG_INFO(Logger::getLogger(), "New round: [blinds {}] [hand {}] [dealer (player_{})]", blinds, hand, _currentButtonNum);
 
-            _game.newRound(blinds, hand, _currentButtonNum);
+            _ranges->track(_game.newRound(blinds, hand, _currentButtonNum));
             _gameStage = ROUND_IN_PROGRESS;
+            _adviseHero();
         } catch (const CannotFindButtonException& e) {
             LOG_DEBUG(Logger::getLogger(), "Waiting new round, cannot find the button");
         } catch (const CannotReadPlayerCardImageException& e) {
@@ -420,6 +520,8 @@ namespace GameSession {
     auto Session::_endRound() -> void {
         LOG_DEBUG(Logger::getLogger(), "Round recap:\n{}", _game.getCurrentRound().toJson().dump(4));
 
+        _hud.addRound(_game.getCurrentRound(), _game);
+
         _determineGameOver();
 
         if (!_game.isOver()) { _gameStage = WAITING_NEW_ROUND; }
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <game_handler/HandHistory.hpp>
+
+namespace HandHistory {
+    using GameHandler::Round;
+    using GameHandler::RoundView;
+
+    class invalid_action_pattern : public std::runtime_error {
+        public:
+            explicit invalid_action_pattern(const std::string& arg)
+              : runtime_error(arg) {};
+    };
+
+    /**
+     * @brief One byte encoding of a round action with its context on the street.
+     *
+     * Bits 0-2: the action kind, bit 3: the player checked earlier on the street, bit 4: the action puts the player all in, bit 5:
+     * the player is the hero, bits 6-7: the street. The kind of a bet or a raise is its aggression level on the street, the big
+     * blind counts as the pre-flop bet so the first pre-flop raise is a RAISE and the next one a THREE_BET.
+     */
+    namespace ActionSymbol {
+        using symbol_t = uint8_t;
+
+        enum Kind : uint8_t { FOLD = 0, CHECK, CALL, BET, RAISE, THREE_BET, FOUR_BET, OTHER };
+
+        static constexpr std::size_t SYMBOLS_NUMBER = 256;
+        static constexpr symbol_t    KIND_MASK      = 0x07;
+        static constexpr symbol_t    CHECKED_FLAG   = 0x08;
+        static constexpr symbol_t    ALL_IN_FLAG    = 0x10;
+        static constexpr symbol_t    HERO_FLAG      = 0x20;
+        static constexpr int32_t     STREET_SHIFT   = 6;
+
+        inline auto kind(symbol_t symbol) -> Kind { return static_cast<Kind>(symbol & KIND_MASK); }
+        inline auto street(symbol_t symbol) -> Round::Street { return static_cast<Round::Street>(symbol >> STREET_SHIFT); }
+    }  // namespace ActionSymbol
+
+    /**
+     * @brief Encode the actions of a round in order, from its dealer, blinds and players start stack.
+     */
+    class ActionEncoder {
+        public:
+            ActionEncoder(int32_t dealerNum, const GameHandler::Blinds& blinds, std::span<const int32_t> startStacks);
+
+            [[nodiscard]] auto encode(Round::Street street, const GameHandler::RoundAction& action) -> ActionSymbol::symbol_t;
+
+        private:
+            std::array<int32_t, GameHandler::MAX_SEATS> _stacks {};   // Chips left by player number - 1
+            std::array<bool, GameHandler::MAX_SEATS>    _checked {};  // Player checked on the current street
+            Round::Street                               _street      = Round::Street::PREFLOP;
+            int32_t                                     _aggressions = 1;  // The big blind is the pre-flop bet
+    };
+
+    /**
+     * @brief Rounds filter on their actions sequence, compiled from a text pattern into a deterministic automaton.
+     *
+     * A pattern lists street clauses separated by `;`, a clause is a street name (`preflop`, `flop`, `turn` or `river`) followed by
+     * `:` and its steps separated by `,`, e.g. `preflop: villain raise, hero 3-bet; flop: villain check-raise`. A step is a role,
+     * `hero` (the player 1), `villain` (any other player) or `anyone`, followed by an action: `fold`, `check`, `call`, `bet`,
+     * `raise` (any raise), `3-bet`, `4-bet` (4-bet or more), `all-in`, `check-raise`, `check-call` or `check-fold`.
+     *
+     * The steps match the round actions in the pattern order, other actions can be played between two steps. The automaton has one
+     * state per matched steps number and a transition table over the action symbols, so a round is matched with one table lookup
+     * per action without building the round.
+     */
+    class ActionPattern {
+        public:
+            static constexpr std::size_t MAX_STEPS = 254;
+
+            explicit ActionPattern(std::string_view pattern);
+
+            [[nodiscard]] auto getStepsNumber() const -> std::size_t { return _transitions.size() - 1; }
+
+            [[nodiscard]] auto matches(std::span<const ActionSymbol::symbol_t> symbols) const -> bool;
+            [[nodiscard]] auto matches(const Round& round) const -> bool;
+            [[nodiscard]] auto matches(const RoundView& round) const -> bool;
+
+            [[nodiscard]] static auto encode(const Round& round) -> std::vector<ActionSymbol::symbol_t>;
+            [[nodiscard]] static auto encode(const RoundView& round) -> std::vector<ActionSymbol::symbol_t>;
+
+        private:
+            using transitions_t = std::array<uint8_t, ActionSymbol::SYMBOLS_NUMBER>;
+
+            std::vector<transitions_t> _transitions;  // Next state by symbol for each state, the last state is the accepting one
+
+            [[nodiscard]] auto _accepting() const -> uint8_t { return static_cast<uint8_t>(_transitions.size() - 1); }
+    };
+}  // namespace HandHistory
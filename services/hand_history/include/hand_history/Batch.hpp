@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace HandHistory {
+    /**
+     * @brief Call the task with each index from 0 to count - 1 on up to threadsNumber threads, the calling thread included.
+     *
+     * A thread takes the next index as soon as it is done with its current one, so the files of very different sizes are still
+     * balanced between the threads. The task must not throw.
+     */
+    template<typename Task> auto parallelFor(std::size_t count, std::size_t threadsNumber, Task&& task) -> void {
+        std::atomic<std::size_t> nextIndex = 0;
+
+        auto runNextTasks = [&nextIndex, &task, count]() {
+            for (auto index = nextIndex++; index < count; index = nextIndex++) { task(index); }
+        };
+
+        std::vector<std::jthread> threads;
+
+        for (std::size_t i = 1; i < std::min(threadsNumber, count); ++i) { threads.emplace_back(runNextTasks); }
+
+        runNextTasks();
+    }
+
+    /**
+     * @brief Call task(index, thread) with each index from 0 to count - 1 on up to threadsNumber threads, the calling thread
+     * included, and return the number of stolen indexes.
+     *
+     * Each thread owns a queue starting with a contiguous block of indexes, taken from its front so the neighbour tasks run on
+     * the same thread. A thread with an empty queue steals from the back of the other queues, so a slow block is shared once the
+     * other threads are done. The task must not throw.
+     */
+    template<typename Task> auto workStealingFor(std::size_t count, std::size_t threadsNumber, Task&& task) -> std::size_t {
+        struct Queue {
+            public:
+                std::mutex              mutex;
+                std::deque<std::size_t> indexes;
+        };
+
+        auto                     workers = std::max<std::size_t>(1, std::min(threadsNumber, count));
+        std::vector<Queue>       queues(workers);
+        std::atomic<std::size_t> stolen = 0;
+
+        for (std::size_t index = 0; index < count; ++index) { queues[index * workers / count].indexes.push_back(index); }
+
+        auto runTasks = [&queues, &stolen, &task, workers](std::size_t worker) {
+            while (true) {
+                std::optional<std::size_t> index;
+
+                if (std::lock_guard lock(queues[worker].mutex); !queues[worker].indexes.empty()) {
+                    index = queues[worker].indexes.front();
+                    queues[worker].indexes.pop_front();
+                }
+
+                for (std::size_t offset = 1; !index && offset < workers; ++offset) {
+                    auto& victim = queues[(worker + offset) % workers];
+
+                    if (std::lock_guard lock(victim.mutex); !victim.indexes.empty()) {
+                        index = victim.indexes.back();
+                        victim.indexes.pop_back();
+                        ++stolen;
+                    }
+                }
+                // No index is ever added back, every queue is empty
+                if (!index) { return; }
+
+                task(*index, worker);
+            }
+        };
+
+        {
+            std::vector<std::jthread> threads;
+
+            for (std::size_t worker = 1; worker < workers; ++worker) { threads.emplace_back(runTasks, worker); }
+
+            runTasks(0);
+        }
+
+        return stolen;
+    }
+
+    // The files with the given extension in the directory and its sub directories, sorted to process them in a stable order
+    inline auto listFiles(const std::filesystem::path& directory, std::string_view extension) -> std::vector<std::filesystem::path> {
+        std::vector<std::filesystem::path> paths;
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+            if (entry.is_regular_file() && entry.path().extension() == extension) { paths.push_back(entry.path()); }
+        }
+
+        std::ranges::sort(paths);
+
+        return paths;
+    }
+}  // namespace HandHistory
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <game_handler/HandHistory.hpp>
+#include <hand_history/Batch.hpp>
+
+namespace HandHistory {
+    using GameHandler::HandHistoryReader;
+    using GameHandler::json;
+    using GameHandler::RoundView;
+
+    static constexpr int32_t CHECKPOINT_VERSION = 1;
+
+    class invalid_checkpoint : public std::runtime_error {
+        public:
+            explicit invalid_checkpoint(const std::string& arg)
+              : runtime_error(arg) {};
+    };
+
+    // Consecutive rounds of a file, the unit of work of a job
+    struct Shard {
+        public:
+            std::size_t file  = 0;
+            std::size_t first = 0;  // The rounds from first to last excluded
+            std::size_t last  = 0;
+    };
+
+    template<typename Aggregate> struct JobResult {
+        public:
+            Aggregate                aggregate;
+            std::vector<std::string> errors;  // One message per file or shard which could not be read, sorted
+            std::size_t              roundsNumber        = 0;  // Mapped into the aggregate, the resumed rounds included
+            std::size_t              shardsNumber        = 0;
+            std::size_t              resumedShardsNumber = 0;  // Already in the checkpoint aggregate
+    };
+
+    /**
+     * @brief Map-reduce jobs over the binary hand history files.
+     *
+     * The files are split in shards of consecutive rounds, run on a work stealing pool. Each shard maps its rounds into a fresh
+     * aggregate from the mapped file, one round at a time without decoding the whole file, then the aggregate is merged into
+     * the job one. The map is called concurrently as `map(const HandHistoryReader& game, const RoundView& round, Aggregate&)`.
+     *
+     * The Aggregate is default constructible, has `merge(const Aggregate&)`, `toJson() const -> json` and a static
+     * `fromJson(const json&) -> Aggregate`. With a checkpoint file, the merged aggregate and its shards are saved every few
+     * shards and when the job ends, and a job skips the shards of its checkpoint: an interrupted job resumes where it was
+     * saved, and a finished one only maps the files added since.
+     */
+    class JobRunner {
+        public:
+            static constexpr std::size_t DEFAULT_SHARD_ROUNDS      = 4'096;
+            static constexpr std::size_t DEFAULT_CHECKPOINT_SHARDS = 64;
+
+            explicit JobRunner(std::size_t threadsNumber = std::max(1U, std::thread::hardware_concurrency()))
+              : _threadsNumber(std::max<std::size_t>(1, threadsNumber)) {}
+
+            auto setShardRounds(std::size_t shardRounds) -> void { _shardRounds = std::max<std::size_t>(1, shardRounds); }
+            auto setCheckpoint(const std::filesystem::path& path, std::size_t everyShards = DEFAULT_CHECKPOINT_SHARDS) -> void {
+                _checkpointPath   = path;
+                _checkpointShards = std::max<std::size_t>(1, everyShards);
+            }
+
+            template<typename Aggregate, typename Map>
+            [[nodiscard]] auto runFiles(std::span<const std::filesystem::path> paths, Map&& map) const -> JobResult<Aggregate>;
+            // Run over the `.pthh` files of the directory and its sub directories
+            template<typename Aggregate, typename Map>
+            [[nodiscard]] auto runDirectory(const std::filesystem::path& directory, Map&& map) const -> JobResult<Aggregate> {
+                return runFiles<Aggregate>(listFiles(directory, ".pthh"), std::forward<Map>(map));
+            }
+
+            [[nodiscard]] auto planShards(std::span<const std::filesystem::path> paths, std::vector<std::string>& errors) const
+                -> std::vector<Shard>;
+
+        private:
+            struct Checkpoint {
+                public:
+                    std::set<std::string> shards;  // The shards key
+                    json                  aggregate;
+                    std::size_t           roundsNumber = 0;
+            };
+
+            std::size_t           _threadsNumber;
+            std::size_t           _shardRounds      = DEFAULT_SHARD_ROUNDS;
+            std::size_t           _checkpointShards = DEFAULT_CHECKPOINT_SHARDS;
+            std::filesystem::path _checkpointPath;
+
+            [[nodiscard]] auto _loadCheckpoint() const -> std::optional<Checkpoint>;
+            auto               _saveCheckpoint(const Checkpoint& checkpoint) const -> void;
+
+            [[nodiscard]] static auto _shardKey(const std::filesystem::path& path, const Shard& shard) -> std::string;
+    };
+
+    template<typename Aggregate, typename Map>
+    auto JobRunner::runFiles(std::span<const std::filesystem::path> paths, Map&& map) const -> JobResult<Aggregate> {
+        JobResult<Aggregate>     result;
+        auto                     shards     = planShards(paths, result.errors);
+        auto                     checkpoint = _loadCheckpoint().value_or(Checkpoint());
+        std::vector<std::size_t> pending;
+        std::size_t              sinceCheckpoint = 0;
+        std::mutex               mutex;  // Guards the result and the checkpoint
+        // The file mapped by each thread, reused by its next shards which are mostly from the same file
+        std::vector<std::unique_ptr<HandHistoryReader>> readers(_threadsNumber);
+        std::vector<std::size_t>                        readerFiles(_threadsNumber, paths.size());
+
+        if (!checkpoint.aggregate.is_null()) { result.aggregate = Aggregate::fromJson(checkpoint.aggregate); }
+
+        result.shardsNumber = shards.size();
+        result.roundsNumber = checkpoint.roundsNumber;
+
+        for (std::size_t shard = 0; shard < shards.size(); ++shard) {
+            if (checkpoint.shards.contains(_shardKey(paths[shards[shard].file], shards[shard]))) {
+                ++result.resumedShardsNumber;
+            } else {
+                pending.push_back(shard);
+            }
+        }
+
+        auto saveCheckpoint = [&]() {
+            checkpoint.aggregate    = result.aggregate.toJson();
+            checkpoint.roundsNumber = result.roundsNumber;
+            sinceCheckpoint         = 0;
+
+            try {
+                _saveCheckpoint(checkpoint);
+            } catch (const std::exception& error) { result.errors.emplace_back(error.what()); }
+        };
+
+        workStealingFor(pending.size(), _threadsNumber, [&](std::size_t index, std::size_t thread) {
+            const auto& shard = shards[pending[index]];
+            const auto& path  = paths[shard.file];
+            Aggregate   partial;
+            std::size_t roundsNumber = 0;
+
+            try {
+                if (readerFiles[thread] != shard.file) {
+                    readers[thread].reset();
+                    readers[thread]     = std::make_unique<HandHistoryReader>(path);
+                    readerFiles[thread] = shard.file;
+                }
+
+                const auto& reader = *readers[thread];
+                auto        round  = reader.begin();
+
+                for (std::size_t skipped = 0; skipped < shard.first && round != reader.end(); ++skipped) { ++round; }
+
+                for (; roundsNumber < shard.last - shard.first && round != reader.end(); ++roundsNumber, ++round) {
+                    map(reader, *round, partial);
+                }
+            } catch (const std::exception& error) {
+                std::lock_guard lock(mutex);
+
+                result.errors.push_back(fmt::format("{} rounds {} to {}: {}", path.string(), shard.first, shard.last, error.what()));
+
+                return;
+            }
+
+            std::lock_guard lock(mutex);
+
+            result.aggregate.merge(partial);
+            result.roundsNumber += roundsNumber;
+
+            if (_checkpointPath.empty()) { return; }
+
+            checkpoint.shards.insert(_shardKey(path, shard));
+
+            if (++sinceCheckpoint >= _checkpointShards) { saveCheckpoint(); }
+        });
+
+        if (!_checkpointPath.empty()) { saveCheckpoint(); }
+
+        std::ranges::sort(result.errors);
+
+        return result;
+    }
+}  // namespace HandHistory
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace HandHistory {
+    /**
+     * @brief Zero copy line tokenizer, the lines are views on the tokenized text without their line ending.
+     */
+    class LineTokenizer {
+        public:
+            explicit LineTokenizer(std::string_view text)
+              : _text(text) {
+                static constexpr std::string_view UTF8_BOM = "\xEF\xBB\xBF";
+
+                if (_text.starts_with(UTF8_BOM)) { _position = UTF8_BOM.size(); }
+            }
+
+            // Read the next line, return false when the text is over
+            auto next(std::string_view& line) -> bool {
+                if (_position >= _text.size()) { return false; }
+
+                auto end = _text.find('\n', _position);
+
+                if (end == std::string_view::npos) { end = _text.size(); }
+
+                line      = _text.substr(_position, end - _position);
+                _position = end + 1;
+
+                if (line.ends_with('\r')) { line.remove_suffix(1); }
+
+                ++_lineNumber;
+
+                return true;
+            }
+
+            [[nodiscard]] auto getLineNumber() const -> std::size_t { return _lineNumber; }
+
+        private:
+            std::string_view _text;
+            std::size_t      _position   = 0;
+            std::size_t      _lineNumber = 0;
+    };
+
+    // Consume the text up to the next separator and return it
+    inline auto nextToken(std::string_view& text, char separator = ' ') -> std::string_view {
+        auto end   = text.find(separator);
+        auto token = text.substr(0, end);
+
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+
+        return token;
+    }
+
+    // Text between the first opening and the next closing character, empty when not found
+    inline auto between(std::string_view text, char opening, char closing) -> std::string_view {
+        auto start = text.find(opening);
+
+        if (start == std::string_view::npos) { return {}; }
+
+        auto end = text.find(closing, start + 1);
+
+        return end == std::string_view::npos ? std::string_view() : text.substr(start + 1, end - start - 1);
+    }
+
+    inline auto toInt(std::string_view text) -> std::optional<int32_t> {
+        int32_t value = 0;
+
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+        if (error != std::errc() || end != text.data() + text.size()) { return std::nullopt; }
+
+        return value;
+    }
+}  // namespace HandHistory
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <hand_history/ActionPattern.hpp>
+
+namespace HandHistory {
+    using GameHandler::Game;
+
+    struct PatternMatch {
+        public:
+            std::size_t source = 0;  // The file or the game index
+            std::size_t round  = 0;  // The round index in the file or the game
+
+            auto operator==(const PatternMatch& other) const -> bool = default;
+    };
+
+    struct SearchResult {
+        public:
+            std::vector<PatternMatch> matches;  // In the sources order, then in the rounds order
+            std::vector<std::string>  errors;   // One message per file which could not be read
+            std::size_t               roundsNumber = 0;
+    };
+
+    /**
+     * @brief Run an action pattern over the stored rounds on several threads.
+     *
+     * The binary hand history files are mapped and their rounds matched in place from their action records, without decoding
+     * the rest of the round nor building a Game. The files are shared between the threads, each thread takes the next file when
+     * it is done with its current one.
+     */
+    class PatternSearch {
+        public:
+            explicit PatternSearch(std::size_t threadsNumber = std::max(1U, std::thread::hardware_concurrency()))
+              : _threadsNumber(std::max<std::size_t>(1, threadsNumber)) {}
+
+            [[nodiscard]] auto searchFiles(const ActionPattern& pattern, std::span<const std::filesystem::path> paths) const
+                -> SearchResult;
+            [[nodiscard]] auto searchDirectory(const ActionPattern& pattern, const std::filesystem::path& directory) const
+                -> SearchResult;
+            [[nodiscard]] auto searchGames(const ActionPattern& pattern, std::span<const Game> games) const -> SearchResult;
+
+        private:
+            std::size_t _threadsNumber;
+    };
+}  // namespace HandHistory
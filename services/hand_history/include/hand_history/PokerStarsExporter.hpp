@@ -0,0 +1,61 @@
+#pragma once
+
+#include <filesystem>
+#include <ostream>
+#include <span>
+#include <thread>
+
+#include <game_handler/Game.hpp>
+
+namespace HandHistory {
+    using GameHandler::Game;
+    using GameHandler::Round;
+    using std::chrono::system_clock;
+
+    struct ExportResult {
+        public:
+            std::size_t              gamesNumber  = 0;
+            std::size_t              roundsNumber = 0;
+            std::vector<std::string> errors;  // One message per game which could not be exported
+    };
+
+    /**
+     * @brief Write the games as PokerStars tournament hand histories, the format read by the third-party analysis tools.
+     *
+     * The rounds are written one by one straight from the game rounds into a buffer flushed to the stream when it is full, there
+     * is no intermediate JSON. The hand numbers are made of the tournament id followed by the round index on 4 digits.
+     */
+    class PokerStarsExporter {
+        public:
+            static constexpr std::size_t DEFAULT_BUFFER_CAPACITY = 1 << 16;
+
+            explicit PokerStarsExporter(std::ostream& stream, std::size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY);
+            PokerStarsExporter(const PokerStarsExporter& other) = delete;
+            PokerStarsExporter(PokerStarsExporter&& other)      = delete;
+
+            ~PokerStarsExporter() { flush(); }
+
+            auto operator=(const PokerStarsExporter& other) -> PokerStarsExporter& = delete;
+            auto operator=(PokerStarsExporter&& other) -> PokerStarsExporter&      = delete;
+
+            auto exportGame(const Game& game, uint64_t tournamentId, system_clock::time_point startTime) -> void;
+            auto flush() -> void;
+
+            // Export each game JSON file of the archive to a text file with the same name in the output directory
+            [[nodiscard]] static auto exportArchive(const std::filesystem::path& archiveDirectory,
+                                                    const std::filesystem::path& outputDirectory,
+                                                    std::size_t threadsNumber = std::max(1U, std::thread::hardware_concurrency()))
+                -> ExportResult;
+
+        private:
+            std::ostream&                 _stream;
+            std::string                   _buffer;
+            std::size_t                   _bufferCapacity;
+            std::vector<std::string_view> _playersName;  // Names of the game being exported, views on the interned names
+            uint64_t                      _tournamentId = 0;
+            int32_t                       _buyIn        = 0;
+
+            auto _writeRound(const Round& round, uint64_t handNumber, int32_t level, system_clock::time_point time) -> void;
+            auto _flushIfFull() -> void;
+    };
+}  // namespace HandHistory
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <game_handler/Game.hpp>
+
+namespace HandHistory {
+    using GameHandler::Game;
+
+    class invalid_winamax_hand : public std::runtime_error {
+        public:
+            explicit invalid_winamax_hand(const std::string& arg)
+              : runtime_error(arg) {};
+    };
+
+    // A valid hand using a feature the import does not replay yet, the hand is skipped and the import goes on
+    class unsupported_winamax_hand : public invalid_winamax_hand {
+        public:
+            explicit unsupported_winamax_hand(const std::string& arg)
+              : invalid_winamax_hand(arg) {};
+    };
+
+    struct ImportResult {
+        public:
+            std::vector<Game>        games;   // In the files order, then in the files hands order
+            std::vector<std::string> errors;        // One message per file which could not be imported
+            std::vector<std::string> skippedHands;  // One message per unsupported hand of the imported files
+            std::size_t              roundsNumber = 0;
+    };
+
+    /**
+     * @brief Import the Winamax text hand histories of the tournaments as games.
+     *
+     * Each hand is replayed through the Round actions API from the seats stack, so the imported games hold the same data as
+     * the scraped ones. A new game starts each time the tournament id changes. The hero is the player the cards are dealt
+     * to, it is the player 1 and the other players follow by seat number. The unsupported hands are skipped and reported, the
+     * next hand starts again from its seats stack.
+     *
+     * The files are shared between the import threads, the hands of a file are parsed in place from its content.
+     */
+    class WinamaxImporter {
+        public:
+            explicit WinamaxImporter(std::size_t threadsNumber = std::max(1U, std::thread::hardware_concurrency()))
+              : _threadsNumber(std::max<std::size_t>(1, threadsNumber)) {}
+
+            [[nodiscard]] static auto parse(std::string_view text, std::vector<std::string>& skippedHands) -> std::vector<Game>;
+            [[nodiscard]] static auto parseFile(const std::filesystem::path& path, std::vector<std::string>& skippedHands)
+                -> std::vector<Game>;
+
+            [[nodiscard]] auto importFiles(std::span<const std::filesystem::path> paths) const -> ImportResult;
+            [[nodiscard]] auto importDirectory(const std::filesystem::path& directory) const -> ImportResult;
+
+        private:
+            std::size_t _threadsNumber;
+    };
+}  // namespace HandHistory
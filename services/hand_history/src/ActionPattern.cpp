@@ -0,0 +1,297 @@
+#include "hand_history/ActionPattern.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace HandHistory {
+    using fmt::format;
+    using GameHandler::MAX_SEATS;
+    using GameHandler::RoundAction;
+    using GameHandler::SeatTable;
+    using ActionSymbol::symbol_t;
+
+    using ActionType = RoundAction::ActionType;
+
+    namespace {
+        constexpr std::array<std::string_view, Round::SHOWDOWN> STREETS_NAME = {"preflop", "flop", "turn", "river"};
+
+        enum class Role : uint8_t { HERO = 0, VILLAIN, ANYONE };
+
+        struct Step {
+            public:
+                Round::Street street = Round::Street::PREFLOP;
+                Role          role   = Role::ANYONE;
+                std::string   action;
+        };
+
+        auto trim(std::string_view text) -> std::string_view {
+            auto start = text.find_first_not_of(" \t\r\n");
+
+            if (start == std::string_view::npos) { return {}; }
+
+            return text.substr(start, text.find_last_not_of(" \t\r\n") - start + 1);
+        }
+
+        auto lowerCase(std::string_view text) -> std::string {
+            std::string lower(text);
+
+            std::ranges::transform(lower, lower.begin(), [](unsigned char letter) { return std::tolower(letter); });
+
+            return lower;
+        }
+
+        // Call the callback with each trimmed part of the text between the separators
+        template<typename Callback> auto forEachPart(std::string_view text, char separator, Callback&& callback) -> void {
+            for (std::size_t start = 0; start <= text.size();) {
+                auto end = std::min(text.find(separator, start), text.size());
+
+                callback(trim(text.substr(start, end - start)));
+
+                start = end + 1;
+            }
+        }
+
+        auto parseStreet(std::string_view name) -> Round::Street {
+            auto lower = lowerCase(name);
+
+            if (lower == "pre-flop") { return Round::Street::PREFLOP; }
+
+            for (std::size_t street = 0; street < STREETS_NAME.size(); ++street) {
+                if (lower == STREETS_NAME.at(street)) { return static_cast<Round::Street>(street); }
+            }
+
+            throw invalid_action_pattern(format("Unknown street `{}`", name));
+        }
+
+        auto parseRole(std::string_view name) -> Role {
+            auto lower = lowerCase(name);
+
+            if (lower == "hero") { return Role::HERO; }
+            if (lower == "villain") { return Role::VILLAIN; }
+            if (lower == "anyone") { return Role::ANYONE; }
+
+            throw invalid_action_pattern(format("Unknown role `{}`", name));
+        }
+
+        auto isRaise(ActionSymbol::Kind kind) -> bool { return kind >= ActionSymbol::RAISE && kind <= ActionSymbol::FOUR_BET; }
+
+        // Whether the symbol is the step action, the action name has been checked when the pattern was parsed
+        auto actionMatches(std::string_view action, symbol_t symbol) -> bool {
+            auto kind    = ActionSymbol::kind(symbol);
+            auto checked = (symbol & ActionSymbol::CHECKED_FLAG) != 0;
+
+            if (action == "fold") { return kind == ActionSymbol::FOLD; }
+            if (action == "check") { return kind == ActionSymbol::CHECK; }
+            if (action == "call") { return kind == ActionSymbol::CALL; }
+            if (action == "bet") { return kind == ActionSymbol::BET; }
+            if (action == "raise") { return isRaise(kind); }
+            if (action == "3-bet") { return kind == ActionSymbol::THREE_BET; }
+            if (action == "4-bet") { return kind == ActionSymbol::FOUR_BET; }
+            if (action == "all-in") { return kind != ActionSymbol::OTHER && (symbol & ActionSymbol::ALL_IN_FLAG) != 0; }
+            if (action == "check-raise") { return checked && isRaise(kind); }
+            if (action == "check-call") { return checked && kind == ActionSymbol::CALL; }
+            if (action == "check-fold") { return checked && kind == ActionSymbol::FOLD; }
+
+            throw invalid_action_pattern(format("Unknown action `{}`", action));
+        }
+
+        auto stepMatches(const Step& step, symbol_t symbol) -> bool {
+            auto hero = (symbol & ActionSymbol::HERO_FLAG) != 0;
+
+            if (ActionSymbol::street(symbol) != step.street) { return false; }
+            if ((step.role == Role::HERO && !hero) || (step.role == Role::VILLAIN && hero)) { return false; }
+
+            return actionMatches(step.action, symbol);
+        }
+
+        auto parse(std::string_view pattern) -> std::vector<Step> {
+            std::vector<Step> steps;
+
+            forEachPart(pattern, ';', [&](std::string_view clause) {
+                if (clause.empty()) { return; }
+
+                auto colon = clause.find(':');
+
+                if (colon == std::string_view::npos) { throw invalid_action_pattern(format("Missing street in `{}`", clause)); }
+
+                auto street = parseStreet(trim(clause.substr(0, colon)));
+
+                forEachPart(clause.substr(colon + 1), ',', [&](std::string_view step) {
+                    auto space = step.find_first_of(" \t");
+
+                    if (space == std::string_view::npos || trim(step.substr(space)).find_first_of(" \t") != std::string_view::npos) {
+                        throw invalid_action_pattern(format("Invalid step `{}`, expected a role and an action", step));
+                    }
+
+                    auto role = parseRole(step.substr(0, space));
+
+                    steps.push_back({.street = street, .role = role, .action = lowerCase(trim(step.substr(space)))});
+                    // Fail on an unknown action when the pattern is compiled rather than when it is matched
+                    actionMatches(steps.back().action, 0);
+                });
+            });
+
+            if (steps.empty()) { throw invalid_action_pattern("The pattern has no step"); }
+            if (steps.size() > ActionPattern::MAX_STEPS) { throw invalid_action_pattern("The pattern has too many steps"); }
+
+            return steps;
+        }
+
+        // Call the callback with the symbol of each action of the round in order, until it returns false
+        template<typename Callback> auto forEachSymbol(const Round& round, Callback&& callback) -> void {
+            std::array<int32_t, MAX_SEATS> stacks {};
+
+            for (const auto& seat : round.getSeats()) { stacks.at(seat.number - 1) = seat.initialStack; }
+
+            ActionEncoder encoder(round.getDealerNum(), round.getBlinds(), std::span(stacks).first(round.getSeats().size()));
+
+            for (int32_t street = Round::Street::PREFLOP; street < Round::Street::SHOWDOWN; ++street) {
+                for (const auto& action : round.getActions().at(street)) {
+                    if (!callback(encoder.encode(static_cast<Round::Street>(street), action))) { return; }
+                }
+            }
+        }
+
+        template<typename Callback> auto forEachSymbol(const RoundView& round, Callback&& callback) -> void {
+            std::array<int32_t, MAX_SEATS> stacks {};
+            bool                           running = true;
+
+            for (int32_t playerNum = 1; playerNum <= round.getPlayersNumber(); ++playerNum) {
+                stacks.at(playerNum - 1) = round.getStartStack(playerNum);
+            }
+
+            ActionEncoder encoder(round.getDealerNum(), round.getBlinds(), std::span(stacks).first(round.getPlayersNumber()));
+            // The actions of a street are decoded in one go, the remaining ones are skipped once the callback stopped
+            for (int32_t street = Round::Street::PREFLOP; street < Round::Street::SHOWDOWN && running; ++street) {
+                round.forEachAction(static_cast<Round::Street>(street), [&](const RoundAction& action) {
+                    if (running) { running = callback(encoder.encode(static_cast<Round::Street>(street), action)); }
+                });
+            }
+        }
+    }  // namespace
+
+    ActionEncoder::ActionEncoder(int32_t dealerNum, const GameHandler::Blinds& blinds, std::span<const int32_t> startStacks) {
+        auto playersNumber = static_cast<int32_t>(startStacks.size());
+        auto dealtNumber   = std::ranges::count_if(startStacks, [](int32_t stack) { return stack > 0; });
+
+        std::ranges::copy(startStacks, _stacks.begin());
+
+        if (dealtNumber < 2) { return; }
+
+        auto [smallBlindNum, bigBlindNum] = SeatTable::blindsSeatNum(dealerNum, playersNumber, [this](int32_t playerNum) {
+            return _stacks.at(playerNum - 1) > 0;
+        });
+
+        _stacks.at(smallBlindNum - 1) -= std::min(blinds.SB(), _stacks.at(smallBlindNum - 1));
+        _stacks.at(bigBlindNum - 1) -= std::min(blinds.BB(), _stacks.at(bigBlindNum - 1));
+    }
+
+    auto ActionEncoder::encode(Round::Street street, const RoundAction& action) -> symbol_t {
+        if (street != _street) {
+            _street      = street;
+            _aggressions = 0;
+            _checked     = {};
+        }
+
+        auto playerIndex = std::clamp(action.getPlayerNum(), 1, MAX_SEATS) - 1;
+        auto kind        = ActionSymbol::OTHER;
+        bool chips       = false;
+
+        switch (action.getAction()) {
+            case ActionType::FOLD: kind = ActionSymbol::FOLD; break;
+            case ActionType::CHECK: kind = ActionSymbol::CHECK; break;
+            case ActionType::CALL:
+                kind  = ActionSymbol::CALL;
+                chips = true;
+                break;
+            case ActionType::BET:
+            case ActionType::RAISE:
+            case ActionType::ALL_IN:
+                kind  = static_cast<ActionSymbol::Kind>(ActionSymbol::BET + std::min(_aggressions++, 3));
+                chips = true;
+                break;
+            default: break;
+        }
+
+        auto symbol = static_cast<symbol_t>(kind | (street << ActionSymbol::STREET_SHIFT));
+
+        if (_checked.at(playerIndex)) { symbol |= ActionSymbol::CHECKED_FLAG; }
+        if (playerIndex == 0) { symbol |= ActionSymbol::HERO_FLAG; }
+
+        if (chips) {
+            _stacks.at(playerIndex) -= action.getAmount();
+
+            if (_stacks.at(playerIndex) <= 0) { symbol |= ActionSymbol::ALL_IN_FLAG; }
+        }
+
+        if (kind == ActionSymbol::CHECK) { _checked.at(playerIndex) = true; }
+
+        return symbol;
+    }
+
+    ActionPattern::ActionPattern(std::string_view pattern) {
+        auto steps = parse(pattern);
+
+        _transitions.resize(steps.size() + 1);
+        // A state stays on the symbols that are not its next step, the accepting state stays on every symbol
+        for (std::size_t state = 0; state < _transitions.size(); ++state) {
+            for (std::size_t symbol = 0; symbol < ActionSymbol::SYMBOLS_NUMBER; ++symbol) {
+                auto advance = state < steps.size() && stepMatches(steps[state], static_cast<symbol_t>(symbol));
+
+                _transitions[state][symbol] = static_cast<uint8_t>(advance ? state + 1 : state);
+            }
+        }
+    }
+
+    auto ActionPattern::matches(std::span<const symbol_t> symbols) const -> bool {
+        uint8_t state = 0;
+
+        for (auto symbol : symbols) {
+            state = _transitions[state][symbol];
+
+            if (state == _accepting()) { return true; }
+        }
+
+        return false;
+    }
+
+    auto ActionPattern::matches(const Round& round) const -> bool {
+        uint8_t state = 0;
+
+        forEachSymbol(round, [&](symbol_t symbol) { return (state = _transitions[state][symbol]) != _accepting(); });
+
+        return state == _accepting();
+    }
+
+    auto ActionPattern::matches(const RoundView& round) const -> bool {
+        uint8_t state = 0;
+
+        forEachSymbol(round, [&](symbol_t symbol) { return (state = _transitions[state][symbol]) != _accepting(); });
+
+        return state == _accepting();
+    }
+
+    auto ActionPattern::encode(const Round& round) -> std::vector<symbol_t> {
+        std::vector<symbol_t> symbols;
+
+        forEachSymbol(round, [&](symbol_t symbol) {
+            symbols.push_back(symbol);
+
+            return true;
+        });
+
+        return symbols;
+    }
+
+    auto ActionPattern::encode(const RoundView& round) -> std::vector<symbol_t> {
+        std::vector<symbol_t> symbols;
+
+        forEachSymbol(round, [&](symbol_t symbol) {
+            symbols.push_back(symbol);
+
+            return true;
+        });
+
+        return symbols;
+    }
+}  // namespace HandHistory
@@ -0,0 +1,73 @@
+#include "hand_history/JobRunner.hpp"
+
+#include <fstream>
+
+namespace HandHistory {
+    using fmt::format;
+
+    auto JobRunner::planShards(std::span<const std::filesystem::path> paths, std::vector<std::string>& errors) const
+        -> std::vector<Shard> {
+        std::vector<Shard> shards;
+
+        for (std::size_t file = 0; file < paths.size(); ++file) {
+            try {
+                auto roundsNumber = HandHistoryReader(paths[file]).getRoundsNumber();
+
+                for (std::size_t first = 0; first < roundsNumber; first += _shardRounds) {
+                    shards.push_back({.file = file, .first = first, .last = std::min(first + _shardRounds, roundsNumber)});
+                }
+            } catch (const std::exception& error) { errors.push_back(format("{}: {}", paths[file].string(), error.what())); }
+        }
+
+        return shards;
+    }
+
+    auto JobRunner::_loadCheckpoint() const -> std::optional<Checkpoint> {
+        if (_checkpointPath.empty() || !std::filesystem::exists(_checkpointPath)) { return std::nullopt; }
+
+        std::ifstream file(_checkpointPath);
+        auto          content = json::parse(file, nullptr, false);
+
+        if (content.is_discarded() || !content.is_object()) { throw invalid_checkpoint("The file is not a job checkpoint"); }
+        if (content.value("version", 0) != CHECKPOINT_VERSION) {
+            throw invalid_checkpoint(format("Unsupported checkpoint version {}", content.value("version", 0)));
+        }
+        // Other shard boundaries would map some rounds twice
+        if (auto shardRounds = content.value("shard_rounds", std::size_t(0)); shardRounds != _shardRounds) {
+            throw invalid_checkpoint(format("The checkpoint shards have {} rounds, not {}", shardRounds, _shardRounds));
+        }
+
+        Checkpoint checkpoint;
+
+        checkpoint.shards       = content.at("shards").get<std::set<std::string>>();
+        checkpoint.aggregate    = content.at("aggregate");
+        checkpoint.roundsNumber = content.at("rounds").get<std::size_t>();
+
+        return checkpoint;
+    }
+
+    // Written to a temporary file then renamed, so an interrupted save leaves the previous checkpoint
+    auto JobRunner::_saveCheckpoint(const Checkpoint& checkpoint) const -> void {
+        auto temporaryPath = _checkpointPath;
+
+        temporaryPath += ".tmp";
+
+        {
+            std::ofstream file(temporaryPath, std::ios::trunc);
+
+            if (!file.is_open()) { throw std::runtime_error(format("Cannot open the checkpoint file {}", temporaryPath.string())); }
+
+            file << json {{"version", CHECKPOINT_VERSION},
+                          {"shard_rounds", _shardRounds},
+                          {"rounds", checkpoint.roundsNumber},
+                          {"shards", checkpoint.shards},
+                          {"aggregate", checkpoint.aggregate}};
+        }
+
+        std::filesystem::rename(temporaryPath, _checkpointPath);
+    }
+
+    auto JobRunner::_shardKey(const std::filesystem::path& path, const Shard& shard) -> std::string {
+        return format("{}#{}-{}", path.string(), shard.first, shard.last);
+    }
+}  // namespace HandHistory
@@ -0,0 +1,78 @@
+#include "hand_history/PatternSearch.hpp"
+
+#include <hand_history/Batch.hpp>
+
+namespace HandHistory {
+    using fmt::format;
+    using GameHandler::HandHistoryReader;
+
+    namespace {
+        struct SourceResult {
+            public:
+                std::vector<std::size_t> rounds;
+                std::string              error;
+                std::size_t              roundsNumber = 0;
+        };
+
+        // Gather the sources result in the sources order
+        auto gather(std::vector<SourceResult>& sources) -> SearchResult {
+            SearchResult result;
+
+            for (std::size_t source = 0; source < sources.size(); ++source) {
+                result.roundsNumber += sources[source].roundsNumber;
+
+                for (auto round : sources[source].rounds) { result.matches.push_back({.source = source, .round = round}); }
+
+                if (!sources[source].error.empty()) { result.errors.push_back(std::move(sources[source].error)); }
+            }
+
+            return result;
+        }
+    }  // namespace
+
+    auto PatternSearch::searchFiles(const ActionPattern& pattern, std::span<const std::filesystem::path> paths) const -> SearchResult {
+        std::vector<SourceResult> files(paths.size());
+
+        parallelFor(paths.size(), _threadsNumber, [&](std::size_t file) {
+            try {
+                HandHistoryReader reader(paths[file]);
+                std::size_t       round = 0;
+
+                for (const auto& roundView : reader) {
+                    if (pattern.matches(roundView)) { files[file].rounds.push_back(round); }
+
+                    ++round;
+                }
+
+                files[file].roundsNumber = round;
+            } catch (const std::exception& error) { files[file].error = format("{}: {}", paths[file].string(), error.what()); }
+        });
+
+        return gather(files);
+    }
+
+    // Search the `.pthh` files of the directory and its sub directories, in the paths order
+    auto PatternSearch::searchDirectory(const ActionPattern& pattern, const std::filesystem::path& directory) const -> SearchResult {
+        return searchFiles(pattern, listFiles(directory, ".pthh"));
+    }
+
+    auto PatternSearch::searchGames(const ActionPattern& pattern, std::span<const Game> games) const -> SearchResult {
+        std::vector<SourceResult> results(games.size());
+
+        parallelFor(games.size(), _threadsNumber, [&](std::size_t game) {
+            try {
+                std::size_t round = 0;
+                // The spilled rounds are read back from their segment
+                games[game].forEachRound([&](const Round& gameRound) {
+                    if (pattern.matches(gameRound)) { results[game].rounds.push_back(round); }
+
+                    ++round;
+                });
+
+                results[game].roundsNumber = round;
+            } catch (const std::exception& error) { results[game].error = format("Game {}: {}", game, error.what()); }
+        });
+
+        return gather(results);
+    }
+}  // namespace HandHistory
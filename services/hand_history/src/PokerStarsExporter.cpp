@@ -0,0 +1,381 @@
+#include "hand_history/PokerStarsExporter.hpp"
+
+#include <fstream>
+
+#include <hand_history/Batch.hpp>
+
+namespace HandHistory {
+    using fmt::format;
+    using fmt::format_to;
+    using GameHandler::Card;
+    using GameHandler::Hand;
+    using GameHandler::MAX_SEATS;
+    using GameHandler::RoundAction;
+    using std::chrono::days;
+    using std::chrono::floor;
+    using std::chrono::seconds;
+
+    namespace {
+        constexpr uint64_t HAND_NUMBER_BASE = 10000;  // The round index is appended to the tournament id on 4 digits
+        constexpr int32_t  CENTS            = 100;
+
+        constexpr std::array<std::string_view, Round::SHOWDOWN> STREETS_NAME   = {"Pre-flop", "Flop", "Turn", "River"};
+        constexpr std::array<std::string_view, Round::SHOWDOWN> STREETS_MARKER = {"HOLE CARDS", "FLOP", "TURN", "RIVER"};
+
+        // PokerStars writes the suit in lower case, `Ah`
+        auto suitLetter(Card::Suit suit) -> char {
+            switch (suit) {
+                case Card::Suit::HEART: return 'h';
+                case Card::Suit::DIAMOND: return 'd';
+                case Card::Suit::CLUB: return 'c';
+                case Card::Suit::SPADE: return 's';
+                case Card::Suit::UNKNOWN: break;
+            }
+
+            return '?';
+        }
+
+        auto appendCards(std::string& buffer, std::span<const Card> cards) -> void {
+            buffer += '[';
+
+            for (std::size_t i = 0; i < cards.size(); ++i) {
+                format_to(std::back_inserter(buffer), "{}{:s}{}", i == 0 ? "" : " ", cards[i].getRank(), suitLetter(cards[i].getSuit()));
+            }
+
+            buffer += ']';
+        }
+
+        auto toRoman(int32_t number) -> std::string {
+            static constexpr std::array<std::pair<int32_t, std::string_view>, 7> NUMERALS = {
+                {{50, "L"}, {40, "XL"}, {10, "X"}, {9, "IX"}, {5, "V"}, {4, "IV"}, {1, "I"}}};  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+            std::string roman;
+
+            for (const auto& [value, numeral] : NUMERALS) {
+                for (; value > 0 && number >= value; number -= value) { roman += numeral; }
+            }
+
+            return roman;
+        }
+
+        // Board cards known up to the given street
+        auto boardCardsNumber(Round::Street street) -> std::size_t {
+            switch (street) {
+                case Round::FLOP: return GameHandler::FLOP_CARDS_NUMBER;
+                case Round::TURN: return GameHandler::FLOP_CARDS_NUMBER + 1;
+                case Round::RIVER: return GameHandler::BOARD_CARDS_NUMBER;
+                default: return 0;
+            }
+        }
+    }  // namespace
+
+    PokerStarsExporter::PokerStarsExporter(std::ostream& stream, std::size_t bufferCapacity)
+      : _stream(stream)
+      , _bufferCapacity(bufferCapacity) {
+        _buffer.reserve(bufferCapacity);
+    }
+
+    /**
+     * @brief Write the game ended rounds, the rounds time is the game start time plus the actions elapsed time.
+     */
+    auto PokerStarsExporter::exportGame(const Game& game, uint64_t tournamentId, system_clock::time_point startTime) -> void {
+        int32_t  level      = 0;
+        int32_t  bigBlind   = 0;
+        uint64_t roundIndex = 0;
+        auto     time       = startTime;
+
+        _playersName.clear();
+        _tournamentId = tournamentId;
+        _buyIn        = game.getBuyIn();
+
+        for (int32_t playerNum = 1; playerNum <= game.getPlayersNumber(); ++playerNum) {
+            _playersName.push_back(game.getPlayer(playerNum).getName());
+        }
+
+        game.forEachRound([&](const Round& round) {
+            if (round.isInProgress()) { return; }  // Its players stacks are only recorded when it ends
+
+            if (round.getBlinds().BB() != bigBlind) {
+                bigBlind = round.getBlinds().BB();
+                ++level;
+            }
+
+            _writeRound(round, tournamentId * HAND_NUMBER_BASE + ++roundIndex, level, time);
+
+            for (const auto& streetActions : round.getActions()) {
+                for (const auto& action : streetActions) { time += action.getTime(); }
+            }
+        });
+    }
+
+    auto PokerStarsExporter::flush() -> void {
+        _stream.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+        _stream.flush();
+        _buffer.clear();
+    }
+
+    /**
+     * @brief Export the archive games on the export threads, the tournament id of a game is its file index in the sorted archive
+     * plus one and its start time is the file last write time.
+     */
+    auto PokerStarsExporter::exportArchive(const std::filesystem::path& archiveDirectory,
+                                           const std::filesystem::path& outputDirectory,
+                                           std::size_t                  threadsNumber) -> ExportResult {
+        auto                     paths = listFiles(archiveDirectory, ".json");
+        std::vector<std::size_t> filesRoundsNumber(paths.size());
+        std::vector<std::string> filesError(paths.size());
+
+        std::filesystem::create_directories(outputDirectory);
+
+        parallelFor(paths.size(), std::max<std::size_t>(1, threadsNumber), [&](std::size_t file) {
+            try {
+                auto          game = Game::fromJsonFile(paths[file]);
+                std::ofstream output(outputDirectory / paths[file].filename().replace_extension(".txt"), std::ios::binary);
+
+                if (!output) { throw std::runtime_error("Cannot open the output file"); }
+
+                PokerStarsExporter exporter(output);
+
+                exporter.exportGame(game, file + 1, std::chrono::file_clock::to_sys(std::filesystem::last_write_time(paths[file])));
+                filesRoundsNumber[file] = game.getRoundsNumber();
+            } catch (const std::exception& error) { filesError[file] = format("{}: {}", paths[file].string(), error.what()); }
+        });
+
+        ExportResult result;
+
+        for (std::size_t file = 0; file < paths.size(); ++file) {
+            if (filesError[file].empty()) {
+                ++result.gamesNumber;
+                result.roundsNumber += filesRoundsNumber[file];
+            } else {
+                result.errors.push_back(std::move(filesError[file]));
+            }
+        }
+
+        return result;
+    }
+
+    auto PokerStarsExporter::_writeRound(const Round& round, uint64_t handNumber, int32_t level, system_clock::time_point time) -> void {
+        auto        out           = std::back_inserter(_buffer);
+        auto        playersNumber = static_cast<int32_t>(_playersName.size());
+        auto        name          = [this](int32_t playerNum) -> std::string_view { return _playersName[playerNum - 1]; };
+        auto        day           = floor<days>(time);
+        auto        date          = std::chrono::year_month_day(day);
+        auto        clock         = std::chrono::hh_mm_ss(floor<seconds>(time - day));
+        auto        board         = round.getBoard().getCards();
+        std::size_t boardShown    = 0;
+        int32_t     inHandNumber  = 0;
+
+        std::array<int32_t, MAX_SEATS + 1>       startStack {};
+        std::array<int32_t, MAX_SEATS + 1>       endStack {};
+        std::array<int32_t, MAX_SEATS + 1>       totalBet {};
+        std::array<int32_t, MAX_SEATS + 1>       streetBet {};
+        std::array<Round::Street, MAX_SEATS + 1> foldStreet {};
+        std::array<bool, MAX_SEATS + 1>          folded {};
+
+        for (const auto& recap : round.getPlayersRoundRecap()) {
+            startStack.at(recap.playerNumber) = recap.startStack;
+            endStack.at(recap.playerNumber)   = recap.endStack;
+            inHandNumber                     += recap.startStack > 0 ? 1 : 0;
+        }
+
+        auto dealerNum     = round.getDealerNum();
+        auto smallBlindNum = round.getSeats().getSmallBlindNum();
+        auto bigBlindNum   = round.getSeats().getBigBlindNum();
+
+        auto positionTag = [&](int32_t playerNum) -> std::string_view {
+            if (playerNum == dealerNum) { return " (button)"; }
+            if (playerNum == smallBlindNum) { return " (small blind)"; }
+            if (playerNum == bigBlindNum) { return " (big blind)"; }
+
+            return "";
+        };
+
+        auto post = [&](int32_t playerNum, int32_t amount, std::string_view blind) {
+            amount                 = std::min(amount, startStack.at(playerNum));
+            totalBet.at(playerNum) = streetBet.at(playerNum) = amount;
+
+            format_to(out, "{}: posts {} blind {}\n", name(playerNum), blind, amount);
+        };
+
+        format_to(out,
+                  "PokerStars Hand #{}: Tournament #{}, €{}.{:02}+€0.00 EUR Hold'em No Limit - Level {} ({}/{}) - "
+                  "{}/{:02}/{:02} {:02}:{:02}:{:02} UTC\n",
+                  handNumber,
+                  _tournamentId,
+                  _buyIn / CENTS,
+                  _buyIn % CENTS,
+                  toRoman(level),
+                  round.getBlinds().SB(),
+                  round.getBlinds().BB(),
+                  static_cast<int32_t>(date.year()),
+                  static_cast<uint32_t>(date.month()),
+                  static_cast<uint32_t>(date.day()),
+                  clock.hours().count(),
+                  clock.minutes().count(),
+                  clock.seconds().count());
+        format_to(out, "Table '{} 1' {}-max Seat #{} is the button\n", _tournamentId, playersNumber, dealerNum);
+
+        for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+            if (startStack.at(playerNum) > 0) {
+                format_to(out, "Seat {}: {} ({} in chips)\n", playerNum, name(playerNum), startStack.at(playerNum));
+            }
+        }
+
+        post(smallBlindNum, round.getBlinds().SB(), "small");
+        post(bigBlindNum, round.getBlinds().BB(), "big");
+
+        format_to(out, "*** {} ***\n", STREETS_MARKER.at(Round::PREFLOP));
+
+        if (round.getPlayerHand(1).isSet()) {
+            format_to(out, "Dealt to {} ", name(1));
+            appendCards(_buffer, round.getPlayerHand(1).getCards());
+            _buffer += '\n';
+        }
+
+        for (auto street : {Round::PREFLOP, Round::FLOP, Round::TURN, Round::RIVER}) {
+            auto highestBet = street == Round::PREFLOP ? std::max(streetBet.at(smallBlindNum), streetBet.at(bigBlindNum)) : 0;
+
+            if (street != Round::PREFLOP) {
+                if (inHandNumber < 2 || board.at(boardCardsNumber(street) - 1).isUnknown()) { break; }
+
+                auto previousCards = boardCardsNumber(static_cast<Round::Street>(street - 1));
+
+                streetBet.fill(0);
+                format_to(out, "*** {} *** ", STREETS_MARKER.at(street));
+                appendCards(_buffer, std::span(board).first(std::max(previousCards, boardCardsNumber(Round::FLOP))));
+
+                if (street != Round::FLOP) {
+                    _buffer += ' ';
+                    appendCards(_buffer, std::span(board).subspan(previousCards, 1));
+                }
+
+                _buffer    += '\n';
+                boardShown  = boardCardsNumber(street);
+            }
+
+            for (const auto& action : round.getActions().at(street)) {
+                auto playerNum = action.getPlayerNum();
+
+                switch (action.getAction()) {
+                    case RoundAction::ActionType::CHECK: format_to(out, "{}: checks", name(playerNum)); break;
+                    case RoundAction::ActionType::FOLD:
+                        format_to(out, "{}: folds", name(playerNum));
+                        folded.at(playerNum)     = true;
+                        foldStreet.at(playerNum) = street;
+                        --inHandNumber;
+                        break;
+                    default: {
+                        auto amount = action.getAmount();
+                        auto total  = streetBet.at(playerNum) + amount;
+
+                        if (total <= highestBet) {
+                            format_to(out, "{}: calls {}", name(playerNum), amount);
+                        } else if (highestBet == 0) {
+                            format_to(out, "{}: bets {}", name(playerNum), amount);
+                        } else {
+                            format_to(out, "{}: raises {} to {}", name(playerNum), total - highestBet, total);
+                        }
+
+                        highestBet              = std::max(highestBet, total);
+                        streetBet.at(playerNum) = total;
+                        totalBet.at(playerNum) += amount;
+
+                        if (totalBet.at(playerNum) == startStack.at(playerNum)) { _buffer += " and is all-in"; }
+                    }
+                }
+
+                _buffer += '\n';
+            }
+        }
+        // The part of the highest bet nobody matched goes back to its player
+        int32_t topBettorNum = 1;
+        int32_t secondBet    = 0;
+        int32_t returned     = 0;
+
+        for (int32_t playerNum = 2; playerNum <= playersNumber; ++playerNum) {
+            if (totalBet.at(playerNum) > totalBet.at(topBettorNum)) {
+                secondBet    = totalBet.at(topBettorNum);
+                topBettorNum = playerNum;
+            } else {
+                secondBet = std::max(secondBet, totalBet.at(playerNum));
+            }
+        }
+
+        if (totalBet.at(topBettorNum) > secondBet) {
+            returned = totalBet.at(topBettorNum) - secondBet;
+            format_to(out, "Uncalled bet ({}) returned to {}\n", returned, name(topBettorNum));
+        }
+
+        auto won = [&](int32_t playerNum) {
+            return endStack.at(playerNum) - startStack.at(playerNum) + totalBet.at(playerNum) - (playerNum == topBettorNum ? returned : 0);
+        };
+
+        auto showdown = inHandNumber >= 2;
+
+        if (showdown) {
+            _buffer += "*** SHOW DOWN ***\n";
+
+            for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+                if (startStack.at(playerNum) > 0 && !folded.at(playerNum) && round.getPlayerHand(playerNum).isSet()) {
+                    format_to(out, "{}: shows ", name(playerNum));
+                    appendCards(_buffer, round.getPlayerHand(playerNum).getCards());
+                    _buffer += '\n';
+                }
+            }
+        }
+
+        int32_t totalPot = -returned;
+
+        for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+            totalPot += totalBet.at(playerNum);
+
+            if (startStack.at(playerNum) > 0 && won(playerNum) > 0) { format_to(out, "{} collected {} from pot\n", name(playerNum), won(playerNum)); }
+        }
+
+        format_to(out, "*** SUMMARY ***\nTotal pot {} | Rake 0\n", totalPot);
+
+        if (boardShown > 0) {
+            _buffer += "Board ";
+            appendCards(_buffer, std::span(board).first(boardShown));
+            _buffer += '\n';
+        }
+
+        for (int32_t playerNum = 1; playerNum <= playersNumber; ++playerNum) {
+            if (startStack.at(playerNum) == 0) { continue; }
+
+            format_to(out, "Seat {}: {}{} ", playerNum, name(playerNum), positionTag(playerNum));
+
+            if (folded.at(playerNum)) {
+                if (foldStreet.at(playerNum) == Round::PREFLOP) {
+                    _buffer += "folded before Flop";
+                } else {
+                    format_to(out, "folded on the {}", STREETS_NAME.at(foldStreet.at(playerNum)));
+                }
+            } else if (showdown && round.getPlayerHand(playerNum).isSet()) {
+                _buffer += "showed ";
+                appendCards(_buffer, round.getPlayerHand(playerNum).getCards());
+
+                if (won(playerNum) > 0) {
+                    format_to(out, " and won ({})", won(playerNum));
+                } else {
+                    _buffer += " and lost";
+                }
+            } else if (won(playerNum) > 0) {
+                format_to(out, "collected ({})", won(playerNum));
+            } else {
+                _buffer += "mucked";
+            }
+
+            _buffer += '\n';
+        }
+
+        _buffer += "\n\n";
+
+        _flushIfFull();
+    }
+
+    auto PokerStarsExporter::_flushIfFull() -> void {
+        if (_buffer.size() >= _bufferCapacity) { flush(); }
+    }
+}  // namespace HandHistory
@@ -0,0 +1,441 @@
+#include "hand_history/WinamaxImporter.hpp"
+
+#include <cctype>
+#include <fstream>
+
+#include <game_handler/CardFactory.hpp>
+#include <hand_history/LineTokenizer.hpp>
+#include <hand_history/Batch.hpp>
+
+namespace HandHistory {
+    using fmt::format;
+    using GameHandler::Blinds;
+    using GameHandler::Board;
+    using GameHandler::Card;
+    using GameHandler::Hand;
+    using GameHandler::MAX_SEATS;
+    using GameHandler::Round;
+    using GameHandler::StaticVector;
+    using GameHandler::Factory::card;
+
+    namespace {
+        constexpr std::string_view HAND_HEADER    = "Winamax Poker - ";
+        constexpr std::string_view SUMMARY_MARKER = "*** SUMMARY ***";
+        constexpr int32_t          CENTS_DIGITS   = 2;
+        constexpr int32_t          DECIMAL_BASE   = 10;
+
+        struct SeatLine {
+            public:
+                int32_t          seatNum = 0;
+                std::string_view name;
+                int32_t          stack = 0;
+        };
+
+        struct HandAction {
+            public:
+                enum class Type { CHECK, CALL, BET, RAISE, FOLD };
+
+                Type    type;
+                int32_t seatIndex = 0;
+                int32_t amount    = 0;
+        };
+
+        auto parseAmount(std::string_view text) -> int32_t {
+            auto amount = toInt(text);
+
+            if (!amount) { throw invalid_winamax_hand(format("Invalid amount `{}`", text)); }
+
+            return *amount;
+        }
+
+        // "0.23€" gives 23
+        auto parseCents(std::string_view text) -> int32_t {
+            int32_t cents    = 0;
+            int32_t decimals = -1;
+
+            for (char character : text) {
+                if (character == '.' || character == ',') {
+                    decimals = 0;
+                } else if (std::isdigit(static_cast<unsigned char>(character)) != 0 && decimals < CENTS_DIGITS) {
+                    cents = cents * DECIMAL_BASE + (character - '0');
+
+                    if (decimals >= 0) { ++decimals; }
+                }
+            }
+
+            for (decimals = std::max(decimals, 0); decimals < CENTS_DIGITS; ++decimals) { cents *= DECIMAL_BASE; }
+
+            return cents;
+        }
+
+        // Winamax writes the suit in lower case, `Ah`
+        auto parseCard(std::string_view name) -> Card {
+            if (name.size() != 2) { throw invalid_winamax_hand(format("Invalid card `{}`", name)); }
+
+            return card(std::string {name[0], static_cast<char>(std::toupper(static_cast<unsigned char>(name[1])))});
+        }
+
+        auto parseHand(std::string_view cards) -> Hand {
+            auto firstCard = parseCard(nextToken(cards));
+
+            return {firstCard, parseCard(nextToken(cards))};
+        }
+
+        /**
+         * @brief A hand parsed in place, the views point to the parsed text. It is reused from one hand to the next.
+         */
+        class ParsedHand {
+            public:
+                std::string_view                  handId;
+                std::string_view                  tournamentId;
+                Blinds                            blinds;
+                int32_t                           buyIn      = 0;
+                int32_t                           buttonSeat = 0;
+                int32_t                           heroIndex  = -1;
+                StaticVector<SeatLine, MAX_SEATS> seats;
+                std::array<Hand, MAX_SEATS>       hands;  // By seat index
+                Board::board_t                    board;
+                std::vector<HandAction>           actions;
+
+                auto parse(std::string_view header, LineTokenizer& lines) -> void {
+                    _clear();
+                    _parseHeader(header);
+
+                    std::string_view line;
+                    bool             actionsStarted = false;
+
+                    while (lines.next(line) && line != SUMMARY_MARKER) {
+                        if (line.starts_with("*** ")) {
+                            actionsStarted = actionsStarted || line.starts_with("*** PRE-FLOP");
+                            _parseStreet(line);
+                        } else if (line.starts_with("Table: ")) {
+                            _parseTable(line);
+                        } else if (!actionsStarted && line.starts_with("Seat ")) {
+                            _parseSeat(line);
+                        } else if (line.starts_with("Dealt to ")) {
+                            line.remove_prefix(std::string_view("Dealt to ").size());
+                            heroIndex = _consumeSeat(line);
+
+                            if (heroIndex < 0) { throw invalid_winamax_hand("The hero is not seated"); }
+
+                            hands.at(heroIndex) = parseHand(between(line, '[', ']'));
+                        } else {
+                            _parsePlayerLine(line);
+                        }
+                    }
+
+                    if (heroIndex < 0) { throw invalid_winamax_hand("The hero's cards are missing"); }
+                }
+
+            private:
+                auto _clear() -> void {
+                    seats.clear();
+                    actions.clear();
+                    hands.fill(Hand());
+                    board.fill(Card());
+                    heroIndex  = -1;
+                    buttonSeat = 0;
+                }
+
+                // Winamax Poker - Tournament "Expresso" buyIn: 0.23€ + 0.02€ level: 1 - HandId: #123-1-1680000000 - Holdem no limit (10/20) - ...
+                auto _parseHeader(std::string_view header) -> void {
+                    if (header.find(" - Tournament ") == std::string_view::npos) {
+                        throw invalid_winamax_hand("Only the tournaments hands can be imported");
+                    }
+
+                    auto handIdStart = header.find("HandId: #");
+
+                    if (handIdStart == std::string_view::npos) { throw invalid_winamax_hand("The hand id is missing"); }
+
+                    auto handIdText = header.substr(handIdStart + std::string_view("HandId: #").size());
+
+                    handId       = nextToken(handIdText);
+                    tournamentId = handId.substr(0, handId.find('-'));
+
+                    auto buyInStart = header.find("buyIn: ");
+
+                    buyIn = 0;
+
+                    if (buyInStart != std::string_view::npos) {
+                        auto buyInText = header.substr(buyInStart + std::string_view("buyIn: ").size());
+
+                        buyInText = buyInText.substr(0, buyInText.find(" level"));
+
+                        while (!buyInText.empty()) { buyIn += parseCents(nextToken(buyInText, '+')); }
+                    }
+                    // The blinds are the last two values, `(10/20)` or `(5/10/20)` with the ante first
+                    auto limitStart = header.find(" limit (");
+                    auto blindsText = limitStart == std::string_view::npos ? std::string_view() : between(header.substr(limitStart), '(', ')');
+                    auto bigBlind   = blindsText.substr(blindsText.rfind('/') + 1);
+
+                    blindsText.remove_suffix(std::min(blindsText.size(), bigBlind.size() + 1));
+                    blinds = Blinds(parseAmount(blindsText.substr(blindsText.rfind('/') + 1)), parseAmount(bigBlind));
+                }
+
+                // Table: 'Expresso(123)#0' 3-max (real money) Seat #1 is the button
+                auto _parseTable(std::string_view line) -> void {
+                    auto buttonStart = line.rfind("Seat #");
+
+                    if (buttonStart == std::string_view::npos) { throw invalid_winamax_hand("The button seat is missing"); }
+
+                    line.remove_prefix(buttonStart + std::string_view("Seat #").size());
+                    buttonSeat = parseAmount(nextToken(line));
+                }
+
+                // Seat 1: player name (500) or Seat 1: player name (500, 0.50€ bounty)
+                auto _parseSeat(std::string_view line) -> void {
+                    line.remove_prefix(std::string_view("Seat ").size());
+
+                    auto seatNum    = parseAmount(nextToken(line, ':'));
+                    auto stackStart = line.rfind(" (");
+
+                    if (stackStart == std::string_view::npos) { throw invalid_winamax_hand(format("Invalid seat line `{}`", line)); }
+
+                    auto stackText   = line.substr(stackStart + 2);
+                    auto stackLength = stackText.find_first_of(",)");
+
+                    if (stackLength == std::string_view::npos) { throw invalid_winamax_hand(format("Invalid seat line `{}`", line)); }
+
+                    seats.push_back({seatNum, line.substr(1, stackStart - 1), parseAmount(stackText.substr(0, stackLength))});
+                }
+
+                // *** FLOP *** [2c 5d 9h], *** TURN *** [2c 5d 9h][Jd], *** RIVER *** [2c 5d 9h Jd][3s]
+                auto _parseStreet(std::string_view line) -> void {
+                    auto cardsStart = line.rfind('[');
+
+                    if (cardsStart == std::string_view::npos) { return; }
+
+                    auto cards = line.substr(cardsStart);
+
+                    if (line.starts_with("*** FLOP")) {
+                        cards = between(cards, '[', ']');
+
+                        for (std::size_t i = 0; i < GameHandler::FLOP_CARDS_NUMBER; ++i) { board.at(i) = parseCard(nextToken(cards)); }
+                    } else if (line.starts_with("*** TURN")) {
+                        board[3] = parseCard(between(cards, '[', ']'));
+                    } else if (line.starts_with("*** RIVER")) {
+                        board[4] = parseCard(between(cards, '[', ']'));  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+                    }
+                }
+
+                auto _parsePlayerLine(std::string_view line) -> void {
+                    auto seatIndex = _consumeSeat(line);
+
+                    if (seatIndex < 0) { return; }
+
+                    auto verb = nextToken(line);
+
+                    if (verb == "folds") {
+                        actions.push_back({HandAction::Type::FOLD, seatIndex});
+                    } else if (verb == "checks") {
+                        actions.push_back({HandAction::Type::CHECK, seatIndex});
+                    } else if (verb == "calls") {
+                        actions.push_back({HandAction::Type::CALL, seatIndex, parseAmount(nextToken(line))});
+                    } else if (verb == "bets") {
+                        actions.push_back({HandAction::Type::BET, seatIndex, parseAmount(nextToken(line))});
+                    } else if (verb == "raises") {
+                        std::ignore = nextToken(line);  // The raise amount, the total amount follows `to`
+
+                        if (nextToken(line) != "to") { throw invalid_winamax_hand(format("Invalid raise `{}`", line)); }
+
+                        actions.push_back({HandAction::Type::RAISE, seatIndex, parseAmount(nextToken(line))});
+                    } else if (verb == "posts" && line.starts_with("ante")) {
+                        throw unsupported_winamax_hand("The antes are not supported");
+                    } else if (verb == "shows") {
+                        hands.at(seatIndex) = parseHand(between(line, '[', ']'));
+                    }
+                    // The blinds are paid by the round, the pot collection is computed by the round
+                }
+
+                // Remove the player name from the line start and return its seat index, -1 when the line is not a player one
+                auto _consumeSeat(std::string_view& line) const -> int32_t {
+                    int32_t     seatIndex  = -1;
+                    std::size_t nameLength = 0;
+                    // The longest name matching as a name can be the prefix of another one
+                    for (int32_t i = 0; i < static_cast<int32_t>(seats.size()); ++i) {
+                        const auto& name = seats[i].name;
+
+                        if (name.size() > nameLength && line.size() > name.size() && line[name.size()] == ' ' && line.starts_with(name)) {
+                            seatIndex  = i;
+                            nameLength = name.size();
+                        }
+                    }
+
+                    if (seatIndex >= 0) { line.remove_prefix(nameLength + 1); }
+
+                    return seatIndex;
+                }
+        };
+
+        /**
+         * @brief Build the game of a tournament from its hands.
+         */
+        class GameBuilder {
+            public:
+                [[nodiscard]] auto isBuilding(std::string_view tournamentId) const -> bool {
+                    return !_tournamentId.empty() && _tournamentId == tournamentId;
+                }
+
+                auto start(const ParsedHand& hand) -> void {
+                    std::vector<std::string> names;
+                    // The hero is the player 1, the others follow by seat number
+                    for (std::size_t i = 0; i < hand.seats.size(); ++i) {
+                        names.emplace_back(hand.seats[(static_cast<std::size_t>(hand.heroIndex) + i) % hand.seats.size()].name);
+                    }
+
+                    _game         = Game();
+                    _tournamentId = hand.tournamentId;
+                    _names        = names;
+
+                    _game.setBuyIn(hand.buyIn);
+                    _game.setInitialStack(hand.seats[hand.heroIndex].stack);
+                    _game.init(names);
+                }
+
+                auto addRound(const ParsedHand& hand) -> void {
+                    std::array<int32_t, MAX_SEATS> seatPlayerNum {};
+                    int32_t                        dealerNum = 0;
+
+                    for (auto& player : _game.getPlayers()) {
+                        player.setStack(0);
+                        player.setEliminated(true);
+                    }
+
+                    for (std::size_t i = 0; i < hand.seats.size(); ++i) {
+                        auto  playerNum = _playerNum(hand.seats[i].name);
+                        auto& player    = _game.getPlayers()[playerNum - 1];
+
+                        player.setStack(hand.seats[i].stack);
+                        player.setEliminated(false);
+                        seatPlayerNum.at(i) = playerNum;
+
+                        if (hand.seats[i].seatNum == hand.buttonSeat) { dealerNum = playerNum; }
+                    }
+
+                    if (dealerNum == 0) { throw invalid_winamax_hand(format("The button seat {} is empty", hand.buttonSeat)); }
+
+                    auto& round = _game.newRound(hand.blinds, hand.hands.at(hand.heroIndex), dealerNum);
+
+                    for (std::size_t i = 0; i < hand.seats.size(); ++i) {
+                        if (static_cast<int32_t>(i) != hand.heroIndex) { round.setPlayerHand(hand.hands.at(i), seatPlayerNum.at(i)); }
+                    }
+
+                    round.getBoard().setCards(hand.board);
+
+                    for (const auto& action : hand.actions) {
+                        auto playerNum = seatPlayerNum.at(action.seatIndex);
+
+                        switch (action.type) {
+                            case HandAction::Type::CHECK: round.check(playerNum); break;
+                            case HandAction::Type::CALL: round.call(playerNum); break;
+                            case HandAction::Type::BET: round.bet(playerNum, action.amount); break;
+                            case HandAction::Type::RAISE: round.raiseTo(playerNum, action.amount); break;
+                            case HandAction::Type::FOLD: round.fold(playerNum); break;
+                        }
+                    }
+                    // The last street actions do not end the round when the players are all in
+                    if (round.isInProgress()) { round.showdown(); }
+                }
+
+                auto finish(std::vector<Game>& games) -> void {
+                    if (_tournamentId.empty()) { return; }
+
+                    _game.end();
+                    games.push_back(std::move(_game));
+                    _tournamentId = {};
+                }
+
+            private:
+                Game                     _game;
+                std::string_view         _tournamentId;
+                std::vector<std::string> _names;
+
+                [[nodiscard]] auto _playerNum(std::string_view name) const -> int32_t {
+                    for (std::size_t i = 0; i < _names.size(); ++i) {
+                        if (_names[i] == name) { return static_cast<int32_t>(i) + 1; }
+                    }
+
+                    throw invalid_winamax_hand(format("The player `{}` did not start the tournament at this table", name));
+                }
+        };
+    }  // namespace
+
+    auto WinamaxImporter::parse(std::string_view text, std::vector<std::string>& skippedHands) -> std::vector<Game> {
+        std::vector<Game> games;
+        GameBuilder       builder;
+        ParsedHand        hand;
+        LineTokenizer     lines(text);
+        std::string_view  line;
+
+        while (lines.next(line)) {
+            if (!line.starts_with(HAND_HEADER)) { continue; }
+
+            auto lineNumber = lines.getLineNumber();
+
+            try {
+                hand.parse(line, lines);
+
+                if (!builder.isBuilding(hand.tournamentId)) {
+                    builder.finish(games);
+                    builder.start(hand);
+                }
+
+                builder.addRound(hand);
+            } catch (const unsupported_winamax_hand& error) {
+                skippedHands.push_back(format("Hand at line {}: {}", lineNumber, error.what()));
+            } catch (const std::exception& error) {
+                throw invalid_winamax_hand(format("Hand at line {}: {}", lineNumber, error.what()));
+            }
+        }
+
+        builder.finish(games);
+
+        return games;
+    }
+
+    auto WinamaxImporter::parseFile(const std::filesystem::path& path, std::vector<std::string>& skippedHands) -> std::vector<Game> {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file) { throw std::runtime_error(format("Cannot open the file {}", path.string())); }
+
+        std::string text(std::filesystem::file_size(path), '\0');
+
+        file.read(text.data(), static_cast<std::streamsize>(text.size()));
+
+        return parse(text, skippedHands);
+    }
+
+    auto WinamaxImporter::importFiles(std::span<const std::filesystem::path> paths) const -> ImportResult {
+        std::vector<std::vector<Game>>        filesGames(paths.size());
+        std::vector<std::string>              filesError(paths.size());
+        std::vector<std::vector<std::string>> filesSkippedHands(paths.size());
+
+        parallelFor(paths.size(), _threadsNumber, [&](std::size_t file) {
+            try {
+                filesGames[file] = parseFile(paths[file], filesSkippedHands[file]);
+            } catch (const std::exception& error) { filesError[file] = format("{}: {}", paths[file].string(), error.what()); }
+        });
+
+        ImportResult result;
+
+        for (std::size_t file = 0; file < paths.size(); ++file) {
+            for (auto& game : filesGames[file]) {
+                result.roundsNumber += game.getRoundsNumber();
+                result.games.push_back(std::move(game));
+            }
+
+            for (const auto& skippedHand : filesSkippedHands[file]) {
+                result.skippedHands.push_back(format("{}: {}", paths[file].string(), skippedHand));
+            }
+
+            if (!filesError[file].empty()) { result.errors.push_back(std::move(filesError[file])); }
+        }
+
+        return result;
+    }
+
+    // Import the `.txt` files of the directory and its sub directories, in the paths order
+    auto WinamaxImporter::importDirectory(const std::filesystem::path& directory) const -> ImportResult {
+        return importFiles(listFiles(directory, ".txt"));
+    }
+}  // namespace HandHistory
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <game_handler/CardFactory.hpp>
+#include <game_handler/RoundReplay.hpp>
+#include <hand_history/ActionPattern.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Game;
+using GameHandler::HandHistoryReader;
+using GameHandler::HandHistoryWriter;
+using GameHandler::LoggedAction;
+using GameHandler::RoundLog;
+using GameHandler::RoundReplayer;
+using GameHandler::Factory::card;
+using HandHistory::ActionPattern;
+using HandHistory::invalid_action_pattern;
+
+namespace ActionSymbol = HandHistory::ActionSymbol;
+
+class ActionPatternTest : public ::testing::Test {
+    public:
+        // The hero limps, a villain raises and the hero 3-bets, then the villain check-raises the flop and both check down
+        static auto playGame(Game& game) -> void {
+            game.setInitialStack(10'000);
+            game.init({"hero", "villain 1", "villain 2"});
+
+            auto& round = game.newRound({50, 100}, {card("AH"), card("AS")}, 1);
+
+            round.call(1);
+            round.raiseTo(2, 400);
+            round.fold(3);
+            round.raiseTo(1, 1'200);
+            round.call(2);
+            round.getBoard().setCards({card("KS"), card("7D"), card("2C"), card("9H"), card("4S")});
+            round.check(2);
+            round.bet(1, 1'000);
+            round.raiseTo(2, 3'000);
+            round.call(1);
+            round.check(2);
+            round.check(1);
+            round.check(2);
+            round.check(1);
+            round.setPlayerHand({card("KH"), card("QH")}, 2);
+            round.showdown();
+            game.end();
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(ActionPatternTest, actionsShouldBeEncodedWithTheirStreetContext) {
+    Game game;
+
+    playGame(game);
+
+    auto symbols = ActionPattern::encode(game.getCurrentRound());
+
+    ASSERT_EQ(symbols.size(), 13);
+    EXPECT_EQ(ActionSymbol::kind(symbols[0]), ActionSymbol::CALL);
+    EXPECT_EQ(ActionSymbol::kind(symbols[1]), ActionSymbol::RAISE);
+    EXPECT_EQ(ActionSymbol::kind(symbols[3]), ActionSymbol::THREE_BET);
+    EXPECT_NE(symbols[3] & ActionSymbol::HERO_FLAG, 0);
+    EXPECT_EQ(ActionSymbol::street(symbols[5]), GameHandler::Round::Street::FLOP);
+    EXPECT_EQ(ActionSymbol::kind(symbols[6]), ActionSymbol::BET);
+    EXPECT_EQ(ActionSymbol::kind(symbols[7]), ActionSymbol::RAISE);
+    EXPECT_NE(symbols[7] & ActionSymbol::CHECKED_FLAG, 0);
+    EXPECT_EQ(symbols[7] & ActionSymbol::HERO_FLAG, 0);
+    EXPECT_EQ(ActionSymbol::street(symbols[12]), GameHandler::Round::Street::RIVER);
+}
+
+TEST_F(ActionPatternTest, patternShouldMatchTheStepsInOrder) {
+    Game game;
+
+    playGame(game);
+
+    const auto& round = game.getCurrentRound();
+
+    EXPECT_TRUE(ActionPattern("preflop: villain raise, hero 3-bet; flop: villain check-raise").matches(round));
+    EXPECT_TRUE(ActionPattern("Pre-flop: hero call; flop: hero bet, hero call; river: anyone check, anyone check").matches(round));
+    EXPECT_TRUE(ActionPattern("preflop: villain fold").matches(round));
+    EXPECT_FALSE(ActionPattern("preflop: hero 3-bet, villain raise").matches(round));
+    EXPECT_FALSE(ActionPattern("preflop: villain 3-bet").matches(round));
+    EXPECT_FALSE(ActionPattern("flop: hero check-raise").matches(round));
+    EXPECT_FALSE(ActionPattern("river: anyone bet").matches(round));
+    EXPECT_FALSE(ActionPattern("preflop: anyone all-in").matches(round));
+}
+
+TEST_F(ActionPatternTest, storedRoundsShouldMatchAsTheGameRounds) {
+    auto path = std::filesystem::temp_directory_path() / "hand_history_action_pattern.pthh";
+    Game game;
+
+    playGame(game);
+    HandHistoryWriter::write(game, path);
+
+    {
+        HandHistoryReader reader(path);
+        const auto&       round = game.getCurrentRound();
+        auto              view  = *reader.begin();
+
+        EXPECT_EQ(ActionPattern::encode(view), ActionPattern::encode(round));
+
+        for (const auto* text : {"preflop: villain raise, hero 3-bet; flop: villain check-raise", "flop: hero check-raise"}) {
+            ActionPattern pattern(text);
+
+            EXPECT_EQ(pattern.matches(view), pattern.matches(round)) << text;
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(ActionPatternTest, allInShouldBeFoundFromTheStacks) {
+    RoundLog      log;
+    RoundReplayer replayer;
+
+    log.blinds    = GameHandler::Blinds(50, 100);
+    log.dealerNum = 1;
+    log.stacks    = {1'000, 300, 1'000};
+    log.hands     = {GameHandler::Hand(card("AH"), card("AS")), GameHandler::Hand(card("KH"), card("KS")), GameHandler::Hand()};
+    log.board     = {card("2C"), card("7D"), card("9S"), card("JH"), card("3C")};
+    log.actions   = {{.type = LoggedAction::Type::RAISE_TO, .playerNum = 1, .amount = 250},
+                     {.type = LoggedAction::Type::ALL_IN, .playerNum = 2},
+                     {.type = LoggedAction::Type::FOLD, .playerNum = 3},
+                     {.type = LoggedAction::Type::CALL, .playerNum = 1},
+                     {.type = LoggedAction::Type::SHOWDOWN}};
+
+    const auto& round = replayer.replay(log);
+
+    EXPECT_TRUE(ActionPattern("preflop: villain all-in").matches(round));
+    EXPECT_TRUE(ActionPattern("preflop: hero raise, villain 3-bet, hero call").matches(round));
+    EXPECT_FALSE(ActionPattern("preflop: hero all-in").matches(round));
+}
+
+TEST_F(ActionPatternTest, invalidPatternShouldThrowException) {
+    EXPECT_THROW_WITH_MESSAGE(ActionPattern(""), invalid_action_pattern, "The pattern has no step");
+    EXPECT_THROW_WITH_MESSAGE(ActionPattern("flop villain check"), invalid_action_pattern, "Missing street in `flop villain check`");
+    EXPECT_THROW_WITH_MESSAGE(ActionPattern("showdown: hero fold"), invalid_action_pattern, "Unknown street `showdown`");
+    EXPECT_THROW_WITH_MESSAGE(ActionPattern("flop: villain"), invalid_action_pattern,
+                              "Invalid step `villain`, expected a role and an action");
+    EXPECT_THROW_WITH_MESSAGE(ActionPattern("flop: button bet"), invalid_action_pattern, "Unknown role `button`");
+    EXPECT_THROW_WITH_MESSAGE(ActionPattern("river: villain shove"), invalid_action_pattern, "Unknown action `shove`");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
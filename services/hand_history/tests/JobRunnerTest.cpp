@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+
+#include <game_handler/CardFactory.hpp>
+#include <hand_history/JobRunner.hpp>
+#include <utilities/GtestGames.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Game;
+using GameHandler::HandHistoryReader;
+using GameHandler::HandHistoryWriter;
+using GameHandler::json;
+using GameHandler::RoundView;
+using GameHandler::Factory::card;
+using HandHistory::invalid_checkpoint;
+using HandHistory::JobRunner;
+using HandHistory::workStealingFor;
+
+namespace {
+    // The hero rounds number and chips result by big blind level
+    struct BlindLevelResults {
+        public:
+            std::map<int32_t, std::pair<int64_t, int64_t>> levels;
+
+            auto add(const HandHistoryReader& /*game*/, const RoundView& round) -> void {
+                auto& [rounds, chips] = levels[round.getBlinds().BB()];
+
+                rounds++;
+                chips += round.getEndStack(1) - round.getStartStack(1);
+            }
+
+            auto merge(const BlindLevelResults& other) -> void {
+                for (const auto& [bigBlind, result] : other.levels) {
+                    levels[bigBlind].first  += result.first;
+                    levels[bigBlind].second += result.second;
+                }
+            }
+
+            [[nodiscard]] auto toJson() const -> json { return levels; }
+
+            [[nodiscard]] static auto fromJson(const json& content) -> BlindLevelResults {
+                return {.levels = content.get<decltype(levels)>()};
+            }
+    };
+
+    auto mapBlindLevel(const HandHistoryReader& game, const RoundView& round, BlindLevelResults& results) -> void {
+        results.add(game, round);
+    }
+}  // namespace
+
+class JobRunnerTest : public ::testing::Test {
+    protected:
+        std::filesystem::path directory  = Utilities::Gtest::testTempPath("job_runner");
+        std::filesystem::path checkpoint = Utilities::Gtest::testTempPath("job_runner.json");
+
+        auto SetUp() -> void override {
+            std::filesystem::remove_all(directory);
+            std::filesystem::remove(checkpoint);
+            std::filesystem::create_directories(directory);
+        }
+
+        auto TearDown() -> void override {
+            std::filesystem::remove_all(directory);
+            std::filesystem::remove(checkpoint);
+        }
+
+    public:
+        // A heads-up game of roundsNumber rounds, the big blind doubles every 4 rounds, the hero wins the blinds on the rounds
+        // multiple of 3 and folds its small blind on the others
+        static auto playGame(int32_t roundsNumber) -> Game {
+            return Utilities::Gtest::playLongGame({"hero", "villain"}, roundsNumber, [](Game& game, int32_t roundNum) {
+                auto  bigBlind = 100 << (roundNum / 4);
+                auto& round    = game.newRound({bigBlind / 2, bigBlind}, {card("AH"), card("KH")}, 1);
+
+                if (roundNum % 3 == 0) {
+                    round.raiseTo(1, 3 * bigBlind);
+                    round.fold(2);
+                } else {
+                    round.fold(1);
+                }
+            });
+        }
+
+        static auto expectedResults(std::initializer_list<int32_t> gamesRounds) -> BlindLevelResults {
+            BlindLevelResults results;
+
+            for (auto roundsNumber : gamesRounds) {
+                for (int32_t roundNum = 0; roundNum < roundsNumber; ++roundNum) {
+                    auto  bigBlind        = 100 << (roundNum / 4);
+                    auto& [rounds, chips] = results.levels[bigBlind];
+
+                    rounds++;
+                    chips += roundNum % 3 == 0 ? bigBlind : -bigBlind / 2;
+                }
+            }
+
+            return results;
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(JobRunnerTest, workStealingShouldRunEachTaskOnceAndBalanceASlowBlock) {
+    std::vector<std::atomic<int32_t>> runs(64);
+
+    auto stolen = workStealingFor(runs.size(), 4, [&](std::size_t index, std::size_t /*thread*/) {
+        // The first thread block is slow
+        if (index < 16) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+
+        runs[index]++;
+    });
+
+    for (const auto& run : runs) { EXPECT_EQ(run, 1); }
+
+    EXPECT_GT(stolen, 0);
+    EXPECT_EQ(workStealingFor(0, 4, [](std::size_t, std::size_t) {}), 0);
+}
+
+TEST_F(JobRunnerTest, jobShouldMapEveryRoundOfEveryFile) {
+    HandHistoryWriter::write(playGame(10), directory / "game_1.pthh");
+    HandHistoryWriter::write(playGame(7), directory / "game_2.pthh");
+    HandHistoryWriter::write(playGame(1), directory / "game_3.pthh");
+    std::ofstream(directory / "game_4.pthh") << "not a hand history";
+
+    JobRunner runner(3);
+
+    runner.setShardRounds(3);
+
+    auto result = runner.runDirectory<BlindLevelResults>(directory, mapBlindLevel);
+
+    EXPECT_EQ(result.roundsNumber, 18);
+    EXPECT_EQ(result.shardsNumber, 4 + 3 + 1);
+    EXPECT_EQ(result.resumedShardsNumber, 0);
+    EXPECT_EQ(result.aggregate.levels, expectedResults({10, 7, 1}).levels);
+    ASSERT_EQ(result.errors.size(), 1);
+    EXPECT_TRUE(result.errors[0].starts_with((directory / "game_4.pthh").string()));
+}
+
+TEST_F(JobRunnerTest, jobShouldResumeFromItsCheckpoint) {
+    HandHistoryWriter::write(playGame(12), directory / "game_1.pthh");
+    HandHistoryWriter::write(playGame(9), directory / "game_2.pthh");
+
+    JobRunner runner(2);
+
+    runner.setShardRounds(4);
+    runner.setCheckpoint(checkpoint, 1);
+    // The first run is interrupted on the shards holding a round at the 400 big blind level, the last shard of each file
+    auto interrupted = runner.runDirectory<BlindLevelResults>(directory, [](const auto& game, const auto& round, auto& results) {
+        if (round.getBlinds().BB() == 400) { throw std::runtime_error("Interrupted"); }
+
+        mapBlindLevel(game, round, results);
+    });
+
+    EXPECT_EQ(interrupted.errors.size(), 2);
+    EXPECT_EQ(interrupted.roundsNumber, 21 - 5);
+    EXPECT_TRUE(std::filesystem::exists(checkpoint));
+
+    HandHistoryWriter::write(playGame(3), directory / "game_3.pthh");
+
+    auto resumed = runner.runDirectory<BlindLevelResults>(directory, mapBlindLevel);
+
+    EXPECT_TRUE(resumed.errors.empty());
+    EXPECT_EQ(resumed.shardsNumber, 3 + 3 + 1);
+    EXPECT_EQ(resumed.resumedShardsNumber, 4);
+    EXPECT_EQ(resumed.roundsNumber, 24);
+    EXPECT_EQ(resumed.aggregate.levels, expectedResults({12, 9, 3}).levels);
+
+    runner.setShardRounds(5);
+
+    EXPECT_THROW(static_cast<void>(runner.runDirectory<BlindLevelResults>(directory, mapBlindLevel)), invalid_checkpoint);
+
+    std::ofstream(checkpoint, std::ios::trunc) << "[1, 2";
+
+    EXPECT_THROW_WITH_MESSAGE(static_cast<void>(runner.runDirectory<BlindLevelResults>(directory, mapBlindLevel)),
+                              invalid_checkpoint,
+                              "The file is not a job checkpoint");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <hand_history/LineTokenizer.hpp>
+
+using HandHistory::between;
+using HandHistory::LineTokenizer;
+using HandHistory::nextToken;
+using HandHistory::toInt;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(LineTokenizerTest, linesShouldBeReadWithoutTheirLineEnding) {
+    LineTokenizer    lines("\xEF\xBB\xBF" "first line\r\nsecond line\n\nlast line");
+    std::string_view line;
+
+    ASSERT_TRUE(lines.next(line));
+    EXPECT_EQ(line, "first line");
+    ASSERT_TRUE(lines.next(line));
+    EXPECT_EQ(line, "second line");
+    ASSERT_TRUE(lines.next(line));
+    EXPECT_EQ(line, "");
+    ASSERT_TRUE(lines.next(line));
+    EXPECT_EQ(line, "last line");
+    EXPECT_EQ(lines.getLineNumber(), 4);
+    EXPECT_FALSE(lines.next(line));
+}
+
+TEST(LineTokenizerTest, tokensShouldBeConsumedUpToTheSeparator) {
+    std::string_view text = "raises 20 to 40";
+
+    EXPECT_EQ(nextToken(text), "raises");
+    EXPECT_EQ(nextToken(text), "20");
+    EXPECT_EQ(nextToken(text), "to");
+    EXPECT_EQ(nextToken(text), "40");
+    EXPECT_TRUE(text.empty());
+}
+
+TEST(LineTokenizerTest, textBetweenCharactersShouldBeFound) {
+    EXPECT_EQ(between("Dealt to Hero [Ah Kh]", '[', ']'), "Ah Kh");
+    EXPECT_EQ(between("*** PRE-FLOP ***", '[', ']'), "");
+}
+
+TEST(LineTokenizerTest, integersShouldBeParsedOnlyWhenTheWholeTextIsANumber) {
+    EXPECT_EQ(toInt("1500"), 1500);
+    EXPECT_EQ(toInt("15OO"), std::nullopt);
+    EXPECT_EQ(toInt(""), std::nullopt);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
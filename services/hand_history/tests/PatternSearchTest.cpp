@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+
+#include <game_handler/CardFactory.hpp>
+#include <hand_history/PatternSearch.hpp>
+#include <utilities/GtestGames.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Game;
+using GameHandler::HandHistoryWriter;
+using GameHandler::Factory::card;
+using HandHistory::ActionPattern;
+using HandHistory::PatternMatch;
+using HandHistory::PatternSearch;
+
+class PatternSearchTest : public ::testing::Test {
+    protected:
+        std::filesystem::path directory = Utilities::Gtest::testTempPath("pattern_search");
+
+        auto SetUp() -> void override {
+            std::filesystem::remove_all(directory);
+            std::filesystem::create_directories(directory);
+        }
+
+        auto TearDown() -> void override { std::filesystem::remove_all(directory); }
+
+    public:
+        // A 3 handed game of roundsNumber rounds, the round n is won pre-flop by a villain raise when n % 3 == 0, otherwise the
+        // hero raises, a villain calls then check-raises the flop and the hero folds
+        static auto playGame(int32_t roundsNumber) -> Game {
+            return Utilities::Gtest::playLongGame({"hero", "villain 1", "villain 2"}, roundsNumber, [](Game& game, int32_t roundNum) {
+                // The hero is the dealer, the first to talk pre-flop
+                auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+                if (roundNum % 3 == 0) {
+                    round.fold(1);
+                    round.raiseTo(2, 300);
+                    round.fold(3);
+                } else {
+                    round.raiseTo(1, 300);
+                    round.call(2);
+                    round.fold(3);
+                    round.check(2);
+                    round.bet(1, 300);
+                    round.raiseTo(2, 900);
+                    round.fold(1);
+                }
+            });
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(PatternSearchTest, searchShouldReturnTheMatchingRoundsOfEachFile) {
+    HandHistoryWriter::write(playGame(4), directory / "game_1.pthh");
+    HandHistoryWriter::write(playGame(3), directory / "game_2.pthh");
+    std::ofstream(directory / "game_3.pthh") << "not a hand history";
+
+    auto result = PatternSearch(2).searchDirectory(ActionPattern("preflop: hero raise; flop: villain check-raise"), directory);
+
+    EXPECT_EQ(result.roundsNumber, 7);
+    EXPECT_EQ(result.matches, (std::vector<PatternMatch> {{0, 1}, {0, 2}, {1, 1}, {1, 2}}));
+    ASSERT_EQ(result.errors.size(), 1);
+    EXPECT_TRUE(result.errors[0].starts_with((directory / "game_3.pthh").string()));
+}
+
+TEST_F(PatternSearchTest, gamesSearchShouldFindTheSameRoundsAsTheFilesSearch) {
+    std::vector<Game> games;
+
+    games.push_back(playGame(5));
+    games.push_back(playGame(2));
+
+    HandHistoryWriter::write(games[0], directory / "game_1.pthh");
+    HandHistoryWriter::write(games[1], directory / "game_2.pthh");
+
+    ActionPattern pattern("preflop: hero fold, villain raise");
+    PatternSearch search;
+
+    auto gamesResult = search.searchGames(pattern, games);
+    auto filesResult = search.searchDirectory(pattern, directory);
+
+    EXPECT_EQ(gamesResult.matches, (std::vector<PatternMatch> {{0, 0}, {0, 3}, {1, 0}}));
+    EXPECT_EQ(gamesResult.matches, filesResult.matches);
+    EXPECT_EQ(gamesResult.roundsNumber, filesResult.roundsNumber);
+}
+
+TEST_F(PatternSearchTest, searchThroughputShouldBeRecorded) {
+    static constexpr int32_t ROUNDS_NUMBER = 20'000;
+    static constexpr int32_t FILES_NUMBER  = 10;
+
+    HandHistoryWriter::write(playGame(ROUNDS_NUMBER), directory / "game_0.pthh");
+
+    for (int32_t file = 1; file < FILES_NUMBER; ++file) {
+        std::filesystem::copy_file(directory / "game_0.pthh", directory / fmt::format("game_{}.pthh", file));
+    }
+
+    ActionPattern pattern("preflop: hero raise, villain call; flop: villain check-raise");
+
+    auto start           = std::chrono::steady_clock::now();
+    auto result          = PatternSearch().searchDirectory(pattern, directory);
+    auto elapsed         = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    auto roundsPerSecond = static_cast<double>(result.roundsNumber) / elapsed.count();
+
+    RecordProperty("rounds_per_second", std::to_string(roundsPerSecond));
+
+    EXPECT_EQ(result.roundsNumber, ROUNDS_NUMBER * FILES_NUMBER);
+    EXPECT_EQ(result.matches.size(), (ROUNDS_NUMBER - (ROUNDS_NUMBER + 2) / 3) * FILES_NUMBER);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include <hand_history/PokerStarsExporter.hpp>
+#include <utilities/GtestGames.hpp>
+
+using GameHandler::Game;
+using GameHandler::Factory::card;
+using HandHistory::PokerStarsExporter;
+using std::chrono::system_clock;
+
+class PokerStarsExporterTest : public ::testing::Test {
+    public:
+        // 2023/03/28 10:00:00 UTC
+        static constexpr auto START_TIME = system_clock::time_point(std::chrono::seconds(1679997600));
+
+        // A round won on the flop and an all in round won at the showdown
+        static auto playGame(Game& game) -> void {
+            game.setBuyIn(10);
+            Utilities::Gtest::playFlopBetThenAllInShowdown(game, {"player 1", "player 2", "joueur_3"});
+            game.end();
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(PokerStarsExporterTest, roundWonBeforeTheShowdownShouldBeWritten) {
+    Game               game;
+    std::ostringstream stream;
+
+    playGame(game);
+
+    {
+        PokerStarsExporter exporter(stream);
+
+        exporter.exportGame(game, 42, START_TIME);
+    }
+
+    auto text = stream.str();
+
+    EXPECT_EQ(text.substr(0, text.find("PokerStars Hand #420002")),
+              "PokerStars Hand #420001: Tournament #42, €0.10+€0.00 EUR Hold'em No Limit - Level I (50/100) - 2023/03/28 10:00:00 UTC\n"
+              "Table '42 1' 3-max Seat #1 is the button\n"
+              "Seat 1: player 1 (1000 in chips)\n"
+              "Seat 2: player 2 (1000 in chips)\n"
+              "Seat 3: joueur_3 (1000 in chips)\n"
+              "player 2: posts small blind 50\n"
+              "joueur_3: posts big blind 100\n"
+              "*** HOLE CARDS ***\n"
+              "Dealt to player 1 [Ah Kh]\n"
+              "player 1: raises 200 to 300\n"
+              "player 2: folds\n"
+              "joueur_3: calls 200\n"
+              "*** FLOP *** [2c 5d 9h]\n"
+              "joueur_3: checks\n"
+              "player 1: bets 400\n"
+              "joueur_3: folds\n"
+              "Uncalled bet (400) returned to player 1\n"
+              "player 1 collected 650 from pot\n"
+              "*** SUMMARY ***\n"
+              "Total pot 650 | Rake 0\n"
+              "Board [2c 5d 9h]\n"
+              "Seat 1: player 1 (button) collected (650)\n"
+              "Seat 2: player 2 (small blind) folded before Flop\n"
+              "Seat 3: joueur_3 (big blind) folded on the Flop\n"
+              "\n\n");
+}
+
+TEST_F(PokerStarsExporterTest, allInRoundShouldBeWrittenWithItsShowdown) {
+    Game               game;
+    std::ostringstream stream;
+
+    playGame(game);
+
+    PokerStarsExporter exporter(stream, 1);  // Flushed after each round
+
+    exporter.exportGame(game, 42, START_TIME);
+
+    auto text  = stream.str();
+    auto round = text.substr(text.find("PokerStars Hand #420002"));
+
+    EXPECT_NE(round.find("Level II (100/200)"), std::string::npos);
+    EXPECT_NE(round.find("player 2: raises 750 to 950 and is all-in\n"), std::string::npos);
+    EXPECT_NE(round.find("joueur_3: calls 600 and is all-in\n"), std::string::npos);
+    EXPECT_NE(round.find("player 1: calls 750\n"), std::string::npos);
+    EXPECT_NE(round.find("*** TURN *** [As Ks Kh] [8c]\n*** RIVER *** [As Ks Kh 8c] [7c]\n*** SHOW DOWN ***\n"), std::string::npos);
+    EXPECT_NE(round.find("joueur_3: shows [9s 9h]\n"), std::string::npos);
+    EXPECT_NE(round.find("player 1 collected 2600 from pot\n"), std::string::npos);
+    EXPECT_NE(round.find("Seat 1: player 1 (big blind) showed [Ad Ac] and won (2600)\n"), std::string::npos);
+    EXPECT_NE(round.find("Seat 2: player 2 (button) showed [Ts Th] and lost\n"), std::string::npos);
+    EXPECT_EQ(round.find("Uncalled bet"), std::string::npos);
+}
+
+TEST_F(PokerStarsExporterTest, roundInProgressShouldNotBeWritten) {
+    Game               game;
+    std::ostringstream stream;
+
+    game.setInitialStack(1000);
+    game.init({"player 1", "player 2", "joueur_3"});
+
+    auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+    round.raiseTo(2, 300);
+    round.fold(3);
+    round.fold(1);
+    game.newRound({50, 100}, {card("2C"), card("7D")}, 2);
+
+    {
+        PokerStarsExporter exporter(stream);
+
+        exporter.exportGame(game, 42, START_TIME);
+    }
+
+    auto text = stream.str();
+
+    EXPECT_TRUE(text.starts_with("PokerStars Hand #420001:"));
+    EXPECT_EQ(text.find("PokerStars Hand #420002"), std::string::npos);
+}
+
+TEST_F(PokerStarsExporterTest, archiveShouldBeExportedWithItsErrors) {
+    auto archive = std::filesystem::temp_directory_path() / "poker_stars_exporter_test";
+    Game game;
+
+    playGame(game);
+    std::filesystem::create_directories(archive / "games");
+    std::ofstream(archive / "games" / "broken.json") << "{";
+    std::ofstream(archive / "games" / "game.json") << game.dump();
+
+    auto result = PokerStarsExporter::exportArchive(archive / "games", archive / "export", 2);
+
+    EXPECT_EQ(result.gamesNumber, 1);
+    EXPECT_EQ(result.roundsNumber, 2);
+    ASSERT_EQ(result.errors.size(), 1);
+    EXPECT_TRUE(result.errors[0].starts_with((archive / "games" / "broken.json").string()));
+
+    std::ifstream     exported(archive / "export" / "game.txt");
+    std::stringstream text;
+
+    text << exported.rdbuf();
+
+    EXPECT_TRUE(text.str().starts_with("PokerStars Hand #20001: Tournament #2,"));
+
+    std::filesystem::remove_all(archive);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
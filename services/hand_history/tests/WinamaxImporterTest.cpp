@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <hand_history/WinamaxImporter.hpp>
+#include <utilities/GtestMacros.hpp>
+
+using GameHandler::Game;
+using GameHandler::Round;
+using HandHistory::invalid_winamax_hand;
+using HandHistory::WinamaxImporter;
+
+class WinamaxImporterTest : public ::testing::Test {
+    public:
+        // An Expresso won by the hero in 3 hands
+        static constexpr std::string_view EXPRESSO = R"(Winamax Poker - Tournament "Expresso" buyIn: 0.23€ + 0.02€ level: 1 - HandId: #2497235786867753017-1-1680000000 - Holdem no limit (10/20) - 2023/03/28 10:00:00 UTC
+Table: 'Expresso(2497235786867753017)#0' 3-max (real money) Seat #1 is the button
+Seat 1: Hero (500)
+Seat 2: Villain One (500)
+Seat 3: villain_2 (500)
+*** ANTE/BLINDS ***
+Villain One posts small blind 10
+villain_2 posts big blind 20
+Dealt to Hero [Ah Kh]
+*** PRE-FLOP ***
+Hero raises 20 to 40
+Villain One folds
+villain_2 calls 20
+*** FLOP *** [2c 5d 9h]
+villain_2 checks
+Hero bets 40
+villain_2 folds
+Hero collected 130 from pot
+*** SUMMARY ***
+Total pot 130 | No rake
+Board: [2c 5d 9h]
+Seat 1: Hero (button) won 130
+
+Winamax Poker - Tournament "Expresso" buyIn: 0.23€ + 0.02€ level: 1 - HandId: #2497235786867753017-2-1680000060 - Holdem no limit (10/20) - 2023/03/28 10:01:00 UTC
+Table: 'Expresso(2497235786867753017)#0' 3-max (real money) Seat #2 is the button
+Seat 1: Hero (550)
+Seat 2: Villain One (490)
+Seat 3: villain_2 (460)
+*** ANTE/BLINDS ***
+villain_2 posts small blind 10
+Hero posts big blind 20
+Dealt to Hero [Ad Ac]
+*** PRE-FLOP ***
+Villain One raises 470 to 490 and is all-in
+villain_2 folds
+Hero calls 470
+*** FLOP *** [As Ks Kh]
+*** TURN *** [As Ks Kh][8c]
+*** RIVER *** [As Ks Kh 8c][7c]
+*** SHOW DOWN ***
+Hero shows [Ad Ac] (Full house)
+Villain One shows [Ts Th] (Two pairs)
+Hero collected 990 from pot
+*** SUMMARY ***
+Total pot 990 | No rake
+Board: [As Ks Kh 8c 7c]
+Seat 1: Hero (big blind) showed [Ad Ac] and won 990 with Full house
+
+Winamax Poker - Tournament "Expresso" buyIn: 0.23€ + 0.02€ level: 1 - HandId: #2497235786867753017-3-1680000120 - Holdem no limit (10/20) - 2023/03/28 10:02:00 UTC
+Table: 'Expresso(2497235786867753017)#0' 3-max (real money) Seat #3 is the button
+Seat 1: Hero (1050)
+Seat 3: villain_2 (450)
+*** ANTE/BLINDS ***
+villain_2 posts small blind 10
+Hero posts big blind 20
+Dealt to Hero [Qc Qd]
+*** PRE-FLOP ***
+villain_2 raises 430 to 450 and is all-in
+Hero calls 430
+*** FLOP *** [2s 5d 9h]
+*** TURN *** [2s 5d 9h][Tc]
+*** RIVER *** [2s 5d 9h Tc][3h]
+*** SHOW DOWN ***
+villain_2 shows [Jc Jh] (One pair)
+Hero shows [Qc Qd] (One pair)
+Hero collected 900 from pot
+*** SUMMARY ***
+Total pot 900 | No rake
+)";
+
+        static auto writeFile(const std::filesystem::path& path, std::string_view text) -> std::filesystem::path {
+            std::ofstream(path, std::ios::binary) << text;
+
+            return path;
+        }
+
+        static auto withTournamentId(std::string text, std::string_view tournamentId) -> std::string {
+            static constexpr std::string_view ID = "2497235786867753017";
+
+            for (auto position = text.find(ID); position != std::string::npos; position = text.find(ID, position)) {
+                text.replace(position, ID.size(), tournamentId);
+            }
+
+            return text;
+        }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST_F(WinamaxImporterTest, tournamentShouldBeImportedAsAGame) {
+    std::vector<std::string> skippedHands;
+
+    auto games = WinamaxImporter::parse(EXPRESSO, skippedHands);
+
+    ASSERT_EQ(games.size(), 1);
+    EXPECT_TRUE(skippedHands.empty());
+
+    const auto& game = games.front();
+
+    EXPECT_EQ(game.getPlayersNumber(), 3);
+    EXPECT_EQ(game.getPlayer(1).getName(), "Hero");
+    EXPECT_EQ(game.getPlayer(2).getName(), "Villain One");
+    EXPECT_EQ(game.getPlayer(3).getName(), "villain_2");
+    EXPECT_EQ(game.getBuyIn(), 25);
+    EXPECT_EQ(game.getInitialStack(), 500);
+    EXPECT_EQ(game.getRoundsNumber(), 3);
+    EXPECT_EQ(game.getPlayer(1).getStack(), 1500);
+    EXPECT_TRUE(game.isOver());
+    EXPECT_TRUE(game.isWon());
+
+    std::vector<std::vector<int32_t>> endStacks;
+
+    game.forEachRound([&endStacks](const Round& round) {
+        auto& stacks = endStacks.emplace_back();
+
+        for (const auto& recap : round.getPlayersRoundRecap()) { stacks.push_back(recap.endStack); }
+    });
+
+    EXPECT_EQ(endStacks, std::vector<std::vector<int32_t>>({{550, 490, 460}, {1050, 0, 450}, {1500, 0, 0}}));
+}
+
+TEST_F(WinamaxImporterTest, newTournamentShouldStartANewGame) {
+    std::vector<std::string> skippedHands;
+
+    auto games = WinamaxImporter::parse(fmt::format("{}\n{}", EXPRESSO, withTournamentId(std::string(EXPRESSO), "42")), skippedHands);
+
+    ASSERT_EQ(games.size(), 2);
+    EXPECT_EQ(games[0].getRoundsNumber(), 3);
+    EXPECT_EQ(games[1].getRoundsNumber(), 3);
+}
+
+TEST_F(WinamaxImporterTest, handWithAntesShouldBeSkipped) {
+    auto                     text = std::string(EXPRESSO).insert(EXPRESSO.find("Villain One posts"), "Hero posts ante 5\n");
+    std::vector<std::string> skippedHands;
+
+    auto games = WinamaxImporter::parse(text, skippedHands);
+
+    ASSERT_EQ(games.size(), 1);
+    EXPECT_EQ(games[0].getRoundsNumber(), 2);
+    EXPECT_EQ(games[0].getInitialStack(), 550);
+    EXPECT_EQ(games[0].getPlayer(1).getStack(), 1500);
+    EXPECT_EQ(skippedHands, std::vector<std::string>({"Hand at line 1: The antes are not supported"}));
+}
+
+TEST_F(WinamaxImporterTest, invalidHandShouldThrowException) {
+    auto                     text = std::string(EXPRESSO).replace(EXPRESSO.find("Seat 2: Villain One (500)"), 25, "Seat 2: Villain One");
+    std::vector<std::string> skippedHands;
+
+    EXPECT_THROW_WITH_MESSAGE(std::ignore = WinamaxImporter::parse(text, skippedHands),
+                              invalid_winamax_hand,
+                              "Hand at line 1: Invalid seat line ` Villain One`");
+}
+
+TEST_F(WinamaxImporterTest, filesShouldBeImportedInOrderWithTheirErrors) {
+    auto directory = std::filesystem::temp_directory_path() / "winamax_importer_test";
+
+    std::filesystem::create_directories(directory);
+
+    std::vector<std::filesystem::path> paths = {writeFile(directory / "1.txt", EXPRESSO),
+                                                writeFile(directory / "2.txt", "Winamax Poker - CashGame - HandId: #1-1-1\n"),
+                                                writeFile(directory / "3.txt", withTournamentId(std::string(EXPRESSO), "42"))};
+
+    auto result = WinamaxImporter(2).importFiles(paths);
+
+    ASSERT_EQ(result.games.size(), 2);
+    EXPECT_EQ(result.roundsNumber, 6);
+    ASSERT_EQ(result.errors.size(), 1);
+    EXPECT_EQ(result.errors[0], fmt::format("{}: Hand at line 1: Only the tournaments hands can be imported", paths[1].string()));
+    EXPECT_TRUE(result.skippedHands.empty());
+
+    EXPECT_EQ(WinamaxImporter(4).importDirectory(directory).games.size(), 2);
+
+    std::filesystem::remove_all(directory);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
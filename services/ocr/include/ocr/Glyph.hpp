@@ -0,0 +1,23 @@
+#pragma once
+
+#include <array>
+
+#include <opencv4/opencv2/core.hpp>
+
+/**
+ * @brief Binarized glyphs scaled to a fixed size and packed in bits, compared with a Hamming distance.
+ */
+namespace OCR::Glyph {
+    static constexpr int32_t     WIDTH  = 16;
+    static constexpr int32_t     HEIGHT = 20;
+    static constexpr int32_t     PIXELS = WIDTH * HEIGHT;
+    static constexpr std::size_t WORDS  = (PIXELS + 63) / 64;
+
+    using bits_t = std::array<uint64_t, WORDS>;
+
+    // A single channel mat, 255 on the text pixels and 0 elsewhere, the text being the least present of the two Otsu classes
+    [[nodiscard]] auto binarize(const cv::Mat& image) -> cv::Mat;
+    // The bounds of the binary image scaled to the glyph size and packed
+    [[nodiscard]] auto pack(const cv::Mat& binary, const cv::Rect& bounds) -> bits_t;
+    [[nodiscard]] auto distance(const bits_t& first, const bits_t& second) -> int32_t;
+}  // namespace OCR::Glyph
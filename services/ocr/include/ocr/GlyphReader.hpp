@@ -0,0 +1,68 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <ocr/Glyph.hpp>
+
+namespace OCR {
+    struct GlyphMatch {
+        public:
+            char   symbol     = '\0';
+            double confidence = 0.0;  // The margin to the closest sample of another symbol, between 0 and 1
+    };
+
+    /**
+     * @brief Read a line of text in a fixed font by classifying each of its glyphs against the labelled glyph samples.
+     *
+     * The glyphs are split on the empty columns of the binarized line, they keep their size and position relatively to the
+     * tallest glyph so the symbols only told apart by them like `,` and `-` are not confused. Each glyph is matched against
+     * the samples of a close size and position with a Hamming distance on the packed pixels, the samples of several fonts of
+     * the same room can be mixed.
+     *
+     * The closest sample always wins, so a symbol without sample is read as the symbol it looks the most like: the reader
+     * should only be used once it covers all the symbols of the text it reads.
+     */
+    class GlyphReader {
+        public:
+            static constexpr double MIN_CONFIDENCE = 0.3;
+
+            // Learn the glyphs of the images named by their text, `_dot_`, `_dash_` and `_colon_` stand for `,`, `-` and `:` and the
+            // other `_` for the underscore symbol, none when it is the null character (`1_dot_50_BB.png` reads `1,50BB`,
+            // `15_30.png` with `-` reads `15-30`)
+            auto addSampleImages(const std::filesystem::path& directory, char underscore = '\0') -> int32_t;
+            // False when the image glyphs number is not the text symbols one, the spaces are not glyphs
+            auto addSample(std::string_view text, const cv::Mat& textImage) -> bool;
+
+            // The image name of a text learned by addSampleImages without underscore symbol, `12:45` is named `12_colon_45`
+            [[nodiscard]] static auto sampleName(std::string_view text) -> std::string;
+
+            [[nodiscard]] auto empty() const -> bool { return _samples.empty(); }
+            [[nodiscard]] auto getSamplesNumber() const -> std::size_t { return _samples.size(); }
+            // True when each of the symbols has a sample
+            [[nodiscard]] auto covers(std::string_view symbols) const -> bool;
+
+            // The text of the line, none when a glyph is below the minimum confidence or when there is no glyph
+            [[nodiscard]] auto read(const cv::Mat& textImage, double minConfidence = MIN_CONFIDENCE) const
+                -> std::optional<std::string>;
+
+        private:
+            static constexpr double MIN_SHAPE_RATIO   = 0.7;   // The samples narrower or shorter are not compared to the glyph
+            static constexpr double MAX_MIDDLE_OFFSET = 0.25;  // Nor the samples higher or lower, over the tallest glyph height
+
+            struct Sample {
+                public:
+                    char          symbol = '\0';
+                    Glyph::bits_t bits {};
+                    double        widthRatio   = 0.0;  // The glyph width over the line tallest glyph height
+                    double        heightRatio  = 0.0;  // The glyph height over the line tallest glyph height
+                    double        middleOffset = 0.0;  // The glyph middle height from the tallest glyph one, over its height
+            };
+
+            std::vector<Sample> _samples;
+
+            [[nodiscard]] static auto _segment(const cv::Mat& textImage) -> std::vector<Sample>;
+            [[nodiscard]] auto        _classify(const Sample& glyph) const -> GlyphMatch;
+    };
+}  // namespace OCR
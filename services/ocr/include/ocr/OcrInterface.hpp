@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <utility>
 
 #include <opencv4/opencv2/opencv.hpp>
@@ -7,6 +8,8 @@
 
 #include <game_handler/Card.hpp>
 #include <game_handler/Round.hpp>
+#include <ocr/GlyphReader.hpp>
+#include <ocr/RankClassifier.hpp>
 #include <utilities/Image.hpp>
 
 namespace OCR {
@@ -237,6 +240,8 @@ namespace OCR {
         public:
             static constexpr int32_t     OCR_MIN_CONFIDENCE  = 30;  // @todo confidence between numbers 1 and 7 is really low
             static constexpr int32_t     OCR_RANK_CONFIDENCE = 50;
+            static constexpr double      RANK_MIN_CONFIDENCE = 0.5;  // Below, the rank template match falls back to Tesseract
+            static constexpr const char* NUMBER_SYMBOLS      = "0123456789,-:B";  // The symbols of the numbers read by the OCR
             static constexpr const char* ALL_CHARACTERS      = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_ ";
 
             explicit OcrInterface(int32_t cardWidth);
@@ -282,10 +287,28 @@ namespace OCR {
             [[nodiscard]] virtual auto readFloatNumbers(const cv::Mat& floatNumberImage) const -> double;
             [[nodiscard]] virtual auto readDuration(const cv::Mat& clockImage) const -> seconds;
 
+            // The card ranks are matched against the classifier templates first, a null classifier only uses Tesseract
+            auto setRankClassifier(std::shared_ptr<const RankClassifier> classifier, double minConfidence = RANK_MIN_CONFIDENCE)
+                -> void;
+
+            // The numbers are read from the reader glyph samples first, a null reader only uses Tesseract. The reader must cover
+            // the NUMBER_SYMBOLS, a symbol without sample would be read as another one.
+            auto setNumberReader(std::shared_ptr<const GlyphReader> reader) -> void { _numberReader = std::move(reader); }
+
+            [[nodiscard]] auto getRankClassifier() const -> const RankClassifier* { return _rankClassifier.get(); }
+            [[nodiscard]] auto getNumberReader() const -> const GlyphReader* { return _numberReader.get(); }
+
         protected:
             [[nodiscard]] auto _cardOcr() const -> const cv::Ptr<OCRTesseract>& { return _tesseractCard; }
+            [[nodiscard]] auto _templateRank(const cv::Mat& rankImage) const -> std::optional<Card::Rank>;
+            [[nodiscard]] auto _readNumberText(const cv::Mat& numberImage, const cv::Ptr<OCRTesseract>& tesseract) const
+                -> std::string;
 
         private:
+            std::shared_ptr<const RankClassifier> _rankClassifier;  // Shared by the OCR copies, the templates are read only
+            double                                _rankMinConfidence = RANK_MIN_CONFIDENCE;
+            std::shared_ptr<const GlyphReader>    _numberReader;
+
             cv::Ptr<OCRTesseract> _tesseractCard;
             cv::Ptr<OCRTesseract> _tesseractWord;
             cv::Ptr<OCRTesseract> _tesseractChar;
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <optional>
+
+#include <game_handler/Card.hpp>
+#include <ocr/Glyph.hpp>
+
+namespace OCR {
+    using GameHandler::Card;
+
+    struct RankMatch {
+        public:
+            Card::Rank rank       = Card::Rank::UNDEFINED;
+            double     confidence = 0.0;  // The margin to the second closest rank template, between 0 and 1
+    };
+
+    /**
+     * @brief Recognize a card rank by matching its binarized glyph against one template per rank.
+     *
+     * The rank crop is binarized, cropped to the glyph bounding box and scaled to the templates size, then compared to each rank
+     * template with a Hamming distance on the packed pixels. The templates are the majority vote of the labelled samples of each
+     * rank, a card skin has a fixed font so a few samples per rank are enough.
+     *
+     * The closest template always wins, so a rank without template is read as the rank it looks the most like: the classifier
+     * should only be used once it is complete.
+     */
+    class RankClassifier {
+        public:
+            // Learn the ranks from card images named by their card (`AS.png`, `TD.png`, ...), the unreadable images are skipped
+            auto addCardImages(const std::filesystem::path& directory, const cv::Rect& rankArea) -> int32_t;
+            // Learn the ranks from rank crops named by their rank (`5.png`, `Q.png`, ...), the unreadable images are skipped
+            auto addRankImages(const std::filesystem::path& directory) -> int32_t;
+
+            [[nodiscard]] auto empty() const -> bool { return _templates.empty(); }
+            [[nodiscard]] auto hasRank(Card::Rank rank) const -> bool { return _templates.contains(rank); }
+            // True when every rank has a template
+            [[nodiscard]] auto isComplete() const -> bool { return _templates.size() == RANKS_NUMBER; }
+
+            auto addSample(Card::Rank rank, const cv::Mat& rankImage) -> void;
+
+            // The best matching rank, UNDEFINED with a 0 confidence when there is no template or no glyph in the image
+            [[nodiscard]] auto classify(const cv::Mat& rankImage) const -> RankMatch;
+
+        private:
+            static constexpr std::size_t RANKS_NUMBER = Card::Rank::ACE - Card::Rank::TWO + 1;
+
+            struct RankTemplate {
+                public:
+                    std::array<int32_t, Glyph::PIXELS> votes {};  // The samples count having each pixel set
+                    int32_t                            samples = 0;
+                    Glyph::bits_t                      bits {};
+            };
+
+            std::map<Card::Rank, RankTemplate> _templates;
+
+            auto _addSampleImages(const std::filesystem::path&   directory,
+                                  std::size_t                    nameSize,
+                                  const std::optional<cv::Rect>& rankArea) -> int32_t;
+
+            [[nodiscard]] static auto _glyph(const cv::Mat& rankImage) -> std::optional<Glyph::bits_t>;
+    };
+}  // namespace OCR
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+
+#include <opencv4/opencv2/core.hpp>
+
+namespace OCR {
+    using sampleImageCallback_t = std::function<void(const std::string& name, const cv::Mat& image)>;
+
+    // Call the callback with the file name stem and the image of each PNG image of the directory, the unreadable ones are skipped
+    auto forEachSampleImage(const std::filesystem::path& directory, const sampleImageCallback_t& callback) -> void;
+}  // namespace OCR
@@ -0,0 +1,45 @@
+#include "ocr/Glyph.hpp"
+
+#include <bit>
+
+#include <opencv4/opencv2/imgproc.hpp>
+
+namespace OCR::Glyph {
+    auto binarize(const cv::Mat& image) -> cv::Mat {
+        cv::Mat gray;
+        cv::Mat binary;
+
+        if (image.channels() == 1) {
+            gray = image;
+        } else {
+            cv::cvtColor(image, gray, image.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+        }
+
+        cv::threshold(gray, binary, 0, 255, cv::THRESH_BINARY | cv::THRESH_OTSU);
+        // Light text on a dark background or the opposite, the text covers less than half of the image
+        if (2 * cv::countNonZero(binary) > binary.rows * binary.cols) { cv::bitwise_not(binary, binary); }
+
+        return binary;
+    }
+
+    auto pack(const cv::Mat& binary, const cv::Rect& bounds) -> bits_t {
+        cv::Mat glyph;
+        bits_t  bits {};
+
+        cv::resize(binary(bounds), glyph, {WIDTH, HEIGHT}, 0, 0, cv::INTER_AREA);
+
+        for (int32_t pixel = 0; pixel < PIXELS; ++pixel) {
+            if (glyph.at<uint8_t>(pixel / WIDTH, pixel % WIDTH) > 127) { bits.at(pixel / 64) |= uint64_t(1) << (pixel % 64); }
+        }
+
+        return bits;
+    }
+
+    auto distance(const bits_t& first, const bits_t& second) -> int32_t {
+        int32_t distance = 0;
+
+        for (std::size_t word = 0; word < WORDS; ++word) { distance += std::popcount(first.at(word) ^ second.at(word)); }
+
+        return distance;
+    }
+}  // namespace OCR::Glyph
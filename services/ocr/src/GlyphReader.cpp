@@ -0,0 +1,202 @@
+#include "ocr/GlyphReader.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <ranges>
+
+#include <opencv4/opencv2/imgproc.hpp>
+
+#include <ocr/SampleImages.hpp>
+
+namespace OCR {
+    namespace {
+        // The symbols which cannot be written in a file name
+        using namedSymbol_t = std::pair<std::string_view, char>;
+
+        constexpr std::array<namedSymbol_t, 3> NAMED_SYMBOLS = {{{"_dot_", ','}, {"_dash_", '-'}, {"_colon_", ':'}}};
+
+        // The text written in a sample image name
+        auto sampleText(std::string name, char underscore) -> std::string {
+            std::string text;
+
+            for (const auto& [symbolName, symbol] : NAMED_SYMBOLS) {
+                for (auto position = name.find(symbolName); position != std::string::npos; position = name.find(symbolName)) {
+                    name.replace(position, symbolName.size(), 1, symbol);
+                }
+            }
+
+            for (auto character : name) {
+                if (character != '_') {
+                    text += character;
+                } else if (underscore != '\0') {
+                    text += underscore;
+                }
+            }
+
+            return text;
+        }
+    }  // namespace
+
+    auto GlyphReader::addSampleImages(const std::filesystem::path& directory, char underscore) -> int32_t {
+        int32_t learned = 0;
+
+        forEachSampleImage(directory, [this, underscore, &learned](const std::string& name, const cv::Mat& image) {
+            if (addSample(sampleText(name, underscore), image)) { learned++; }
+        });
+
+        return learned;
+    }
+
+    auto GlyphReader::sampleName(std::string_view text) -> std::string {
+        std::string name;
+
+        for (auto symbol : text) {
+            const auto* named = std::ranges::find(NAMED_SYMBOLS, symbol, &namedSymbol_t::second);
+
+            if (named != NAMED_SYMBOLS.end()) {
+                name += named->first;
+            } else {
+                name += symbol == ' ' ? '_' : symbol;
+            }
+        }
+
+        return name;
+    }
+
+    auto GlyphReader::addSample(std::string_view text, const cv::Mat& textImage) -> bool {
+        auto glyphs  = _segment(textImage);
+        auto symbols = text | std::views::filter([](char symbol) { return symbol != ' '; });
+
+        if (static_cast<std::ptrdiff_t>(glyphs.size()) != std::ranges::distance(symbols)) { return false; }
+
+        auto glyph = glyphs.begin();
+
+        for (auto symbol : symbols) {
+            glyph->symbol = symbol;
+            _samples.push_back(*glyph++);
+        }
+
+        return true;
+    }
+
+    auto GlyphReader::covers(std::string_view symbols) const -> bool {
+        return std::ranges::all_of(symbols, [this](char symbol) {
+            return std::ranges::any_of(_samples, [symbol](const Sample& sample) { return sample.symbol == symbol; });
+        });
+    }
+
+    auto GlyphReader::read(const cv::Mat& textImage, double minConfidence) const -> std::optional<std::string> {
+        if (_samples.empty()) { return std::nullopt; }
+
+        auto        glyphs = _segment(textImage);
+        std::string text;
+
+        if (glyphs.empty()) { return std::nullopt; }
+
+        for (const auto& glyph : glyphs) {
+            auto match = _classify(glyph);
+
+            if (match.confidence < minConfidence) { return std::nullopt; }
+
+            text += match.symbol;
+        }
+
+        return text;
+    }
+
+    /**
+     * @brief Split the line on its empty columns, each glyph is cropped to its own bounds and scaled to the glyph size.
+     *
+     * The glyph size and vertical position are kept relatively to the tallest glyph of the line, so `,`, `-` and `:` are told
+     * apart from the digits they look like once scaled. The column runs with fewer pixels than a 50th of the tallest glyph
+     * height square are noise and skipped.
+     */
+    auto GlyphReader::_segment(const cv::Mat& textImage) -> std::vector<Sample> {
+        std::vector<Sample>   glyphs;
+        std::vector<cv::Rect> bounds;
+
+        if (textImage.empty()) { return glyphs; }
+
+        auto    binary = Glyph::binarize(textImage);
+        auto    line   = cv::boundingRect(binary);
+        cv::Mat columns;
+
+        if (line.area() == 0) { return glyphs; }
+
+        cv::reduce(binary(line), columns, 0, cv::REDUCE_SUM, CV_32S);
+
+        for (int32_t column = 0; column < line.width;) {
+            if (columns.at<int32_t>(0, column) == 0) {
+                column++;
+                continue;
+            }
+
+            int32_t first = column;
+
+            while (column < line.width && columns.at<int32_t>(0, column) != 0) { column++; }
+
+            cv::Rect run(line.x + first, line.y, column - first, line.height);
+            auto     glyph = cv::boundingRect(binary(run));
+
+            bounds.emplace_back(glyph + run.tl());
+        }
+
+        auto tallest   = std::ranges::max(bounds, {}, &cv::Rect::height);
+        auto height    = static_cast<double>(tallest.height);
+        auto middle    = tallest.y + height / 2;
+        auto minPixels = std::max(1, tallest.height * tallest.height / 50);
+
+        for (const auto& glyph : bounds) {
+            if (cv::countNonZero(binary(glyph)) < minPixels) { continue; }
+
+            glyphs.push_back({.bits         = Glyph::pack(binary, glyph),
+                              .widthRatio   = glyph.width / height,
+                              .heightRatio  = glyph.height / height,
+                              .middleOffset = (glyph.y + glyph.height / 2.0 - middle) / height});
+        }
+
+        return glyphs;
+    }
+
+    /**
+     * @brief The closest sample among the ones of a close size and position, the confidence is how much closer the glyph is to
+     * it than to the closest sample of another symbol.
+     *
+     * The size and position only filter the samples, the few pixels they vary by from a line to another would otherwise weigh
+     * as much as the pixels telling apart the look-alike symbols like `8` and `B`. With a single symbol, the second distance is
+     * all the pixels.
+     */
+    auto GlyphReader::_classify(const Sample& glyph) const -> GlyphMatch {
+        GlyphMatch match;
+        int32_t    bestDistance   = Glyph::PIXELS + 1;
+        int32_t    secondDistance = Glyph::PIXELS;  // The closest sample of another symbol than the best one
+
+        auto ratio = [](double first, double second) { return std::min(first, second) / std::max(first, second); };
+
+        for (const auto& sample : _samples) {
+            auto closeShape = ratio(glyph.widthRatio, sample.widthRatio) >= MIN_SHAPE_RATIO
+                           && ratio(glyph.heightRatio, sample.heightRatio) >= MIN_SHAPE_RATIO
+                           && std::abs(glyph.middleOffset - sample.middleOffset) <= MAX_MIDDLE_OFFSET;
+
+            if (!closeShape) { continue; }
+
+            auto distance = Glyph::distance(glyph.bits, sample.bits);
+
+            if (distance < bestDistance) {
+                if (sample.symbol != match.symbol) { secondDistance = std::min(secondDistance, bestDistance); }
+
+                bestDistance = distance;
+                match.symbol = sample.symbol;
+            } else if (distance < secondDistance && sample.symbol != match.symbol) {
+                secondDistance = distance;
+            }
+        }
+
+        if (match.symbol != '\0' && secondDistance > 0) {
+            match.confidence = 1.0 - static_cast<double>(bestDistance) / secondDistance;
+        }
+
+        return match;
+    }
+}  // namespace OCR
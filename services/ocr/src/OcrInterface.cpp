@@ -56,6 +56,44 @@ namespace OCR {
         } catch (const UnknownCardSuitException& e) { throw CannotReadPlayerCardSuitImageException(e, cardImage); }
     }
 
+    auto OcrInterface::setRankClassifier(std::shared_ptr<const RankClassifier> classifier, double minConfidence) -> void {
+        _rankClassifier    = std::move(classifier);
+        _rankMinConfidence = minConfidence;
+    }
+
+    auto OcrInterface::_templateRank(const cv::Mat& rankImage) const -> std::optional<Card::Rank> {
+        if (!_rankClassifier) { return std::nullopt; }
+
+        auto match = _rankClassifier->classify(rankImage);
+
+        if (match.confidence < _rankMinConfidence) { return std::nullopt; }
+
+        return match.rank;
+    }
+
+    /**
+     * @brief The number glyphs read with the number reader, or with the given Tesseract engine when a glyph is not recognized.
+     *
+     * The Tesseract reads are saved as number learning images named by their text, the symbols missing from the number reader
+     * samples are learned from them.
+     */
+    auto OcrInterface::_readNumberText(const cv::Mat& numberImage, const cv::Ptr<OCRTesseract>& tesseract) const -> std::string {
+        if (_numberReader) {
+            if (auto text = _numberReader->read(numberImage)) { return *text; }
+        }
+
+        auto text    = tesseract->run(numberImage, OCR_MIN_CONFIDENCE);
+        auto symbols = text;
+
+        fullTrim(symbols);
+
+        if (!symbols.empty() && symbols.find_first_not_of(NUMBER_SYMBOLS) == std::string::npos) {
+            writeLearningImage(numberImage, LEARNING_DATA_DIR, "number", GlyphReader::sampleName(symbols));
+        }
+
+        return text;
+    }
+
     auto OcrInterface::readHand(const cv::Mat& handImage) const -> Hand {
         cv::Mat firstCardImage  = handImage({0, 0, _cardWidth, handImage.rows});
         cv::Mat secondCardImage = handImage({handImage.cols - _cardWidth, 0, _cardWidth, handImage.rows});
@@ -85,7 +123,7 @@ namespace OCR {
     }
 
     auto OcrInterface::readIntNumbers(const cv::Mat& intNumberImage) const -> int32_t {
-        auto number = _tesseractIntNumbers->run(intNumberImage, OCR_MIN_CONFIDENCE);
+        auto number = _readNumberText(intNumberImage, _tesseractIntNumbers);
 
         fullTrim(number);
 
@@ -93,7 +131,7 @@ namespace OCR {
     }
 
     auto OcrInterface::readIntRange(const cv::Mat& intRangeImage) const -> intRange {
-        auto range = _tesseractIntRange->run(intRangeImage, OCR_MIN_CONFIDENCE);
+        auto range = _readNumberText(intRangeImage, _tesseractIntRange);
 
         fullTrim(range);
 
@@ -105,7 +143,7 @@ namespace OCR {
     }
 
     auto OcrInterface::readFloatNumbers(const cv::Mat& floatNumberImage) const -> double {
-        auto number = _tesseractFloatNumbers->run(floatNumberImage, OCR_MIN_CONFIDENCE);
+        auto number = _readNumberText(floatNumberImage, _tesseractFloatNumbers);
 
         fullTrim(number);
         removeChar(number, 'B');
@@ -115,7 +153,7 @@ namespace OCR {
     }
 
     auto OcrInterface::readDuration(const cv::Mat& clockImage) const -> seconds {
-        auto clock = _tesseractDuration->run(clockImage, OCR_MIN_CONFIDENCE);
+        auto clock = _readNumberText(clockImage, _tesseractDuration);
 
         fullTrim(clock);
 
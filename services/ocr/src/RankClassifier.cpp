@@ -0,0 +1,151 @@
+#include "ocr/RankClassifier.hpp"
+
+#include <algorithm>
+
+#include <opencv4/opencv2/imgproc.hpp>
+
+#include <ocr/SampleImages.hpp>
+
+namespace OCR {
+    using GameHandler::UnknownCardRankException;
+
+    auto RankClassifier::addCardImages(const std::filesystem::path& directory, const cv::Rect& rankArea) -> int32_t {
+        return _addSampleImages(directory, 2, rankArea);
+    }
+
+    auto RankClassifier::addRankImages(const std::filesystem::path& directory) -> int32_t {
+        return _addSampleImages(directory, 1, std::nullopt);
+    }
+
+    /**
+     * @brief Add a labelled rank crop, the rank template pixels are set when most of its samples have them set.
+     */
+    auto RankClassifier::addSample(Card::Rank rank, const cv::Mat& rankImage) -> void {
+        auto glyph = _glyph(rankImage);
+
+        if (!glyph) { return; }
+
+        auto& rankTemplate = _templates[rank];
+
+        rankTemplate.samples++;
+        rankTemplate.bits = {};
+
+        for (int32_t pixel = 0; pixel < Glyph::PIXELS; ++pixel) {
+            auto bit = uint64_t(1) << (pixel % 64);
+
+            if ((glyph->at(pixel / 64) & bit) != 0) { rankTemplate.votes.at(pixel)++; }
+            if (2 * rankTemplate.votes.at(pixel) >= rankTemplate.samples) { rankTemplate.bits.at(pixel / 64) |= bit; }
+        }
+    }
+
+    /**
+     * @brief Compare the glyph to each template, the confidence is how much closer the glyph is to its closest template than to
+     * the second closest one.
+     *
+     * A distance to the best template half the distance to the second best gives a 0.5 confidence, a glyph far from every
+     * template or between two of them gives a confidence near 0. With a single template the second distance is all the pixels.
+     */
+    auto RankClassifier::classify(const cv::Mat& rankImage) const -> RankMatch {
+        auto glyph = _glyph(rankImage);
+
+        if (_templates.empty() || !glyph) { return {}; }
+
+        RankMatch match          = {};
+        int32_t   bestDistance   = Glyph::PIXELS + 1;
+        int32_t   secondDistance = Glyph::PIXELS;
+
+        for (const auto& [rank, rankTemplate] : _templates) {
+            auto distance = Glyph::distance(*glyph, rankTemplate.bits);
+
+            if (distance < bestDistance) {
+                secondDistance = std::min(secondDistance, bestDistance);
+                bestDistance   = distance;
+                match.rank     = rank;
+            } else if (distance < secondDistance) {
+                secondDistance = distance;
+            }
+        }
+
+        match.confidence = secondDistance == 0 ? 0.0 : 1.0 - static_cast<double>(bestDistance) / secondDistance;
+
+        return match;
+    }
+
+    /**
+     * @brief Add the images named by their card or rank, the rank being the first character of the name.
+     *
+     * The card images are cropped to the rank area, the rank crops are taken whole.
+     */
+    auto RankClassifier::_addSampleImages(const std::filesystem::path&   directory,
+                                          std::size_t                    nameSize,
+                                          const std::optional<cv::Rect>& rankArea) -> int32_t {
+        int32_t learned = 0;
+
+        forEachSampleImage(directory, [this, nameSize, &rankArea, &learned](const std::string& name, const cv::Mat& image) {
+            if (name.size() != nameSize || (rankArea && (image.cols < rankArea->br().x || image.rows < rankArea->br().y))) { return; }
+
+            try {
+                addSample(Card::charToRank(name[0]), rankArea ? image(*rankArea) : image);
+                learned++;
+            } catch (const UnknownCardRankException&) { return; }
+        });
+
+        return learned;
+    }
+
+    /**
+     * @brief The packed glyph of the rank crop, none when the image has no glyph.
+     *
+     * The glyph is the dark or colored part of the crop on the light card background, Otsu's threshold adapts to the rank color.
+     * The specks and the parts holding a corner of the crop (the table behind the rounded card corner) are dropped, then the
+     * glyph bounding box is packed, so the match does not depend on the card position in the screenshot.
+     */
+    auto RankClassifier::_glyph(const cv::Mat& rankImage) -> std::optional<Glyph::bits_t> {
+        static constexpr int32_t MIN_PART_AREA = 4;
+
+        if (rankImage.empty()) { return std::nullopt; }
+
+        cv::Mat gray;
+        cv::Mat binary;
+        cv::Mat labels;
+        cv::Mat stats;
+        cv::Mat centroids;
+
+        if (rankImage.channels() == 1) {
+            gray = rankImage;
+        } else {
+            cv::cvtColor(rankImage, gray, rankImage.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+        }
+
+        cv::threshold(gray, binary, 0, 255, cv::THRESH_BINARY_INV | cv::THRESH_OTSU);
+
+        auto partsNumber = cv::connectedComponentsWithStats(binary, labels, stats, centroids, 8, CV_32S);
+        auto cornerParts = {labels.at<int32_t>(0, 0),
+                            labels.at<int32_t>(0, labels.cols - 1),
+                            labels.at<int32_t>(labels.rows - 1, 0),
+                            labels.at<int32_t>(labels.rows - 1, labels.cols - 1)};
+        cv::Rect bounds;
+
+        // Label 0 is the background
+        for (int32_t part = 1; part < partsNumber; ++part) {
+            auto isSpeck  = stats.at<int32_t>(part, cv::CC_STAT_AREA) < MIN_PART_AREA;
+            auto isCorner = std::ranges::find(cornerParts, part) != cornerParts.end();
+
+            if (isSpeck || isCorner) {
+                binary.setTo(0, labels == part);
+                continue;
+            }
+
+            cv::Rect partBounds(stats.at<int32_t>(part, cv::CC_STAT_LEFT),
+                                stats.at<int32_t>(part, cv::CC_STAT_TOP),
+                                stats.at<int32_t>(part, cv::CC_STAT_WIDTH),
+                                stats.at<int32_t>(part, cv::CC_STAT_HEIGHT));
+
+            bounds = bounds.area() == 0 ? partBounds : bounds | partBounds;
+        }
+
+        if (bounds.area() == 0) { return std::nullopt; }
+
+        return Glyph::pack(binary, bounds);
+    }
+}  // namespace OCR
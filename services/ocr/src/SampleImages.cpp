@@ -0,0 +1,19 @@
+#include "ocr/SampleImages.hpp"
+
+#include <opencv4/opencv2/imgcodecs.hpp>
+
+namespace OCR {
+    auto forEachSampleImage(const std::filesystem::path& directory, const sampleImageCallback_t& callback) -> void {
+        if (!std::filesystem::is_directory(directory)) { return; }
+
+        for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+            if (entry.path().extension() != ".png") { continue; }
+
+            auto image = cv::imread(entry.path().string());
+            // Not an image, a git LFS pointer for instance
+            if (image.empty()) { continue; }
+
+            callback(entry.path().stem().string(), image);
+        }
+    }
+}  // namespace OCR
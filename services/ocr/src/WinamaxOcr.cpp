@@ -17,10 +17,64 @@ namespace OCR {
     using enum GameHandler::Card::Suit;
     using enum ActionType;
 
+    namespace {
+        /**
+         * @brief The rank classifier learned from the Winamax cards and ranks samples, none until every rank has a sample.
+         *
+         * The samples are read once for all the OCR instances. The learning data cards are read with the default skin, their
+         * templates do not apply to another skin.
+         */
+        auto winamaxRankClassifier(const cv::Rect& rankArea) -> const std::shared_ptr<const RankClassifier>& {
+            static const auto classifier = [&rankArea]() -> std::shared_ptr<const RankClassifier> {
+                RankClassifier learned;
+
+                learned.addCardImages(std::string(LEARNING_DATA_DIR) + "/images/card", rankArea);
+                learned.addCardImages(std::string(WINAMAX_IMAGES_DIR) + "/cards", rankArea);
+                learned.addRankImages(std::string(WINAMAX_IMAGES_DIR) + "/ranks");
+                // A rank without template would be read as the closest one, so the ranks stay read by Tesseract until they all
+                // have samples
+                if (!learned.isComplete()) { return nullptr; }
+
+                return std::make_shared<const RankClassifier>(std::move(learned));
+            }();
+
+            return classifier;
+        }
+
+        /**
+         * @brief The number reader learned from the Winamax numbers samples, none until every number symbol has a sample.
+         *
+         * The samples are read once for all the OCR instances. The numbers read by Tesseract are added to the learning data
+         * numbers, the symbols missing from the resources samples are covered by them over time.
+         */
+        auto winamaxNumberReader() -> const std::shared_ptr<const GlyphReader>& {
+            static const auto reader = []() -> std::shared_ptr<const GlyphReader> {
+                GlyphReader learned;
+
+                for (const auto* samples : {"average_stack", "bets", "blind_level", "game_duration", "pot", "prize_pool"}) {
+                    learned.addSampleImages(std::string(WINAMAX_IMAGES_DIR) + "/" + samples);
+                }
+
+                learned.addSampleImages(std::string(WINAMAX_IMAGES_DIR) + "/blind_amount", '-');
+                learned.addSampleImages(std::string(LEARNING_DATA_DIR) + "/images/number");
+                // As for the ranks, the numbers stay read by Tesseract until all their symbols have samples
+                if (!learned.covers(OcrInterface::NUMBER_SYMBOLS)) { return nullptr; }
+
+                return std::make_shared<const GlyphReader>(std::move(learned));
+            }();
+
+            return reader;
+        }
+    }  // namespace
+
     WinamaxOcr::WinamaxOcr()
       : _cardsSkin(cv::imread(std::string(WINAMAX_IMAGES_DIR) + "/cards_skins/" + DEFAULT_CARD_SKIN))
       , _buttonImg(getButtonImg())
-      , OcrInterface(CARD_WIDTH) {}
+      , OcrInterface(CARD_WIDTH) {
+        setRankClassifier(winamaxRankClassifier(getRankCardArea()));
+
+        setNumberReader(winamaxNumberReader());
+    }
 
     WinamaxOcr::WinamaxOcr(WinamaxOcr&& other) noexcept
       : OcrInterface(std::move(other)) {
@@ -73,6 +127,8 @@ namespace OCR {
     }
 
     auto WinamaxOcr::readCardRank(const cv::Mat& rankImage) const -> Card::Rank {
+        if (auto rank = _templateRank(rankImage)) { return *rank; }
+
         auto rank = _cardOcr()->run(rankImage, OCR_RANK_CONFIDENCE);
 
         return Card::charToRank(rank[0]);
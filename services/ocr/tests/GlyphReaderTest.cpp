@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <opencv4/opencv2/imgcodecs.hpp>
+#include <opencv4/opencv2/imgproc.hpp>
+
+#include <ocr/GlyphReader.hpp>
+#include <ocr/OcrInterface.hpp>
+
+using OCR::GlyphReader;
+using OCR::OcrInterface;
+
+namespace {
+    // A text line in a fixed font, the text color and its background are swapped when inverted
+    auto textImage(const std::string& text, const cv::Point& origin = {4, 30}, bool inverted = false) -> cv::Mat {
+        auto    background = inverted ? cv::Scalar(40, 30, 30) : cv::Scalar(255, 255, 255);
+        auto    color      = inverted ? cv::Scalar(60, 220, 240) : cv::Scalar(0, 0, 0);
+        cv::Mat image(42, 28 * static_cast<int32_t>(text.size()) + 12, CV_8UC3, background);
+
+        cv::putText(image, text, origin, cv::FONT_HERSHEY_SIMPLEX, 1.0, color, 2, cv::LINE_8);
+
+        return image;
+    }
+
+    auto digitsReader() -> GlyphReader {
+        GlyphReader reader;
+
+        EXPECT_TRUE(reader.addSample("0123456789", textImage("0123456789")));
+        EXPECT_TRUE(reader.addSample("1,50 BB", textImage("1,50 BB")));
+        EXPECT_TRUE(reader.addSample("15-30", textImage("15-30")));
+        EXPECT_TRUE(reader.addSample("12:45", textImage("12:45")));
+
+        return reader;
+    }
+}  // namespace
+
+class GlyphReaderTest : public ::testing::Test {};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(GlyphReaderTest, readShouldParseTheNumbersVariants) {
+    auto reader = digitsReader();
+
+    EXPECT_EQ(reader.read(textImage("9870")), "9870");
+    EXPECT_EQ(reader.read(textImage("0,75 BB")), "0,75BB");
+    EXPECT_EQ(reader.read(textImage("250-500")), "250-500");
+    EXPECT_EQ(reader.read(textImage("08:16")), "08:16");
+}
+
+TEST(GlyphReaderTest, readShouldTellTheLookAlikeSymbolsApart) {
+    auto reader = digitsReader();
+
+    EXPECT_EQ(reader.read(textImage("8 BB")), "8BB");
+    EXPECT_EQ(reader.read(textImage("180")), "180");
+}
+
+TEST(GlyphReaderTest, readShouldNotDependOnTheTextPositionOrColors) {
+    auto reader = digitsReader();
+
+    EXPECT_EQ(reader.read(textImage("6420", {10, 34})), "6420");
+    EXPECT_EQ(reader.read(textImage("3,25 BB", {2, 28}, true)), "3,25BB");
+}
+
+TEST(GlyphReaderTest, readShouldGiveNothingOnUnknownGlyphs) {
+    auto    reader = digitsReader();
+    cv::Mat blank(42, 80, CV_8UC3, cv::Scalar(255, 255, 255));
+
+    EXPECT_EQ(reader.read(textImage("1X0")), std::nullopt);
+    EXPECT_EQ(reader.read(blank), std::nullopt);
+    EXPECT_EQ(GlyphReader().read(textImage("10")), std::nullopt);
+}
+
+TEST(GlyphReaderTest, readerShouldOnlyCoverTheSymbolsWithSamples) {
+    GlyphReader reader;
+
+    reader.addSample("0123456789", textImage("0123456789"));
+    reader.addSample("1,50 BB", textImage("1,50 BB"));
+    reader.addSample("15-30", textImage("15-30"));
+
+    EXPECT_TRUE(reader.covers("0,5-B"));
+    EXPECT_FALSE(reader.covers(OcrInterface::NUMBER_SYMBOLS));
+    EXPECT_TRUE(digitsReader().covers(OcrInterface::NUMBER_SYMBOLS));
+}
+
+TEST(GlyphReaderTest, samplesShouldBeLearnedFromTheImagesName) {
+    auto        directory = std::filesystem::temp_directory_path() / "ocr_glyph_reader";
+    GlyphReader reader;
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    cv::imwrite((directory / "1_dot_50_BB.png").string(), textImage("1,50 BB"));
+    cv::imwrite((directory / "15_30.png").string(), textImage("15-30"));
+    cv::imwrite((directory / "2468.png").string(), textImage("246"));  // Mislabelled, one glyph is missing
+
+    EXPECT_EQ(reader.addSampleImages(directory, '-'), 2);
+    EXPECT_EQ(reader.getSamplesNumber(), 6 + 5);
+    EXPECT_EQ(reader.read(textImage("5,10 BB")), "5,10BB");
+    EXPECT_FALSE(reader.addSample("12", textImage("123")));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(GlyphReaderTest, samplesNamedFromTheirTextShouldCoverTheNumberSymbols) {
+    auto        directory = std::filesystem::temp_directory_path() / "ocr_glyph_reader_names";
+    GlyphReader reader;
+
+    EXPECT_EQ(GlyphReader::sampleName("12:45"), "12_colon_45");
+    EXPECT_EQ(GlyphReader::sampleName("1,50 BB"), "1_dot_50_BB");
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    for (const auto* text : {"0123456789", "1,50 BB", "15-30", "12:45"}) {
+        cv::imwrite((directory / (GlyphReader::sampleName(text) + ".png")).string(), textImage(text));
+    }
+
+    EXPECT_EQ(reader.addSampleImages(directory), 4);
+    EXPECT_TRUE(reader.covers(OcrInterface::NUMBER_SYMBOLS));
+    EXPECT_EQ(reader.read(textImage("08:16")), "08:16");
+    EXPECT_EQ(reader.read(textImage("250-500")), "250-500");
+
+    std::filesystem::remove_all(directory);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <opencv4/opencv2/imgcodecs.hpp>
+#include <opencv4/opencv2/imgproc.hpp>
+
+#include <ocr/RankClassifier.hpp>
+#include <ocr/WinamaxOcr.hpp>
+
+using GameHandler::Card;
+using OCR::RankClassifier;
+using OCR::WinamaxOcr;
+
+using enum GameHandler::Card::Rank;
+
+namespace {
+    constexpr std::string_view RANKS = "23456789TJQKA";
+
+    // A rank crop drawn on a white card, the glyph is offset by the given shift
+    auto rankImage(char rank, const cv::Scalar& color, const cv::Point& shift = {0, 0}) -> cv::Mat {
+        cv::Mat image(46, 40, CV_8UC3, cv::Scalar(255, 255, 255));
+
+        cv::putText(image, std::string(1, rank), cv::Point(8, 36) + shift, cv::FONT_HERSHEY_SIMPLEX, 1.0, color, 2, cv::LINE_8);
+
+        return image;
+    }
+
+    auto syntheticClassifier() -> RankClassifier {
+        RankClassifier classifier;
+
+        for (auto rank : RANKS) {
+            classifier.addSample(Card::charToRank(rank), rankImage(rank, {0, 0, 0}));
+            classifier.addSample(Card::charToRank(rank), rankImage(rank, {0, 0, 200}, {2, -1}));
+        }
+
+        return classifier;
+    }
+}  // namespace
+
+class RankClassifierTest : public ::testing::Test {};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+TEST(RankClassifierTest, classifyShouldMatchEachRankTemplate) {
+    auto classifier = syntheticClassifier();
+
+    for (auto rank : RANKS) {
+        // Another color and position than the samples
+        auto match = classifier.classify(rankImage(rank, {180, 60, 0}, {-3, 2}));
+
+        EXPECT_EQ(match.rank, Card::charToRank(rank)) << rank;
+        EXPECT_GT(match.confidence, WinamaxOcr::RANK_MIN_CONFIDENCE) << rank;
+    }
+}
+
+TEST(RankClassifierTest, classifyShouldGiveNoConfidenceWithoutGlyphOrTemplate) {
+    auto    classifier = syntheticClassifier();
+    cv::Mat blank(46, 40, CV_8UC3, cv::Scalar(255, 255, 255));
+
+    EXPECT_EQ(classifier.classify(blank).rank, UNDEFINED);
+    EXPECT_EQ(classifier.classify(blank).confidence, 0.0);
+    EXPECT_EQ(RankClassifier().classify(rankImage('A', {0, 0, 0})).rank, UNDEFINED);
+    EXPECT_TRUE(RankClassifier().empty());
+}
+
+TEST(RankClassifierTest, unknownGlyphShouldHaveALowConfidence) {
+    RankClassifier classifier;
+
+    classifier.addSample(ACE, rankImage('A', {0, 0, 0}));
+    classifier.addSample(KING, rankImage('K', {0, 0, 0}));
+
+    EXPECT_LT(classifier.classify(rankImage('7', {0, 0, 0})).confidence, WinamaxOcr::RANK_MIN_CONFIDENCE);
+}
+
+TEST(RankClassifierTest, glyphMatchingTwoTemplatesShouldHaveNoConfidence) {
+    RankClassifier classifier;
+
+    classifier.addSample(ACE, rankImage('A', {0, 0, 0}));
+    classifier.addSample(KING, rankImage('A', {0, 0, 0}));
+
+    EXPECT_EQ(classifier.classify(rankImage('A', {0, 0, 0})).confidence, 0.0);
+}
+
+TEST(RankClassifierTest, classifierShouldOnlyBeCompleteWithEveryRank) {
+    RankClassifier classifier;
+
+    for (auto rank : RANKS.substr(1)) { classifier.addSample(Card::charToRank(rank), rankImage(rank, {0, 0, 0})); }
+
+    EXPECT_FALSE(classifier.hasRank(TWO));
+    EXPECT_FALSE(classifier.isComplete());
+
+    classifier.addSample(TWO, rankImage('2', {0, 0, 0}));
+
+    EXPECT_TRUE(classifier.isComplete());
+}
+
+TEST(RankClassifierTest, winamaxSamplesShouldReadTheWinamaxRanks) {
+    RankClassifier classifier;
+    auto           rankArea = WinamaxOcr().getRankCardArea();
+
+    classifier.addCardImages(std::string(LEARNING_DATA_DIR) + "/images/card", rankArea);
+    classifier.addCardImages(std::string(WINAMAX_IMAGES_DIR) + "/cards", rankArea);
+
+    auto allSamples = classifier;
+
+    allSamples.addRankImages(std::string(WINAMAX_IMAGES_DIR) + "/ranks");
+    // The missing ranks would be read as the closest learned ones
+    EXPECT_EQ(WinamaxOcr().getRankClassifier() != nullptr, allSamples.isComplete());
+
+    if (classifier.empty()) { GTEST_SKIP() << "The Winamax card images are not checked out"; }
+    // The rank crops are not learned by this classifier, they are read from the cards templates
+    for (auto [rank, file] : {std::pair {TWO, "2"}, {FOUR, "4"}, {EIGHT, "8"}, {QUEEN, "Q"}, {KING, "K"}}) {
+        auto match = classifier.classify(cv::imread(std::string(WINAMAX_IMAGES_DIR) + "/ranks/" + file + ".png"));
+
+        EXPECT_EQ(match.rank, rank) << file;
+    }
+}
+
+TEST(RankClassifierTest, rankImagesShouldBeLearnedByTheirName) {
+    auto           directory = std::filesystem::temp_directory_path() / "ocr_rank_classifier";
+    RankClassifier classifier;
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    cv::imwrite((directory / "7.png").string(), rankImage('7', {0, 0, 0}));
+    cv::imwrite((directory / "K.png").string(), rankImage('K', {0, 0, 0}));
+    cv::imwrite((directory / "KC.png").string(), rankImage('K', {0, 0, 0}));  // A card name, not a rank one
+
+    EXPECT_EQ(classifier.addRankImages(directory), 2);
+    EXPECT_TRUE(classifier.hasRank(SEVEN));
+    EXPECT_EQ(classifier.classify(rankImage('7', {0, 0, 200}, {2, -1})).rank, SEVEN);
+
+    std::filesystem::remove_all(directory);
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -3,11 +3,13 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <opencv4/opencv2/opencv.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include <game_handler/JsonWriter.hpp>
 #include <logger/Logger.hpp>
 
 #ifdef _WIN32
@@ -22,11 +24,24 @@
 
 #endif
 namespace Scraper {
+    using GameHandler::JsonWriter;
+
     using json         = nlohmann::json;
     using windowSize_t = cv::Size_<int32_t>;
 
     static constexpr std::string_view MODEL_PATH_FORMAT = "{dir}/models/{size}x8.json";
 
+    // Coordinates of a seat elements, the hero (player 1) has no cards nor hand displayed
+    struct PlayerCoords {
+            cv::Rect action;
+            cv::Rect bet;
+            cv::Rect button;
+            cv::Rect cards;
+            cv::Rect hand;
+            cv::Rect name;
+            cv::Rect stack;
+    };
+
     struct WindowInfo {
             std::string title;
             uint64_t    id;
@@ -71,28 +86,10 @@ namespace Scraper {
             auto getBoardCard5Coord() const -> const cv::Rect& { return _boardCard5Coord; }
             auto getFirstCardCoord() const -> const cv::Rect& { return _firstCardCoord; }
             auto getSecondCardCoord() const -> const cv::Rect& { return _secondCardCoord; }
-            auto getPlayer1ActionCoord() const -> const cv::Rect& { return _player1ActionCoord; }
-            auto getPlayer1BetCoord() const -> const cv::Rect& { return _player1BetCoord; }
-            auto getPlayer1ButtonCoord() const -> const cv::Rect& { return _player1ButtonCoord; }
-            auto getPlayer1NameCoord() const -> const cv::Rect& { return _player1NameCoord; }
-            auto getPlayer1StackCoord() const -> const cv::Rect& { return _player1StackCoord; }
-            auto getPlayer2ActionCoord() const -> const cv::Rect& { return _player2ActionCoord; }
-            auto getPlayer2BetCoord() const -> const cv::Rect& { return _player2BetCoord; }
-            auto getPlayer2ButtonCoord() const -> const cv::Rect& { return _player2ButtonCoord; }
-            auto getPlayer2CardsCoord() const -> const cv::Rect& { return _player2CardsCoord; }
-            auto getPlayer2HandCoord() const -> const cv::Rect& { return _player2HandCoord; }
-            auto getPlayer2NameCoord() const -> const cv::Rect& { return _player2NameCoord; }
-            auto getPlayer2StackCoord() const -> const cv::Rect& { return _player2StackCoord; }
-            auto getPlayer3ActionCoord() const -> const cv::Rect& { return _player3ActionCoord; }
-            auto getPlayer3BetCoord() const -> const cv::Rect& { return _player3BetCoord; }
-            auto getPlayer3ButtonCoord() const -> const cv::Rect& { return _player3ButtonCoord; }
-            auto getPlayer3CardsCoord() const -> const cv::Rect& { return _player3CardsCoord; }
-            auto getPlayer3HandCoord() const -> const cv::Rect& { return _player3HandCoord; }
-            auto getPlayer3NameCoord() const -> const cv::Rect& { return _player3NameCoord; }
-            auto getPlayer3StackCoord() const -> const cv::Rect& { return _player3StackCoord; }
             auto getPotCoord() const -> const cv::Rect& { return _potCoord; }
             auto getPrizePoolCoord() const -> const cv::Rect& { return _prizePoolCoord; }
             auto getRoomName() const -> const std::string& { return _roomName; }
+            auto getSeatsNumber() const -> int32_t { return static_cast<int32_t>(_playersCoords.size()); }
             auto getWindowSize() const -> const windowSize_t& { return _windowSize; }
 
             void setAverageStackCoord(const cv::Rect& imgROI) { _averageStackCoord = imgROI; }
@@ -106,32 +103,20 @@ namespace Scraper {
             void setBoardCard5Coord(const cv::Rect& imgROI) { _boardCard5Coord = imgROI; }
             void setFirstCardCoord(const cv::Rect& imgROI) { _firstCardCoord = imgROI; }
             void setSecondCardCoord(const cv::Rect& imgROI) { _secondCardCoord = imgROI; }
-            void setPlayer1ActionCoord(const cv::Rect& imgROI) { _player1ActionCoord = imgROI; }
-            void setPlayer1BetCoord(const cv::Rect& imgROI) { _player1BetCoord = imgROI; }
-            void setPlayer1ButtonCoord(const cv::Rect& imgROI) { _player1ButtonCoord = imgROI; }
-            void setPlayer1NameCoord(const cv::Rect& imgROI) { _player1NameCoord = imgROI; }
-            void setPlayer1StackCoord(const cv::Rect& imgROI) { _player1StackCoord = imgROI; }
-            void setPlayer2ActionCoord(const cv::Rect& imgROI) { _player2ActionCoord = imgROI; }
-            void setPlayer2BetCoord(const cv::Rect& imgROI) { _player2BetCoord = imgROI; }
-            void setPlayer2ButtonCoord(const cv::Rect& imgROI) { _player2ButtonCoord = imgROI; }
-            void setPlayer2CardsCoord(const cv::Rect& imgROI) { _player2CardsCoord = imgROI; }
-            void setPlayer2HandCoord(const cv::Rect& imgROI) { _player2HandCoord = imgROI; }
-            void setPlayer2NameCoord(const cv::Rect& imgROI) { _player2NameCoord = imgROI; }
-            void setPlayer2StackCoord(const cv::Rect& imgROI) { _player2StackCoord = imgROI; }
-            void setPlayer3ActionCoord(const cv::Rect& imgROI) { _player3ActionCoord = imgROI; }
-            void setPlayer3BetCoord(const cv::Rect& imgROI) { _player3BetCoord = imgROI; }
-            void setPlayer3ButtonCoord(const cv::Rect& imgROI) { _player3ButtonCoord = imgROI; }
-            void setPlayer3CardsCoord(const cv::Rect& imgROI) { _player3CardsCoord = imgROI; }
-            void setPlayer3HandCoord(const cv::Rect& imgROI) { _player3HandCoord = imgROI; }
-            void setPlayer3NameCoord(const cv::Rect& imgROI) { _player3NameCoord = imgROI; }
-            void setPlayer3StackCoord(const cv::Rect& imgROI) { _player3StackCoord = imgROI; }
             void setPotCoord(const cv::Rect& imgROI) { _potCoord = imgROI; }
             void setPrizePoolCoord(const cv::Rect& imgROI) { _prizePoolCoord = imgROI; }
+            void setPlayerActionCoord(int32_t playerNum, const cv::Rect& imgROI) { _getPlayerCoords(playerNum).action = imgROI; }
+            void setPlayerBetCoord(int32_t playerNum, const cv::Rect& imgROI) { _getPlayerCoords(playerNum).bet = imgROI; }
+            void setPlayerButtonCoord(int32_t playerNum, const cv::Rect& imgROI) { _getPlayerCoords(playerNum).button = imgROI; }
+            void setPlayerCardsCoord(int32_t playerNum, const cv::Rect& imgROI) { _getVillainCoords(playerNum).cards = imgROI; }
+            void setPlayerHandCoord(int32_t playerNum, const cv::Rect& imgROI) { _getVillainCoords(playerNum).hand = imgROI; }
+            void setPlayerNameCoord(int32_t playerNum, const cv::Rect& imgROI) { _getPlayerCoords(playerNum).name = imgROI; }
+            void setPlayerStackCoord(int32_t playerNum, const cv::Rect& imgROI) { _getPlayerCoords(playerNum).stack = imgROI; }
             void setRoomName(const std::string& roomName) { _roomName = roomName; }
             void setWindowSize(const windowSize_t& windowSize) { _windowSize = windowSize; }
 
             /**
-             *              Players positions on the table
+             *              Players positions on the table (3 seats), the numbers go clockwise from the hero
              *
              *          Player 2  __________________  Player 3
              *                   |                  |
@@ -150,39 +135,24 @@ namespace Scraper {
             auto getBoardCard3Img(const cv::Mat& img) const -> const cv::Mat { return img(getBoardCard3Coord()); };
             auto getBoardCard4Img(const cv::Mat& img) const -> const cv::Mat { return img(getBoardCard4Coord()); };
             auto getBoardCard5Img(const cv::Mat& img) const -> const cv::Mat { return img(getBoardCard5Coord()); };
-            auto getPlayer1ActionImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer1ActionCoord()); };
-            auto getPlayer1BetImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer1BetCoord()); };
-            auto getPlayer1ButtonImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer1ButtonCoord()); };
-            auto getPlayer1NameImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer1NameCoord()); };
-            auto getPlayer1StackImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer1StackCoord()); };
-            auto getPlayer2ActionImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer2ActionCoord()); };
-            auto getPlayer2BetImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer2BetCoord()); };
-            auto getPlayer2ButtonImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer2ButtonCoord()); };
-            auto getPlayer2CardsImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer2HandCoord()); };
-            auto getPlayer2NameImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer2NameCoord()); };
-            auto getPlayer2StackImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer2StackCoord()); };
-            auto getPlayer3ActionImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer3ActionCoord()); };
-            auto getPlayer3BetImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer3BetCoord()); };
-            auto getPlayer3ButtonImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer3ButtonCoord()); };
-            auto getPlayer3CardsImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer3HandCoord()); };
-            auto getPlayer3NameImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer3NameCoord()); };
-            auto getPlayer3StackImg(const cv::Mat& img) const -> const cv::Mat { return img(getPlayer3StackCoord()); };
             auto getPotImg(const cv::Mat& img) const -> const cv::Mat { return img(getPotCoord()); };
             auto getPrizePoolImg(const cv::Mat& img) const -> const cv::Mat { return img(getPrizePoolCoord()); };
 
             // Convenient methods to get coordinates with a player number
-            auto getPlayerActionCoord(int32_t playerNum) const -> const cv::Rect&;
-            auto getPlayerBetCoord(int32_t playerNum) const -> const cv::Rect&;
-            auto getPlayerButtonCoord(int32_t playerNum) const -> const cv::Rect&;
-            auto getPlayerCardsCoord(int32_t playerNum) const -> const cv::Rect&;
-            auto getPlayerHandCoord(int32_t playerNum) const -> const cv::Rect&;
-            auto getPlayerStackCoord(int32_t playerNum) const -> const cv::Rect&;
+            auto getPlayerActionCoord(int32_t playerNum) const -> const cv::Rect& { return _getPlayerCoords(playerNum).action; }
+            auto getPlayerBetCoord(int32_t playerNum) const -> const cv::Rect& { return _getPlayerCoords(playerNum).bet; }
+            auto getPlayerButtonCoord(int32_t playerNum) const -> const cv::Rect& { return _getPlayerCoords(playerNum).button; }
+            auto getPlayerCardsCoord(int32_t playerNum) const -> const cv::Rect& { return _getVillainCoords(playerNum).cards; }
+            auto getPlayerHandCoord(int32_t playerNum) const -> const cv::Rect& { return _getVillainCoords(playerNum).hand; }
+            auto getPlayerNameCoord(int32_t playerNum) const -> const cv::Rect& { return _getPlayerCoords(playerNum).name; }
+            auto getPlayerStackCoord(int32_t playerNum) const -> const cv::Rect& { return _getPlayerCoords(playerNum).stack; }
             // For the image extraction
             auto getPlayerActionImg(const cv::Mat& img, int32_t num) -> const cv::Mat { return img(getPlayerActionCoord(num)); }
             auto getPlayerBetImg(const cv::Mat& img, int32_t num) -> const cv::Mat { return img(getPlayerBetCoord(num)); }
             auto getPlayerButtonImg(const cv::Mat& img, int32_t num) -> const cv::Mat { return img(getPlayerButtonCoord(num)); }
             auto getPlayerCardsImg(const cv::Mat& img, int32_t num) -> const cv::Mat { return img(getPlayerCardsCoord(num)); }
             auto getPlayerHandImg(const cv::Mat& img, int32_t num) -> const cv::Mat { return img(getPlayerHandCoord(num)); }
+            auto getPlayerNameImg(const cv::Mat& img, int32_t num) -> const cv::Mat { return img(getPlayerNameCoord(num)); }
             auto getPlayerStackImg(const cv::Mat& img, int32_t num) -> const cv::Mat { return img(getPlayerStackCoord(num)); }
 
             auto getActiveWindows() -> windows_t;
@@ -190,6 +160,7 @@ namespace Scraper {
             auto getWindowElementsView(const cv::Mat& img) const -> const cv::Mat;
 
             [[nodiscard]] auto toJson() const -> json;
+            auto writeJson(JsonWriter& writer) const -> void;
 
             auto loadFromJson(const json& json) -> void;
 
@@ -210,32 +181,20 @@ namespace Scraper {
             cv::Rect _boardCard3Coord;
             cv::Rect _boardCard4Coord;
             cv::Rect _boardCard5Coord;
-            cv::Rect _player1ActionCoord;
-            cv::Rect _player1BetCoord;
-            cv::Rect _player1ButtonCoord;
-            cv::Rect _player1NameCoord;
-            cv::Rect _player1StackCoord;
-            cv::Rect _player2ActionCoord;
-            cv::Rect _player2BetCoord;
-            cv::Rect _player2ButtonCoord;
-            cv::Rect _player2CardsCoord;
-            cv::Rect _player2HandCoord;
-            cv::Rect _player2NameCoord;
-            cv::Rect _player2StackCoord;
-            cv::Rect _player3ActionCoord;
-            cv::Rect _player3BetCoord;
-            cv::Rect _player3ButtonCoord;
-            cv::Rect _player3CardsCoord;
-            cv::Rect _player3HandCoord;
-            cv::Rect _player3NameCoord;
-            cv::Rect _player3StackCoord;
             cv::Rect _potCoord;
             cv::Rect _prizePoolCoord;
 
+            std::vector<PlayerCoords> _playersCoords;  // Indexed by the player number - 1
+
             auto _parseActiveWindows() -> void;
             auto _rectToJson(const cv::Rect& rect) const -> json;
+            auto _writeRect(JsonWriter& writer, const cv::Rect& rect) const -> void;
             auto _jsonToRect(const json& json) const -> cv::Rect;
             auto _loadDefaultModel() -> void;
+            auto _getPlayerCoords(int32_t playerNum) -> PlayerCoords&;
+            auto _getVillainCoords(int32_t playerNum) -> PlayerCoords&;
+            [[nodiscard]] auto _getPlayerCoords(int32_t playerNum) const -> const PlayerCoords&;
+            [[nodiscard]] auto _getVillainCoords(int32_t playerNum) const -> const PlayerCoords&;
     };
 }  // namespace Scraper
 
@@ -35,25 +35,9 @@ namespace Scraper {
             _boardCard3Coord     = other._boardCard3Coord;
             _boardCard4Coord     = other._boardCard4Coord;
             _boardCard5Coord     = other._boardCard5Coord;
-            _player1ActionCoord  = other._player1ActionCoord;
-            _player1BetCoord     = other._player1BetCoord;
-            _player1ButtonCoord  = other._player1ButtonCoord;
-            _player1NameCoord    = other._player1NameCoord;
-            _player1StackCoord   = other._player1StackCoord;
-            _player2ActionCoord  = other._player2ActionCoord;
-            _player2BetCoord     = other._player2BetCoord;
-            _player2ButtonCoord  = other._player2ButtonCoord;
-            _player2HandCoord    = other._player2HandCoord;
-            _player2NameCoord    = other._player2NameCoord;
-            _player2StackCoord   = other._player2StackCoord;
-            _player3ActionCoord  = other._player3ActionCoord;
-            _player3BetCoord     = other._player3BetCoord;
-            _player3ButtonCoord  = other._player3ButtonCoord;
-            _player3HandCoord    = other._player3HandCoord;
-            _player3NameCoord    = other._player3NameCoord;
-            _player3StackCoord   = other._player3StackCoord;
             _potCoord            = other._potCoord;
             _prizePoolCoord      = other._prizePoolCoord;
+            _playersCoords       = std::move(other._playersCoords);
         }
 
         return *this;
@@ -191,77 +175,55 @@ namespace Scraper {
 
     auto Model::getWindowElementsView(const cv::Mat& img) const -> const cv::Mat {
         cv::Mat               elementsView = img.clone();
-        std::vector<cv::Rect> elements     = {
-            getAverageStackCoord(),  getBlindAmountCoord(),   getBlindLevelCoord(),   getBlindLevelTimeCoord(), getBoardCard1Coord(),
-            getBoardCard2Coord(),    getBoardCard3Coord(),    getBoardCard4Coord(),   getBoardCard5Coord(),     getFirstCardCoord(),
-            getSecondCardCoord(),    getPlayer1ActionCoord(), getPlayer1BetCoord(),   getPlayer1ButtonCoord(),  getPlayer1NameCoord(),
-            getPlayer1StackCoord(),  getPlayer2ActionCoord(), getPlayer2BetCoord(),   getPlayer2ButtonCoord(),  getPlayer2CardsCoord(),
-            getPlayer2HandCoord(),   getPlayer2NameCoord(),   getPlayer2StackCoord(), getPlayer3ActionCoord(),  getPlayer3BetCoord(),
-            getPlayer3ButtonCoord(), getPlayer3CardsCoord(),  getPlayer3HandCoord(),  getPlayer3NameCoord(),    getPlayer3StackCoord(),
-            getPotCoord(),           getPrizePoolCoord()};
+        std::vector<cv::Rect> elements     = {getAverageStackCoord(),
+                                                  getBlindAmountCoord(),
+                                                  getBlindLevelCoord(),
+                                                  getBlindLevelTimeCoord(),
+                                                  getBoardCard1Coord(),
+                                                  getBoardCard2Coord(),
+                                                  getBoardCard3Coord(),
+                                                  getBoardCard4Coord(),
+                                                  getBoardCard5Coord(),
+                                                  getFirstCardCoord(),
+                                                  getSecondCardCoord(),
+                                                  getPotCoord(),
+                                                  getPrizePoolCoord()};
+
+        for (const auto& player : _playersCoords) {
+            elements.insert(elements.end(), {player.action, player.bet, player.button, player.cards, player.hand, player.name, player.stack});
+        }
 
         for (const auto& element : elements) { cv::rectangle(elementsView, element, cv::Scalar(0, 255, 0), 2); }
 
         return elementsView;
     }
 
-    auto Model::getPlayerActionCoord(int32_t playerNum) const -> const cv::Rect& {
-        switch (playerNum) {
-            case 1: return _player1ActionCoord;
-            case 2: return _player2ActionCoord;
-            case 3: return _player3ActionCoord;
-            default: throw std::invalid_argument("Invalid player number");
-        }
-    }
+    auto Model::_getPlayerCoords(int32_t playerNum) -> PlayerCoords& {
+        if (playerNum <= 0 || playerNum > getSeatsNumber()) { throw std::invalid_argument("Invalid player number"); }
 
-    auto Model::getPlayerBetCoord(int32_t playerNum) const -> const cv::Rect& {
-        switch (playerNum) {
-            case 1: return _player1BetCoord;
-            case 2: return _player2BetCoord;
-            case 3: return _player3BetCoord;
-            default: throw std::invalid_argument("Invalid player number");
-        }
+        return _playersCoords[playerNum - 1];
     }
 
-    auto Model::getPlayerButtonCoord(int32_t playerNum) const -> const cv::Rect& {
-        switch (playerNum) {
-            case 1: return _player1ButtonCoord;
-            case 2: return _player2ButtonCoord;
-            case 3: return _player3ButtonCoord;
-            default: throw std::invalid_argument("Invalid player number");
-        }
-    }
+    auto Model::_getPlayerCoords(int32_t playerNum) const -> const PlayerCoords& {
+        if (playerNum <= 0 || playerNum > getSeatsNumber()) { throw std::invalid_argument("Invalid player number"); }
 
-    auto Model::getPlayerCardsCoord(int32_t playerNum) const -> const cv::Rect& {
-        switch (playerNum) {
-            case 2: return _player2CardsCoord;
-            case 3: return _player3CardsCoord;
-            default: throw std::invalid_argument("Invalid player number");
-        }
+        return _playersCoords[playerNum - 1];
     }
 
-    auto Model::getPlayerHandCoord(int32_t playerNum) const -> const cv::Rect& {
-        switch (playerNum) {
-            case 2: return _player2HandCoord;
-            case 3: return _player3HandCoord;
-            default: throw std::invalid_argument("Invalid player number");
-        }
+    auto Model::_getVillainCoords(int32_t playerNum) -> PlayerCoords& {
+        if (playerNum == 1) { throw std::invalid_argument("Invalid player number"); }
+
+        return _getPlayerCoords(playerNum);
     }
 
-    auto Model::getPlayerStackCoord(int32_t playerNum) const -> const cv::Rect& {
-        switch (playerNum) {
-            case 1: return _player1StackCoord;
-            case 2: return _player2StackCoord;
-            case 3: return _player3StackCoord;
-            default: throw std::invalid_argument("Invalid player number");
-        }
+    auto Model::_getVillainCoords(int32_t playerNum) const -> const PlayerCoords& {
+        if (playerNum == 1) { throw std::invalid_argument("Invalid player number"); }
+
+        return _getPlayerCoords(playerNum);
     }
 
     auto Model::toJson() const -> json {
-        return {{"roomName", _roomName},
-                {"windowSize", {{"width", _windowSize.width}, {"height", _windowSize.height}}},
-                {"elementsBoxes",
-                 {{"averageStack", _rectToJson(getAverageStackCoord())},
+        json elementsBoxes = {{"averageStack", _rectToJson(getAverageStackCoord())},
                   {"blindAmount", _rectToJson(getBlindAmountCoord())},
                   {"blindLevel", _rectToJson(getBlindLevelCoord())},
                   {"blindLevelTime", _rectToJson(getBlindLevelTimeCoord())},
@@ -272,27 +234,68 @@ namespace Scraper {
                   {"boardCard5", _rectToJson(getBoardCard5Coord())},
                   {"firstCard", _rectToJson(getFirstCardCoord())},
                   {"secondCard", _rectToJson(getSecondCardCoord())},
-                  {"player1Action", _rectToJson(getPlayer1ActionCoord())},
-                  {"player1Bet", _rectToJson(getPlayer1BetCoord())},
-                  {"player1Button", _rectToJson(getPlayer1ButtonCoord())},
-                  {"player1Name", _rectToJson(getPlayer1NameCoord())},
-                  {"player1Stack", _rectToJson(getPlayer1StackCoord())},
-                  {"player2Action", _rectToJson(getPlayer2ActionCoord())},
-                  {"player2Bet", _rectToJson(getPlayer2BetCoord())},
-                  {"player2Button", _rectToJson(getPlayer2ButtonCoord())},
-                  {"player2Cards", _rectToJson(getPlayer2CardsCoord())},
-                  {"player2Hand", _rectToJson(getPlayer2HandCoord())},
-                  {"player2Name", _rectToJson(getPlayer2NameCoord())},
-                  {"player2Stack", _rectToJson(getPlayer2StackCoord())},
-                  {"player3Action", _rectToJson(getPlayer3ActionCoord())},
-                  {"player3Bet", _rectToJson(getPlayer3BetCoord())},
-                  {"player3Button", _rectToJson(getPlayer3ButtonCoord())},
-                  {"player3Cards", _rectToJson(getPlayer3CardsCoord())},
-                  {"player3Hand", _rectToJson(getPlayer3HandCoord())},
-                  {"player3Name", _rectToJson(getPlayer3NameCoord())},
-                  {"player3Stack", _rectToJson(getPlayer3StackCoord())},
                   {"pot", _rectToJson(getPotCoord())},
-                  {"prizePool", _rectToJson(getPrizePoolCoord())}}}};
+                  {"prizePool", _rectToJson(getPrizePoolCoord())}};
+
+        for (int32_t playerNum = 1; playerNum <= getSeatsNumber(); ++playerNum) {
+            const auto& player = _getPlayerCoords(playerNum);
+
+            elementsBoxes[fmt::format("player{}Action", playerNum)] = _rectToJson(player.action);
+            elementsBoxes[fmt::format("player{}Bet", playerNum)]    = _rectToJson(player.bet);
+            elementsBoxes[fmt::format("player{}Button", playerNum)] = _rectToJson(player.button);
+            elementsBoxes[fmt::format("player{}Name", playerNum)]   = _rectToJson(player.name);
+            elementsBoxes[fmt::format("player{}Stack", playerNum)]  = _rectToJson(player.stack);
+
+            if (playerNum != 1) {
+                elementsBoxes[fmt::format("player{}Cards", playerNum)] = _rectToJson(player.cards);
+                elementsBoxes[fmt::format("player{}Hand", playerNum)]  = _rectToJson(player.hand);
+            }
+        }
+
+        return {{"roomName", _roomName},
+                {"windowSize", {{"width", _windowSize.width}, {"height", _windowSize.height}}},
+                {"elementsBoxes", elementsBoxes}};
+    }
+
+    auto Model::writeJson(JsonWriter& writer) const -> void {
+        writer.startObject();
+        writer.key("roomName").value(_roomName);
+        writer.key("windowSize").startObject();
+        writer.key("width").value(_windowSize.width);
+        writer.key("height").value(_windowSize.height);
+        writer.endObject();
+        writer.key("elementsBoxes").startObject();
+        _writeRect(writer.key("averageStack"), getAverageStackCoord());
+        _writeRect(writer.key("blindAmount"), getBlindAmountCoord());
+        _writeRect(writer.key("blindLevel"), getBlindLevelCoord());
+        _writeRect(writer.key("blindLevelTime"), getBlindLevelTimeCoord());
+        _writeRect(writer.key("boardCard1"), getBoardCard1Coord());
+        _writeRect(writer.key("boardCard2"), getBoardCard2Coord());
+        _writeRect(writer.key("boardCard3"), getBoardCard3Coord());
+        _writeRect(writer.key("boardCard4"), getBoardCard4Coord());
+        _writeRect(writer.key("boardCard5"), getBoardCard5Coord());
+        _writeRect(writer.key("firstCard"), getFirstCardCoord());
+        _writeRect(writer.key("secondCard"), getSecondCardCoord());
+        _writeRect(writer.key("pot"), getPotCoord());
+        _writeRect(writer.key("prizePool"), getPrizePoolCoord());
+
+        for (int32_t playerNum = 1; playerNum <= getSeatsNumber(); ++playerNum) {
+            const auto& player = _getPlayerCoords(playerNum);
+
+            _writeRect(writer.key("player{}Action", playerNum), player.action);
+            _writeRect(writer.key("player{}Bet", playerNum), player.bet);
+            _writeRect(writer.key("player{}Button", playerNum), player.button);
+            _writeRect(writer.key("player{}Name", playerNum), player.name);
+            _writeRect(writer.key("player{}Stack", playerNum), player.stack);
+
+            if (playerNum != 1) {
+                _writeRect(writer.key("player{}Cards", playerNum), player.cards);
+                _writeRect(writer.key("player{}Hand", playerNum), player.hand);
+            }
+        }
+
+        writer.endObject();
+        writer.endObject();
     }
 
     auto Model::loadFromJson(const json& json) -> void {
@@ -308,28 +311,28 @@ namespace Scraper {
         _boardCard5Coord     = _jsonToRect(json.at("elementsBoxes").at("boardCard5"));
         _firstCardCoord      = _jsonToRect(json.at("elementsBoxes").at("firstCard"));
         _secondCardCoord     = _jsonToRect(json.at("elementsBoxes").at("secondCard"));
-        _player1ActionCoord  = _jsonToRect(json.at("elementsBoxes").at("player1Action"));
-        _player1BetCoord     = _jsonToRect(json.at("elementsBoxes").at("player1Bet"));
-        _player1ButtonCoord  = _jsonToRect(json.at("elementsBoxes").at("player1Button"));
-        _player1NameCoord    = _jsonToRect(json.at("elementsBoxes").at("player1Name"));
-        _player1StackCoord   = _jsonToRect(json.at("elementsBoxes").at("player1Stack"));
-        _player2ActionCoord  = _jsonToRect(json.at("elementsBoxes").at("player2Action"));
-        _player2BetCoord     = _jsonToRect(json.at("elementsBoxes").at("player2Bet"));
-        _player2ButtonCoord  = _jsonToRect(json.at("elementsBoxes").at("player2Button"));
-        _player2CardsCoord   = _jsonToRect(json.at("elementsBoxes").at("player2Cards"));
-        _player2HandCoord    = _jsonToRect(json.at("elementsBoxes").at("player2Hand"));
-        _player2NameCoord    = _jsonToRect(json.at("elementsBoxes").at("player2Name"));
-        _player2StackCoord   = _jsonToRect(json.at("elementsBoxes").at("player2Stack"));
-        _player3ActionCoord  = _jsonToRect(json.at("elementsBoxes").at("player3Action"));
-        _player3BetCoord     = _jsonToRect(json.at("elementsBoxes").at("player3Bet"));
-        _player3ButtonCoord  = _jsonToRect(json.at("elementsBoxes").at("player3Button"));
-        _player3CardsCoord   = _jsonToRect(json.at("elementsBoxes").at("player3Cards"));
-        _player3HandCoord    = _jsonToRect(json.at("elementsBoxes").at("player3Hand"));
-        _player3NameCoord    = _jsonToRect(json.at("elementsBoxes").at("player3Name"));
-        _player3StackCoord   = _jsonToRect(json.at("elementsBoxes").at("player3Stack"));
         _potCoord            = _jsonToRect(json.at("elementsBoxes").at("pot"));
         _prizePoolCoord      = _jsonToRect(json.at("elementsBoxes").at("prizePool"));
         _windowSize          = {json.at("windowSize").at("width"), json.at("windowSize").at("height")};
+        // The seats number is given by the players elements defined in the model
+        const auto& boxes = json.at("elementsBoxes");
+
+        _playersCoords.clear();
+
+        for (int32_t playerNum = 1; boxes.contains(fmt::format("player{}Action", playerNum)); ++playerNum) {
+            auto& player = _playersCoords.emplace_back();
+
+            player.action = _jsonToRect(boxes.at(fmt::format("player{}Action", playerNum)));
+            player.bet    = _jsonToRect(boxes.at(fmt::format("player{}Bet", playerNum)));
+            player.button = _jsonToRect(boxes.at(fmt::format("player{}Button", playerNum)));
+            player.name   = _jsonToRect(boxes.at(fmt::format("player{}Name", playerNum)));
+            player.stack  = _jsonToRect(boxes.at(fmt::format("player{}Stack", playerNum)));
+
+            if (playerNum != 1) {
+                player.cards = _jsonToRect(boxes.at(fmt::format("player{}Cards", playerNum)));
+                player.hand  = _jsonToRect(boxes.at(fmt::format("player{}Hand", playerNum)));
+            }
+        }
     }
 
     auto Model::_jsonToRect(const json& json) const -> cv::Rect {
@@ -339,6 +342,15 @@ namespace Scraper {
     auto Model::_rectToJson(const cv::Rect& rect) const -> json {
         return {{"topLeft", {{"x", rect.x}, {"y", rect.y}}}, {"width", rect.width}, {"height", rect.height}};
     }
+
+    auto Model::_writeRect(JsonWriter& writer, const cv::Rect& rect) const -> void {
+        writer.startObject();
+        writer.key("topLeft").startObject().key("x").value(rect.x).key("y").value(rect.y).endObject();
+        writer.key("width").value(rect.width);
+        writer.key("height").value(rect.height);
+        writer.endObject();
+    }
+
     auto Model::_loadDefaultModel() -> void {
         std::filesystem::path modelPath;
 
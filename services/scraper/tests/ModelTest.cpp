@@ -71,25 +71,25 @@ TEST(ModelTest, jsonRepresentationShouldBeCorrect) {
     scraper.setBoardCard3Coord(cv::Rect(3790, 2978, 3021, 2210));
     scraper.setBoardCard4Coord(cv::Rect(4567, 567, 1002, 4578));
     scraper.setBoardCard5Coord(cv::Rect(965, 4876, 1572, 3940));
-    scraper.setPlayer1ActionCoord(cv::Rect(685, 145, 23, 687));
-    scraper.setPlayer1BetCoord(cv::Rect(3097, 3678, 4679, 3510));
-    scraper.setPlayer1ButtonCoord(cv::Rect(3487, 1679, 4258, 4800));
-    scraper.setPlayer1NameCoord(cv::Rect(3780, 4780, 2001, 3010));
-    scraper.setPlayer1StackCoord(cv::Rect(1028, 2190, 345, 489));
-    scraper.setPlayer2ActionCoord(cv::Rect(1234, 1234, 1234, 1234));
-    scraper.setPlayer2BetCoord(cv::Rect(890, 2800, 4789, 1325));
-    scraper.setPlayer2ButtonCoord(cv::Rect(101, 2909, 969, 2530));
-    scraper.setPlayer2CardsCoord(cv::Rect(1019, 3809, 55, 50));
-    scraper.setPlayer2HandCoord(cv::Rect(1019, 3809, 3050, 120));
-    scraper.setPlayer2NameCoord(cv::Rect(2014, 1900, 3976, 3500));
-    scraper.setPlayer2StackCoord(cv::Rect(3245, 4580, 4056, 1890));
-    scraper.setPlayer3ActionCoord(cv::Rect(1234, 1234, 1234, 1234));
-    scraper.setPlayer3BetCoord(cv::Rect(4320, 4057, 1290, 3495));
-    scraper.setPlayer3ButtonCoord(cv::Rect(1487, 3679, 3031, 201));
-    scraper.setPlayer3CardsCoord(cv::Rect(1200, 1380, 55, 50));
-    scraper.setPlayer3HandCoord(cv::Rect(1235, 3909, 4503, 2364));
-    scraper.setPlayer3NameCoord(cv::Rect(157, 3470, 2450, 880));
-    scraper.setPlayer3StackCoord(cv::Rect(2301, 4809, 4670, 2450));
+    scraper.setPlayerActionCoord(1, cv::Rect(685, 145, 23, 687));
+    scraper.setPlayerBetCoord(1, cv::Rect(3097, 3678, 4679, 3510));
+    scraper.setPlayerButtonCoord(1, cv::Rect(3487, 1679, 4258, 4800));
+    scraper.setPlayerNameCoord(1, cv::Rect(3780, 4780, 2001, 3010));
+    scraper.setPlayerStackCoord(1, cv::Rect(1028, 2190, 345, 489));
+    scraper.setPlayerActionCoord(2, cv::Rect(1234, 1234, 1234, 1234));
+    scraper.setPlayerBetCoord(2, cv::Rect(890, 2800, 4789, 1325));
+    scraper.setPlayerButtonCoord(2, cv::Rect(101, 2909, 969, 2530));
+    scraper.setPlayerCardsCoord(2, cv::Rect(1019, 3809, 55, 50));
+    scraper.setPlayerHandCoord(2, cv::Rect(1019, 3809, 3050, 120));
+    scraper.setPlayerNameCoord(2, cv::Rect(2014, 1900, 3976, 3500));
+    scraper.setPlayerStackCoord(2, cv::Rect(3245, 4580, 4056, 1890));
+    scraper.setPlayerActionCoord(3, cv::Rect(1234, 1234, 1234, 1234));
+    scraper.setPlayerBetCoord(3, cv::Rect(4320, 4057, 1290, 3495));
+    scraper.setPlayerButtonCoord(3, cv::Rect(1487, 3679, 3031, 201));
+    scraper.setPlayerCardsCoord(3, cv::Rect(1200, 1380, 55, 50));
+    scraper.setPlayerHandCoord(3, cv::Rect(1235, 3909, 4503, 2364));
+    scraper.setPlayerNameCoord(3, cv::Rect(157, 3470, 2450, 880));
+    scraper.setPlayerStackCoord(3, cv::Rect(2301, 4809, 4670, 2450));
     scraper.setPotCoord(cv::Rect(1234, 1467, 4261, 957));
     scraper.setPrizePoolCoord(cv::Rect(1073, 3568, 3274, 2348));
     scraper.setSecondCardCoord(cv::Rect(1125, 982, 2951, 3567));
@@ -137,6 +137,12 @@ TEST(ModelTest, jsonRepresentationShouldBeCorrect) {
     )"_json;
 
     EXPECT_EQ(scraper.toJson(), jsonExpected);
+
+    GameHandler::JsonWriter writer;
+
+    scraper.writeJson(writer);
+
+    EXPECT_EQ(json::parse(writer.view()), jsonExpected);
 }
 
 TEST(ModelTest, loadFromJsonShouldSetCorrectAttributes) {
@@ -187,6 +193,7 @@ TEST(ModelTest, loadFromJsonShouldSetCorrectAttributes) {
     scraper.loadFromJson(jsonInput);
 
     EXPECT_EQ(scraper.getRoomName(), "Unibet");
+    EXPECT_EQ(scraper.getSeatsNumber(), 3);
     EXPECT_EQ(scraper.getAverageStackCoord(), cv::Rect(236, 892, 20, 68));
     EXPECT_EQ(scraper.getBlindAmountCoord(), cv::Rect(3437, 3635, 3637, 3739));
     EXPECT_EQ(scraper.getBlindLevelCoord(), cv::Rect(3335, 3539, 3635, 3637));
@@ -197,25 +204,25 @@ TEST(ModelTest, loadFromJsonShouldSetCorrectAttributes) {
     EXPECT_EQ(scraper.getBoardCard4Coord(), cv::Rect(1011, 1213, 1415, 1617));
     EXPECT_EQ(scraper.getBoardCard5Coord(), cv::Rect(1213, 1415, 1617, 1819));
     EXPECT_EQ(scraper.getFirstCardCoord(), cv::Rect(1234, 2345, 3456, 4567));
-    EXPECT_EQ(scraper.getPlayer1ActionCoord(), cv::Rect(685, 145, 23, 687));
-    EXPECT_EQ(scraper.getPlayer1BetCoord(), cv::Rect(2725, 2929, 3131, 3233));
-    EXPECT_EQ(scraper.getPlayer1ButtonCoord(), cv::Rect(2011, 2215, 2317, 2419));
-    EXPECT_EQ(scraper.getPlayer1NameCoord(), cv::Rect(1415, 1617, 1819, 2011));
-    EXPECT_EQ(scraper.getPlayer1StackCoord(), cv::Rect(2419, 2623, 2725, 2827));
-    EXPECT_EQ(scraper.getPlayer2ActionCoord(), cv::Rect(1234, 1234, 1234, 1234));
-    EXPECT_EQ(scraper.getPlayer2BetCoord(), cv::Rect(2827, 3131, 3233, 3335));
-    EXPECT_EQ(scraper.getPlayer2ButtonCoord(), cv::Rect(2215, 2317, 2419, 2521));
-    EXPECT_EQ(scraper.getPlayer2CardsCoord(), cv::Rect(1019, 3809, 55, 50));
-    EXPECT_EQ(scraper.getPlayer2HandCoord(), cv::Rect(3131, 3335, 3437, 3539));
-    EXPECT_EQ(scraper.getPlayer2NameCoord(), cv::Rect(1617, 1819, 2011, 2113));
-    EXPECT_EQ(scraper.getPlayer2StackCoord(), cv::Rect(2521, 2725, 2827, 2929));
-    EXPECT_EQ(scraper.getPlayer3ActionCoord(), cv::Rect(1234, 1234, 1234, 1234));
-    EXPECT_EQ(scraper.getPlayer3BetCoord(), cv::Rect(2929, 3233, 3335, 3437));
-    EXPECT_EQ(scraper.getPlayer3ButtonCoord(), cv::Rect(2317, 2521, 2623, 2725));
-    EXPECT_EQ(scraper.getPlayer3CardsCoord(), cv::Rect(1200, 1380, 55, 50));
-    EXPECT_EQ(scraper.getPlayer3HandCoord(), cv::Rect(3233, 3437, 3621, 3623));
-    EXPECT_EQ(scraper.getPlayer3NameCoord(), cv::Rect(1819, 2011, 2113, 2215));
-    EXPECT_EQ(scraper.getPlayer3StackCoord(), cv::Rect(2623, 2827, 2929, 3131));
+    EXPECT_EQ(scraper.getPlayerActionCoord(1), cv::Rect(685, 145, 23, 687));
+    EXPECT_EQ(scraper.getPlayerBetCoord(1), cv::Rect(2725, 2929, 3131, 3233));
+    EXPECT_EQ(scraper.getPlayerButtonCoord(1), cv::Rect(2011, 2215, 2317, 2419));
+    EXPECT_EQ(scraper.getPlayerNameCoord(1), cv::Rect(1415, 1617, 1819, 2011));
+    EXPECT_EQ(scraper.getPlayerStackCoord(1), cv::Rect(2419, 2623, 2725, 2827));
+    EXPECT_EQ(scraper.getPlayerActionCoord(2), cv::Rect(1234, 1234, 1234, 1234));
+    EXPECT_EQ(scraper.getPlayerBetCoord(2), cv::Rect(2827, 3131, 3233, 3335));
+    EXPECT_EQ(scraper.getPlayerButtonCoord(2), cv::Rect(2215, 2317, 2419, 2521));
+    EXPECT_EQ(scraper.getPlayerCardsCoord(2), cv::Rect(1019, 3809, 55, 50));
+    EXPECT_EQ(scraper.getPlayerHandCoord(2), cv::Rect(3131, 3335, 3437, 3539));
+    EXPECT_EQ(scraper.getPlayerNameCoord(2), cv::Rect(1617, 1819, 2011, 2113));
+    EXPECT_EQ(scraper.getPlayerStackCoord(2), cv::Rect(2521, 2725, 2827, 2929));
+    EXPECT_EQ(scraper.getPlayerActionCoord(3), cv::Rect(1234, 1234, 1234, 1234));
+    EXPECT_EQ(scraper.getPlayerBetCoord(3), cv::Rect(2929, 3233, 3335, 3437));
+    EXPECT_EQ(scraper.getPlayerButtonCoord(3), cv::Rect(2317, 2521, 2623, 2725));
+    EXPECT_EQ(scraper.getPlayerCardsCoord(3), cv::Rect(1200, 1380, 55, 50));
+    EXPECT_EQ(scraper.getPlayerHandCoord(3), cv::Rect(3233, 3437, 3621, 3623));
+    EXPECT_EQ(scraper.getPlayerNameCoord(3), cv::Rect(1819, 2011, 2113, 2215));
+    EXPECT_EQ(scraper.getPlayerStackCoord(3), cv::Rect(2623, 2827, 2929, 3131));
     EXPECT_EQ(scraper.getPotCoord(), cv::Rect(3456, 4567, 5467, 1234));
     EXPECT_EQ(scraper.getPrizePoolCoord(), cv::Rect(4567, 1234, 1234, 2345));
     EXPECT_EQ(scraper.getSecondCardCoord(), cv::Rect(2345, 3465, 432, 546));
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+namespace Utilities::Gtest {
+    /**
+     * @brief Counts the heap allocations made by the current thread since its construction.
+     *
+     * The counting relies on the global operator new replacement of `src/AllocationCounter.cpp`, which must be linked into
+     * the test executable.
+     */
+    class AllocationCounter {
+        public:
+            AllocationCounter()
+              : _start(allocations()) {}
+
+            [[nodiscard]] auto count() const -> int64_t { return allocations() - _start; }
+
+            [[nodiscard]] static auto allocations() noexcept -> int64_t { return _allocations(); }
+
+            static auto increment() noexcept -> void { ++_allocations(); }
+
+        private:
+            int64_t _start;
+
+            // Thread local so allocations made by other threads (logger backend, etc ...) are not counted
+            static auto _allocations() noexcept -> int64_t& {
+                thread_local int64_t allocations = 0;
+
+                return allocations;
+            }
+    };
+}  // namespace Utilities::Gtest
+
+#define EXPECT_ALLOCATIONS_EQ(code, expected_allocations)                      \
+    do {                                                                       \
+        Utilities::Gtest::AllocationCounter allocationCounter;                 \
+                                                                               \
+        code;                                                                  \
+                                                                               \
+        auto allocationsCount = allocationCounter.count();                     \
+                                                                               \
+        EXPECT_EQ(allocationsCount, expected_allocations) << "In: " << #code; \
+    } while (0)
+
+#define EXPECT_NO_ALLOCATION(code) EXPECT_ALLOCATIONS_EQ(code, 0)
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <game_handler/CardFactory.hpp>
+#include <game_handler/Game.hpp>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+namespace Utilities::Gtest {
+    using GameHandler::Game;
+    using GameHandler::Factory::card;
+
+    static constexpr int32_t DEEP_STACK = 100'000'000;  // Nobody busts in the long games
+
+    inline const std::vector<std::string> THREE_PLAYERS = {"player 1", "player 2", "player 3"};
+
+    // Two rounds between 3 players with 1000 chips: the hero folds its button to a raise, then goes all in from the big blind
+    // with aces over a raise and a call. The raiser calls and loses at the showdown. The game is not ended.
+    inline auto playFoldThenAllInShowdown(Game& game, const std::vector<std::string>& playersName = THREE_PLAYERS) -> void {
+        game.setInitialStack(1000);
+        game.init(playersName);
+
+        {
+            auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+            round.raiseTo(2, 300);
+            round.fold(3);
+            round.fold(1);
+        }
+
+        auto& round = game.newRound({100, 200}, {card("AH"), card("AS")}, 2);
+
+        round.raiseTo(2, 500);
+        round.call(3);
+        round.allIn(1);
+        round.call(2);
+        round.fold(3);
+        round.getBoard().setCards({card("AD"), card("KS"), card("KH"), card("8C"), card("7C")});
+        round.setPlayerHand({card("TS"), card("TH")}, 2);
+        round.showdown();
+    }
+
+    // Two rounds between 3 players with 1000 chips: the hero raises its button and wins with a flop bet, then calls an all in
+    // from the big blind with aces and wins at the showdown. The game is not ended so its last round is still in progress.
+    inline auto playFlopBetThenAllInShowdown(Game& game, const std::vector<std::string>& playersName = THREE_PLAYERS) -> void {
+        game.setInitialStack(1000);
+        game.init(playersName);
+
+        {
+            auto& round = game.newRound({50, 100}, {card("AH"), card("KH")}, 1);
+
+            round.raiseTo(1, 300);
+            round.fold(2);
+            round.call(3);
+            round.getBoard().setFlop({card("2C"), card("5D"), card("9H")});
+            round.check(3);
+            round.bet(1, 400);
+            round.fold(3);
+        }
+
+        auto& round = game.newRound({100, 200}, {card("AD"), card("AC")}, 2);
+
+        round.raiseTo(2, 950);
+        round.call(3);
+        round.call(1);
+        round.getBoard().setCards({card("AS"), card("KS"), card("KH"), card("8C"), card("7C")});
+        round.setPlayerHand({card("TS"), card("TH")}, 2);
+        round.setPlayerHand({card("9S"), card("9H")}, 3);
+        round.showdown();
+    }
+
+    // An ended game of roundsNumber rounds with deep stacks, each round is created and played by playRound(game, roundNum)
+    template<typename RoundScript>
+    auto playLongGame(const std::vector<std::string>& playersName, int32_t roundsNumber, RoundScript&& playRound) -> Game {
+        Game game;
+
+        game.setInitialStack(DEEP_STACK);
+        game.init(playersName);
+
+        for (int32_t roundNum = 0; roundNum < roundsNumber; ++roundNum) { playRound(game, roundNum); }
+
+        game.end();
+
+        return game;
+    }
+}  // namespace Utilities::Gtest
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
@@ -2,13 +2,35 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+
 #include <nlohmann/json.hpp>
 
 #include <fmt/format.h>
 
+#ifdef _WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
 namespace Utilities::Gtest {
     using nlohmann::json;
 
+    // A temporary path owned by the running test, so the tests run in parallel by ctest do not share their files
+    inline auto testTempPath(std::string_view name) -> std::filesystem::path {
+        const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+#ifdef _WIN32
+        auto processId = _getpid();
+#else
+        auto processId = getpid();
+#endif
+
+        auto fileName = fmt::format("{}_{}_{}_{}", test->test_suite_name(), test->name(), processId, name);
+
+        return std::filesystem::temp_directory_path() / fileName;
+    }
+
     void compareJson(const json& actualJson, const json& expectedJson, const std::string& path, std::string& differences) {
         if (actualJson.is_object() && expectedJson.is_object()) {
             for (const auto& [key, value] : actualJson.items()) {
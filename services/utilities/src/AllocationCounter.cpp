@@ -0,0 +1,19 @@
+#include "utilities/AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+// Replacement of the global allocation functions, the nothrow and array versions forward to these ones
+auto operator new(std::size_t size) -> void* {
+    Utilities::Gtest::AllocationCounter::increment();
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+
+    throw std::bad_alloc();
+}
+
+auto operator new[](std::size_t size) -> void* { return ::operator new(size); }
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+auto operator delete[](void* ptr) noexcept -> void { std::free(ptr); }
+auto operator delete(void* ptr, std::size_t /*size*/) noexcept -> void { std::free(ptr); }
+auto operator delete[](void* ptr, std::size_t /*size*/) noexcept -> void { std::free(ptr); }